@@ -60,6 +60,12 @@ PXR_NAMESPACE_OPEN_SCOPE
     /*       to be serialized to the Maya file.                     */ \
     /*    3: ignore all Usd edits.                                  */ \
     ((SerializedUsdEditsLocation, "mayaUsd_SerializedUsdEditsLocation")) \
+    /* Format of the Usd edits exported to Maya string attributes.  */ \
+    /* optionVar values are:                                        */ \
+    /*    1: usda text.                                             */ \
+    /*    2: usdc crate bytes, encoded in base64.                   */ \
+    /*    3: usdc crate bytes, compressed and encoded in base64.    */ \
+    ((SerializedUsdEditsFormat, "mayaUsd_SerializedUsdEditsFormat")) \
     /* optionVar to force a prompt on every save                    */ \
     ((SerializedUsdEditsLocationPrompt, "mayaUsd_SerializedUsdEditsLocationPrompt")) \
     /* optionVar to control if comfirmation dialog will be show when overriding file */ \
@@ -67,6 +73,10 @@ PXR_NAMESPACE_OPEN_SCOPE
     /* optionVar to turn on or off async texture loading            */ \
     /* Notice that only newly opened USD stage would be affected.   */ \
     ((DisableAsyncTextureLoading, "mayaUsd_DisableAsyncTextureLoading")) \
+    /* optionVar to limit the resolution of textures in the viewport. */ \
+    /* Textures larger than this are read from a smaller mip level or */ \
+    /* downsampled. 0 means no limit.                                 */ \
+    ((MaxTextureResolution, "mayaUsd_MaxTextureResolution")) \
     /* option var to remember if the stage in the layer editor is pinned. */ \
     ((PinLayerEditorStage, "mayaUsd_PinLayerEditorStage")) \
     /* option var to remember if use display color when texture mode off */ \
@@ -242,6 +242,18 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kStaticSingleSample,
         UsdMayaJobExportArgsTokens->staticSingleSample.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kParallelFrameExportFlag,
+        UsdMayaJobExportArgsTokens->parallelFrameExport.GetText(),
+        MSyntax::kBoolean);
+    syntax.addFlag(
+        kContextEvaluationFlag,
+        UsdMayaJobExportArgsTokens->contextEvaluation.GetText(),
+        MSyntax::kBoolean);
+    syntax.addFlag(
+        kStreamingFrameWindowFlag,
+        UsdMayaJobExportArgsTokens->streamingFrameWindow.GetText(),
+        MSyntax::kLong);
     syntax.addFlag(
         kGeomSidednessFlag, UsdMayaJobExportArgsTokens->geomSidedness.GetText(), MSyntax::kString);
 
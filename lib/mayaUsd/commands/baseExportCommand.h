@@ -96,6 +96,9 @@ public:
     static constexpr auto kPythonPostCallbackFlag = "ppc";
     static constexpr auto kVerboseFlag = "v";
     static constexpr auto kStaticSingleSample = "sss";
+    static constexpr auto kParallelFrameExportFlag = "pfe";
+    static constexpr auto kContextEvaluationFlag = "cev";
+    static constexpr auto kStreamingFrameWindowFlag = "sfw";
     static constexpr auto kGeomSidednessFlag = "gs";
     static constexpr auto kApiSchemaFlag = "api";
     static constexpr auto kJobContextFlag = "jc";
@@ -54,6 +54,7 @@
 
 #include <ghc/filesystem.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <mutex>
 #include <ostream>
@@ -828,6 +829,11 @@ UsdMayaJobExportArgs::UsdMayaJobExportArgs(
           extractTokenSet(userArgs, UsdMayaJobExportArgsTokens->convertMaterialsTo))
     , verbose(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->verbose))
     , staticSingleSample(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->staticSingleSample))
+    , parallelFrameExport(
+          extractBoolean(userArgs, UsdMayaJobExportArgsTokens->parallelFrameExport))
+    , contextEvaluation(extractBoolean(userArgs, UsdMayaJobExportArgsTokens->contextEvaluation))
+    , streamingFrameWindow(static_cast<unsigned int>(
+          std::max(0, extractInt(userArgs, UsdMayaJobExportArgsTokens->streamingFrameWindow, 0))))
     , geomSidedness(extractToken(
           userArgs,
           UsdMayaJobExportArgsTokens->geomSidedness,
@@ -938,6 +944,9 @@ std::ostream& operator<<(std::ostream& out, const UsdMayaJobExportArgs& exportAr
         << "hideSourceData: " << TfStringify(exportArgs.hideSourceData) << std::endl
         << "timeSamples: " << exportArgs.timeSamples.size() << " sample(s)" << std::endl
         << "staticSingleSample: " << TfStringify(exportArgs.staticSingleSample) << std::endl
+        << "parallelFrameExport: " << TfStringify(exportArgs.parallelFrameExport) << std::endl
+        << "contextEvaluation: " << TfStringify(exportArgs.contextEvaluation) << std::endl
+        << "streamingFrameWindow: " << exportArgs.streamingFrameWindow << std::endl
         << "geomSidedness: " << TfStringify(exportArgs.geomSidedness) << std::endl
         << "usdModelRootOverridePath: " << exportArgs.usdModelRootOverridePath << std::endl;
 
@@ -1231,6 +1240,9 @@ const VtDictionary& UsdMayaJobExportArgs::GetDefaultDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = false;
         d[UsdMayaJobExportArgsTokens->verbose] = false;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = false;
+        d[UsdMayaJobExportArgsTokens->parallelFrameExport] = false;
+        d[UsdMayaJobExportArgsTokens->contextEvaluation] = false;
+        d[UsdMayaJobExportArgsTokens->streamingFrameWindow] = 0;
         d[UsdMayaJobExportArgsTokens->geomSidedness]
             = UsdMayaJobExportArgsTokens->derived.GetString();
         d[UsdMayaJobExportArgsTokens->customLayerData] = std::vector<VtValue>();
@@ -1260,6 +1272,7 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         // Common types:
         const auto _boolean = VtValue(false);
         const auto _double = VtValue(0.0);
+        const auto _int = VtValue(0);
         const auto _string = VtValue(std::string());
         const auto _doubleVector = VtValue(std::vector<double>());
         const auto _stringVector = VtValue(std::vector<VtValue>({ _string }));
@@ -1339,6 +1352,9 @@ const VtDictionary& UsdMayaJobExportArgs::GetGuideDictionary()
         d[UsdMayaJobExportArgsTokens->worldspace] = _boolean;
         d[UsdMayaJobExportArgsTokens->verbose] = _boolean;
         d[UsdMayaJobExportArgsTokens->staticSingleSample] = _boolean;
+        d[UsdMayaJobExportArgsTokens->parallelFrameExport] = _boolean;
+        d[UsdMayaJobExportArgsTokens->contextEvaluation] = _boolean;
+        d[UsdMayaJobExportArgsTokens->streamingFrameWindow] = _int;
         d[UsdMayaJobExportArgsTokens->geomSidedness] = _string;
         d[UsdMayaJobExportArgsTokens->excludeExportTypes] = _stringVector;
         d[UsdMayaJobExportArgsTokens->defaultPrim] = _string;
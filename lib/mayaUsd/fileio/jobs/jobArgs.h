@@ -119,12 +119,15 @@ TF_DECLARE_PUBLIC_TOKENS(
     (renderableOnly) \
     (renderLayerMode) \
     (shadingMode) \
+    (contextEvaluation) \
     (convertMaterialsTo) \
     (remapUVSetsTo) \
     (stripNamespaces) \
     (hideSourceData) \
     (verbose) \
     (staticSingleSample) \
+    (streamingFrameWindow) \
+    (parallelFrameExport) \
     (geomSidedness)   \
     (worldspace) \
     (writeDefaults) \
@@ -310,6 +313,13 @@ struct UsdMayaJobExportArgs
     const TfToken::Set allMaterialConversions;
     const bool         verbose;
     const bool         staticSingleSample;
+    // Stage the per-frame data of thread-safe prim writers on worker threads.
+    const bool         parallelFrameExport;
+    // Evaluate the time samples in a DG context instead of changing the current time.
+    const bool         contextEvaluation;
+    // Number of frames after which the time samples are moved to a value clip file, 0 to keep
+    // them in memory until the export completes. The output file is saved again at each flush.
+    const unsigned int streamingFrameWindow;
     const TfToken      geomSidedness;
     const TfToken::Set includeAPINames;
     const TfToken::Set jobContextNames;
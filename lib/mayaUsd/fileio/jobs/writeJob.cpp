@@ -24,10 +24,15 @@
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/schema.h>
 
 #include <maya/MAnimControl.h>
 #include <maya/MComputation.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MDistance.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnRenderLayer.h>
@@ -37,10 +42,15 @@
 #include <maya/MStatus.h>
 #include <maya/MUuid.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
 #include <set>
 
 // Needed for directly removing a UsdVariant via Sdf
@@ -60,6 +70,7 @@
 #include <mayaUsd/utils/util.h>
 
 #include <pxr/usd/sdf/variantSetSpec.h>
+#include <pxr/usd/usd/clipsAPI.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/primRange.h>
@@ -111,6 +122,12 @@ static std::string _MakeTmpStageName(const std::string& dir)
     return TfStringCatPaths(dir, fileName);
 }
 
+/// Returns the name of a file written next to the output layer, named after it.
+static std::string _MakeSiblingFileName(const std::string& layerFileName, const std::string& suffix)
+{
+    return TfStringGetBeforeSuffix(TfGetBaseName(layerFileName)) + suffix;
+}
+
 /// Chooses the fallback extension based on the compatibility profile, e.g.
 /// ARKit-compatible files should be usdz's by default.
 static TfToken _GetFallbackExtension(const TfToken& compatibilityMode)
@@ -456,14 +473,40 @@ bool UsdMaya_WriteJobImpl::WriteJobs(const std::vector<UsdMaya_WriteJob*>& jobs)
     if (!timeSamples.empty()) {
         const MTime oldCurTime = MAnimControl::currentTime();
 
+        // In context evaluation, the current time is left untouched: only the plugs pulled by
+        // the writers are evaluated at the sample time, and the viewport is not refreshed.
+        // Any writer reading its data at the current time would write wrong samples, so the
+        // export changes the current time as usual unless every job supports it.
+        const bool contextEvaluationRequested
+            = std::any_of(jobs.cbegin(), jobs.cend(), [](const UsdMaya_WriteJob* job) {
+                  return job->mJobCtx.GetArgs().contextEvaluation;
+              });
+        const bool contextEvaluation = contextEvaluationRequested
+            && std::all_of(jobs.cbegin(), jobs.cend(), [](const UsdMaya_WriteJob* job) {
+                   return job->mJobCtx.GetArgs().contextEvaluation
+                       && job->_SupportsContextEvaluation();
+               });
+        if (contextEvaluationRequested && !contextEvaluation) {
+            TF_WARN("Context evaluation is not supported by all the exported prims, "
+                    "the time samples are exported by changing the current time.");
+        }
+
         for (double t : timeSamples) {
-            MGlobal::viewFrame(t);
+            const MDGContext                 sampleContext(MTime(t, MTime::uiUnit()));
+            std::unique_ptr<MDGContextGuard> contextGuard;
+            if (contextEvaluation) {
+                contextGuard = std::make_unique<MDGContextGuard>(sampleContext);
+            } else {
+                MGlobal::viewFrame(t);
+            }
             progressBar.advance();
 
             // Process per frame data.
             for (auto itr = jobFramesWriters.begin(); itr != jobFramesWriters.end(); /**/) {
                 if (!itr->WriteFrameIfNeeded(t)) {
-                    MGlobal::viewFrame(oldCurTime);
+                    if (!contextEvaluation) {
+                        MGlobal::viewFrame(oldCurTime);
+                    }
                     return false;
                 }
                 itr = itr->Finished() ? jobFramesWriters.erase(itr) : std::next(itr);
@@ -476,7 +519,9 @@ bool UsdMaya_WriteJobImpl::WriteJobs(const std::vector<UsdMaya_WriteJob*>& jobs)
         }
 
         // Set the time back.
-        MGlobal::viewFrame(oldCurTime);
+        if (!contextEvaluation) {
+            MGlobal::viewFrame(oldCurTime);
+        }
     }
 
     // Finalize the exports.
@@ -669,6 +714,32 @@ bool UsdMaya_WriteJob::_BeginWriting()
         mJobCtx.mStage->SetEndTimeCode(mJobCtx.mArgs.timeSamples.back());
         mJobCtx.mStage->SetTimeCodesPerSecond(UsdMayaUtil::GetSceneMTimeUnitAsDouble());
         mJobCtx.mStage->SetFramesPerSecond(UsdMayaUtil::GetSceneMTimeUnitAsDouble());
+
+        // Each window of frames is moved to its own value clip layer, which is saved and released,
+        // so only the time samples of the current window are held in memory. The output layer
+        // keeps the scene description and the clip metadata, stitched by a manifest.
+        if (mJobCtx.mArgs.streamingFrameWindow > 0) {
+            if (_appendToFile || !_packageName.empty() || mJobCtx.mArgs.staticSingleSample) {
+                TF_WARN(
+                    "Streaming export is not supported when appending, packaging or converting "
+                    "single samples to static values, the time samples of '%s' are kept in "
+                    "memory until the export completes.",
+                    _realFilename.c_str());
+            } else {
+                const std::string manifestFileName = TfStringCatPaths(
+                    TfGetPathName(_realFilename),
+                    _MakeSiblingFileName(_realFilename, ".manifest.usda"));
+                _clipManifest = SdfLayer::CreateNew(manifestFileName);
+                if (_clipManifest) {
+                    _streamingFrameWindow = mJobCtx.mArgs.streamingFrameWindow;
+                } else {
+                    TF_WARN(
+                        "Could not create the value clip manifest '%s', the time samples are "
+                        "kept in memory until the export completes.",
+                        manifestFileName.c_str());
+                }
+            }
+        }
     }
 
     // Author USD units and up axis if requested.
@@ -859,9 +930,23 @@ bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
 {
     const UsdTimeCode usdTime(iFrame);
 
-    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
-        const UsdPrim& usdPrim = primWriter->GetUsdPrim();
-        if (usdPrim) {
+    const UsdMayaJobExportArgs& args = mJobCtx.GetArgs();
+    if (args.parallelFrameExport) {
+        _WriteFrameInParallel(usdTime);
+    } else {
+        for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+            const UsdPrim& usdPrim = primWriter->GetUsdPrim();
+            if (!usdPrim) {
+                continue;
+            }
+
+            // Staged writers pull their frame data through plugs, which also makes them honor
+            // the evaluation context. Without parallel export, each one is staged right before
+            // it is written, on the main thread.
+            if (args.contextEvaluation && primWriter->SupportsParallelWrite()) {
+                primWriter->FetchFrameData(usdTime);
+                primWriter->StageFrameData(usdTime);
+            }
             primWriter->Write(usdTime);
         }
     }
@@ -874,13 +959,183 @@ bool UsdMaya_WriteJob::_WriteFrame(double iFrame)
 
     _PerFrameCallback(iFrame);
 
+    if (_streamingFrameWindow > 0) {
+        if (_framesSinceFlush == 0) {
+            _windowStartTime = iFrame;
+        }
+        _lastFrameTime = iFrame;
+        if (++_framesSinceFlush >= _streamingFrameWindow) {
+            _FlushTimeSamples();
+        }
+    }
+
+    return true;
+}
+
+bool UsdMaya_WriteJob::_SupportsContextEvaluation() const
+{
+    if (!mChasers.empty() || !mJobCtx.mArgs.melPerFrameCallback.empty()
+        || !mJobCtx.mArgs.pythonPerFrameCallback.empty()) {
+        return false;
+    }
+
+    for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+        if (primWriter->GetUsdPrim() && !primWriter->SupportsContextEvaluation()) {
+            return false;
+        }
+    }
     return true;
 }
 
+void UsdMaya_WriteJob::_FlushTimeSamples()
+{
+    if (_framesSinceFlush == 0) {
+        return;
+    }
+    _framesSinceFlush = 0;
+
+    const SdfLayerHandle rootLayer = mJobCtx.mStage->GetRootLayer();
+
+    // Samples authored in variants stay in the output layer: clips cannot target them.
+    SdfPathVector sampledPaths;
+    rootLayer->Traverse(
+        SdfPath::AbsoluteRootPath(), [&rootLayer, &sampledPaths](const SdfPath& path) {
+            if (path.IsPrimPropertyPath() && !path.ContainsPrimVariantSelection()
+                && rootLayer->HasField(path, SdfFieldKeys->TimeSamples)) {
+                sampledPaths.push_back(path);
+            }
+        });
+    if (sampledPaths.empty()) {
+        return;
+    }
+
+    const std::string clipFileName = _MakeSiblingFileName(
+        _realFilename, TfStringPrintf(".clip%04zu.usdc", _clipAssetPaths.size()));
+    SdfLayerRefPtr clipLayer
+        = SdfLayer::CreateNew(TfStringCatPaths(TfGetPathName(_realFilename), clipFileName));
+    if (!clipLayer) {
+        TF_WARN(
+            "Could not create the value clip '%s', the time samples are kept in memory.",
+            clipFileName.c_str());
+        return;
+    }
+
+    TF_STATUS("Flushing time samples to '%s'", clipLayer->GetIdentifier().c_str());
+    {
+        SdfChangeBlock changeBlock;
+        for (const SdfPath& path : sampledPaths) {
+            const SdfAttributeSpecHandle attrSpec = rootLayer->GetAttributeAtPath(path);
+            if (!attrSpec) {
+                continue;
+            }
+
+            const SdfValueTypeName typeName = attrSpec->GetTypeName();
+            const SdfVariability   variability = attrSpec->GetVariability();
+            const bool             isCustom = attrSpec->IsCustom();
+            if (!_clipManifest->GetAttributeAtPath(path)) {
+                SdfJustCreatePrimAttributeInLayer(
+                    _clipManifest, path, typeName, variability, isCustom);
+            }
+            SdfJustCreatePrimAttributeInLayer(clipLayer, path, typeName, variability, isCustom);
+
+            const VtValue timeSamples = rootLayer->GetField(path, SdfFieldKeys->TimeSamples);
+            clipLayer->SetField(path, SdfFieldKeys->TimeSamples, timeSamples);
+            rootLayer->EraseField(path, SdfFieldKeys->TimeSamples);
+
+            _clipAnchorPaths.insert(path.GetPrefixes().front());
+        }
+    }
+
+    clipLayer->Save();
+    _clipManifest->Save();
+
+    _clipActive.push_back(
+        GfVec2d(_windowStartTime, static_cast<double>(_clipAssetPaths.size())));
+    _clipAssetPaths.push_back(SdfAssetPath("./" + clipFileName));
+    _AuthorValueClips();
+}
+
+void UsdMaya_WriteJob::_AuthorValueClips()
+{
+    // The clips hold the samples at their stage time.
+    VtArray<GfVec2d> clipTimes;
+    clipTimes.push_back(GfVec2d(_clipActive.front()[0]));
+    clipTimes.push_back(GfVec2d(_lastFrameTime));
+
+    const SdfAssetPath manifestAssetPath(
+        "./" + _MakeSiblingFileName(_realFilename, ".manifest.usda"));
+
+    SdfChangeBlock changeBlock;
+    for (const SdfPath& anchorPath : _clipAnchorPaths) {
+        UsdClipsAPI clipsAPI(mJobCtx.mStage->GetPrimAtPath(anchorPath));
+        if (!clipsAPI) {
+            continue;
+        }
+
+        clipsAPI.SetClipPrimPath(anchorPath.GetString());
+        clipsAPI.SetClipAssetPaths(_clipAssetPaths);
+        clipsAPI.SetClipActive(_clipActive);
+        clipsAPI.SetClipTimes(clipTimes);
+        clipsAPI.SetClipManifestAssetPath(manifestAssetPath);
+    }
+}
+
+void UsdMaya_WriteJob::_WriteFrameInParallel(const UsdTimeCode& usdTime)
+{
+    if (!_primWritersSplit) {
+        for (const UsdMayaPrimWriterSharedPtr& primWriter : mJobCtx.mMayaPrimWriterList) {
+            if (!primWriter->GetUsdPrim()) {
+                continue;
+            }
+            if (primWriter->SupportsParallelWrite()) {
+                _parallelPrimWriters.push_back(primWriter.get());
+            } else {
+                _serialPrimWriters.push_back(primWriter.get());
+            }
+        }
+        _primWritersSplit = true;
+    }
+
+    for (UsdMayaPrimWriter* primWriter : _serialPrimWriters) {
+        primWriter->Write(usdTime);
+    }
+
+    if (_parallelPrimWriters.empty()) {
+        return;
+    }
+
+    // Maya evaluation is not thread-safe: everything the writers need from the
+    // scene is retrieved on the main thread before staging.
+    for (UsdMayaPrimWriter* primWriter : _parallelPrimWriters) {
+        primWriter->FetchFrameData(usdTime);
+    }
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, _parallelPrimWriters.size()),
+        [this, &usdTime](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                _parallelPrimWriters[i]->StageFrameData(usdTime);
+            }
+        });
+
+    // Authoring is serial and in writer order, but change processing is only
+    // done once for the whole frame.
+    SdfChangeBlock changeBlock;
+    for (UsdMayaPrimWriter* primWriter : _parallelPrimWriters) {
+        primWriter->Write(usdTime);
+    }
+}
+
 bool UsdMaya_WriteJob::_PostExport()
 {
     MayaUsd::ProgressBarScope progressBar(5);
 
+    // Move the last window of frames to its clip, so that the output layer only keeps the time
+    // samples authored after the frames.
+    if (_streamingFrameWindow > 0) {
+        _FlushTimeSamples();
+    }
+
     UsdPrimSiblingRange usdRootPrims = mJobCtx.mStage->GetPseudoRoot().GetChildren();
 
     // Write Variants (to first root prim path)
@@ -21,14 +21,21 @@
 #include <mayaUsd/fileio/writeJobContext.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/gf/vec2d.h>
 #include <pxr/base/tf/hashmap.h>
+#include <pxr/base/vt/array.h>
 #include <pxr/pxr.h>
+#include <pxr/usd/sdf/assetPath.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
 
 #include <maya/MObjectHandle.h>
 
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -82,6 +89,24 @@ private:
     /// WriteFrame() call, internal code may generate errors.
     bool _WriteFrame(double iFrame);
 
+    /// Writes the prim writers at the given frame, staging the data of the
+    /// writers that support it on worker threads.
+    void _WriteFrameInParallel(const UsdTimeCode& usdTime);
+
+    /// Whether the frames can be written while the Maya scene is evaluated in
+    /// a DG context: all the prim writers must support it, and there must be
+    /// no chaser or per-frame callback, since they read the current time.
+    bool _SupportsContextEvaluation() const;
+
+    /// Moves the time samples written since the last flush from the output
+    /// layer to a new value clip layer, which is saved and released, so that
+    /// they are no longer held in memory.
+    void _FlushTimeSamples();
+
+    /// Points the clip metadata of the root prims at the value clips and at
+    /// the manifest written so far.
+    void _AuthorValueClips();
+
     /// Runs any post-export processes.
     bool _PostExport();
 
@@ -134,6 +159,26 @@ private:
 
     UsdMayaWriteJobContext mJobCtx;
 
+    // Prim writers split by their support of parallel frame export, gathered
+    // on the first frame exported in parallel.
+    std::vector<UsdMayaPrimWriter*> _serialPrimWriters;
+    std::vector<UsdMayaPrimWriter*> _parallelPrimWriters;
+    bool                            _primWritersSplit = false;
+
+    // Number of frames written between two flushes of the time samples, 0 when
+    // the samples are kept in memory until the export completes.
+    unsigned int _streamingFrameWindow = 0;
+    unsigned int _framesSinceFlush = 0;
+    double       _windowStartTime = 0.0;
+    double       _lastFrameTime = 0.0;
+
+    // Value clips holding the flushed time samples, one per window of frames,
+    // and the manifest declaring the attributes they hold.
+    VtArray<SdfAssetPath> _clipAssetPaths;
+    VtArray<GfVec2d>      _clipActive;
+    SdfLayerRefPtr        _clipManifest;
+    std::set<SdfPath>     _clipAnchorPaths;
+
     std::unique_ptr<UsdMaya_ModelKindProcessor> _modelKindProcessor;
 };
 
@@ -25,6 +25,7 @@
 #include <mayaUsd/fileio/orphanedNodesManager.h>
 #endif
 #include <mayaUsd/fileio/primUpdaterRegistry.h>
+#include <mayaUsd/fileio/pullEditTracker.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/nodes/layerManager.h>
 #include <mayaUsd/nodes/proxyShapeBase.h>
@@ -43,6 +44,8 @@
 
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/instantiateSingleton.h>
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primRange.h>
@@ -1002,6 +1005,42 @@ private:
 };
 #endif
 
+//------------------------------------------------------------------------------
+//
+// Shows the current phase of a merge to USD in the progress bar status, along with
+// the time spent in the previous phase.
+class MergePhaseReporter
+{
+public:
+    MergePhaseReporter(MayaUsd::ProgressBarScope& progressBar, const std::string& title)
+        : _progressBar(progressBar)
+        , _title(title)
+    {
+    }
+
+    void setTitle(const std::string& title) { _title = title; }
+
+    void begin(const std::string& phase)
+    {
+        _watch.Stop();
+        std::string status = TfStringPrintf("%s: %s", _title.c_str(), phase.c_str());
+        if (!_phase.empty()) {
+            status += TfStringPrintf(" (%s: %.3f s)", _phase.c_str(), _watch.GetSeconds());
+        }
+        _progressBar.setProgressString(MString(status.c_str()));
+
+        _phase = phase;
+        _watch.Reset();
+        _watch.Start();
+    }
+
+private:
+    MayaUsd::ProgressBarScope& _progressBar;
+    std::string                _title;
+    std::string                _phase;
+    TfStopwatch                _watch;
+};
+
 void executeAdditionalCommands(const UsdMayaPrimUpdaterContext& context)
 {
     std::shared_ptr<Ufe::CompositeUndoableCommand> cmds = context.GetAdditionalFinalCommands();
@@ -1154,6 +1193,9 @@ PrimUpdaterManager::mergeToUsd(const std::vector<PushToUsdArgs>& mergeArgsVect)
 {
     MayaUsd::ProgressBarScope progressBar((7 * mergeArgsVect.size()) + 3, "Merging to USD");
     PushPullScope             scopeIt(_inPushPull);
+    MergePhaseReporter        phases(progressBar, "Merging to USD");
+
+    phases.begin("validating");
 
     // Verify and collect pulled paths for each dag path edited as Maya. Also validate userArgs
     // dictionaries for PrimUpdaterContext use. And finally get ready to delete pulled maya
@@ -1177,7 +1219,7 @@ PrimUpdaterManager::mergeToUsd(const std::vector<PushToUsdArgs>& mergeArgsVect)
 
         if (VtDictionaryIsHolding<std::string>(
                 mergeArgs.userArgs, MayaUsdEditRoutingTokens->DestinationPrimName)) {
-            progressBar.setProgressString("Caching to USD");
+            phases.setTitle("Caching to USD");
         }
 
         const auto mayaPath = usdToMaya(pulledPath);
@@ -1242,8 +1284,16 @@ PrimUpdaterManager::mergeToUsd(const std::vector<PushToUsdArgs>& mergeArgsVect)
     // 2) Traverse each layer and call the prim updater for each prim, for
     //    per-prim customization.
 
-    // 1) Perform all the exports to temporary layers.
-    const auto pushExportResults = pushExport(mergeArgsVect);
+    // 1) Perform all the exports to temporary layers. Only the Maya nodes edited since they
+    //    were pulled are exported, when they are known.
+    std::vector<PushToUsdArgs> pushArgsVect;
+    pushArgsVect.reserve(mergeArgsVect.size());
+    for (const auto& mergeArgs : mergeArgsVect) {
+        pushArgsVect.push_back(endEditTracking(mergeArgs));
+    }
+
+    phases.begin("exporting");
+    const auto pushExportResults = pushExport(pushArgsVect);
     if (pushExportResults.size() != mergeArgsVect.size()) {
         TF_WARN("Cannot mergeToUsd, failed to export to %zu USD prim(s).", mergeArgsVect.size());
         return {};
@@ -1306,6 +1356,7 @@ PrimUpdaterManager::mergeToUsd(const std::vector<PushToUsdArgs>& mergeArgsVect)
         }
         progressBar.advance();
 
+        phases.begin("merging");
         if (!pushCustomize(pulledPath, pushExportResult, context)) {
             return {};
         }
@@ -1333,6 +1384,7 @@ PrimUpdaterManager::mergeToUsd(const std::vector<PushToUsdArgs>& mergeArgsVect)
         progressBar.advance();
 
         // Discard all pulled Maya nodes.
+        phases.begin("cleaning up");
         std::vector<MDagPath> toApplyOn
             = UsdMayaUtil::getDescendantsStartingWithChildren(mayaDagPath);
 
@@ -1472,11 +1524,74 @@ bool PrimUpdaterManager::editAsMaya(const Ufe::Path& path, const VtDictionary& u
 
     scopeIt.end();
     executeAdditionalCommands(context);
+
+    if (!updaterArgs._copyOperation) {
+        FunctionUndoItem::execute(
+            "Edit as Maya edit tracking",
+            [this, path]() {
+                beginEditTracking(path);
+                return true;
+            },
+            [this, path]() {
+                _editTrackers.erase(path);
+                return true;
+            });
+    }
     progressBar.advance();
 
     return true;
 }
 
+void PrimUpdaterManager::beginEditTracking(const Ufe::Path& pulledPath)
+{
+    const MDagPath pulledDagPath = MayaUsd::ufe::ufeToDagPath(usdToMaya(pulledPath));
+    if (!pulledDagPath.isValid()) {
+        return;
+    }
+
+    _editTrackers[pulledPath] = std::make_unique<MayaUsd::PullEditTracker>(pulledDagPath);
+}
+
+PushToUsdArgs PrimUpdaterManager::endEditTracking(const PushToUsdArgs& mergeArgs)
+{
+    auto found = _editTrackers.find(mergeArgs.dstUfePath);
+    if (found == _editTrackers.end()) {
+        return mergeArgs;
+    }
+
+    // Stop tracking before the merge itself modifies the Maya nodes.
+    std::unique_ptr<MayaUsd::PullEditTracker> tracker = std::move(found->second);
+    _editTrackers.erase(found);
+
+    // An explicit node list, a copy or a cache to USD export what they were asked to.
+    if (mergeArgs.updaterArgs._copyOperation || !mergeArgs.updaterArgs._pushNodeList.empty()
+        || VtDictionaryIsHolding<std::string>(
+            mergeArgs.userArgs, MayaUsdEditRoutingTokens->DestinationPrimName)) {
+        return mergeArgs;
+    }
+
+    const MDagPath pulledDagPath = MayaUsd::ufe::ufeToDagPath(usdToMaya(mergeArgs.dstUfePath));
+    std::vector<MDagPath> editedPaths;
+    if (!tracker->isTracking(pulledDagPath) || !tracker->getEditedDagPaths(editedPaths)) {
+        return mergeArgs;
+    }
+
+    // The merge preserves the USD data of the nodes left out of the export. Neither them
+    // nor their USD data were edited since the pull, so that data matches their export.
+    std::vector<VtValue> pushNodeList;
+    pushNodeList.reserve(editedPaths.size());
+    for (const MDagPath& editedPath : editedPaths) {
+        const MString pathName = editedPath.fullPathName();
+        pushNodeList.emplace_back(std::string(pathName.asChar(), pathName.length()));
+    }
+
+    VtDictionary userArgs = mergeArgs.userArgs;
+    userArgs[UsdMayaPrimUpdaterArgsTokens->pushNodeList] = pushNodeList;
+
+    PushToUsdArgs editedArgs = PushToUsdArgs::forMerge(pulledDagPath, userArgs);
+    return editedArgs ? editedArgs : mergeArgs;
+}
+
 bool PrimUpdaterManager::canEditAsMaya(const Ufe::Path& path) const
 {
     // Verify if the prim is an ancestor of an edited prim.
@@ -1541,6 +1656,8 @@ bool PrimUpdaterManager::discardPrimEdits(const Ufe::Path& pulledPath)
     MayaUsd::ProgressBarScope progressBar(6);
     PushPullScope             scopeIt(_inPushPull);
 
+    _editTrackers.erase(pulledPath);
+
     // Record all USD modifications in an undo block and item.
     UsdUfe::UsdUndoBlock undoBlock(
         &UsdUndoableItemUndoItem::create("Discard edits USD data modifications"));
@@ -1651,6 +1768,8 @@ bool PrimUpdaterManager::discardOrphanedEdits(const MDagPath& dagPath, const Ufe
     MayaUsd::ProgressBarScope progressBar(3);
     PushPullScope             scopeIt(_inPushPull);
 
+    _editTrackers.erase(pulledPath);
+
     // Unlock the pulled hierarchy, clear the pull information, and remove the
     // pull parent, which is simply the parent of the pulled path.
     auto pullParent = dagPath;
@@ -1955,6 +2074,29 @@ void PrimUpdaterManager::onProxyContentChanged(
 
     auto proxyShapeUfePath = proxyNotice.GetProxyShape().ufePath();
 
+    const UsdNotice::ObjectsChanged& notice = proxyNotice.GetNotice();
+
+    // Merging only the edited Maya nodes would keep the USD edits made to the other pulled
+    // prims, while merging the whole hierarchy replaces them with the Maya data. Merge the
+    // whole hierarchy once the pulled prims were edited in USD, so both agree.
+    for (auto& pulledPathAndTracker : _editTrackers) {
+        const Ufe::Path& pulledPath = pulledPathAndTracker.first;
+        if (pulledPath.nbSegments() != 2 || !pulledPath.startsWith(proxyShapeUfePath))
+            continue;
+
+        const SdfPath pulledPrimPath(pulledPath.getSegments()[1].string());
+        bool          usdEdited = false;
+        for (const auto& changedPath : notice.GetResyncedPaths()) {
+            usdEdited |= changedPath.HasPrefix(pulledPrimPath)
+                || pulledPrimPath.HasPrefix(changedPath.GetPrimPath());
+        }
+        for (const auto& changedPath : notice.GetChangedInfoOnlyPaths()) {
+            usdEdited |= changedPath.HasPrefix(pulledPrimPath);
+        }
+        if (usdEdited)
+            pulledPathAndTracker.second->markUsdEdited();
+    }
+
     auto autoEditFn = [this, proxyShapeUfePath](
                           const UsdMayaPrimUpdaterContext& context, const UsdPrim& prim) -> bool {
         TfToken typeName = prim.GetTypeName();
@@ -1983,8 +2125,6 @@ void PrimUpdaterManager::onProxyContentChanged(
         return false;
     };
 
-    const UsdNotice::ObjectsChanged& notice = proxyNotice.GetNotice();
-
     Usd_PrimFlagsPredicate predicate = UsdPrimDefaultPredicate;
 
     auto stage = notice.GetStage();
@@ -2234,6 +2374,7 @@ void PrimUpdaterManager::beforeNewOrOpenCallback(void* clientData)
 {
     auto* pum = static_cast<PrimUpdaterManager*>(clientData);
     pum->endManagePulledPrims();
+    pum->_editTrackers.clear();
 }
 
 void PrimUpdaterManager::beginLoadSaveCallbacks()
@@ -29,13 +29,17 @@
 
 #include <maya/MCallbackIdArray.h>
 
+#include <memory>
+#include <unordered_map>
+
 UFE_NS_DEF { class Path; }
 
-#ifdef HAS_ORPHANED_NODES_MANAGER
 namespace MAYAUSD_NS_DEF {
+class PullEditTracker;
+#ifdef HAS_ORPHANED_NODES_MANAGER
 class OrphanedNodesManager;
-}
 #endif
+} // namespace MAYAUSD_NS_DEF
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -159,6 +163,14 @@ private:
     //! Verify if the given prim at the given UFE path is an ancestor of an already edited prim.
     bool hasEditedDescendant(const Ufe::Path& ufeQueryPath) const;
 
+    //! Start recording the edits made to the Maya nodes pulled from the given path.
+    void beginEditTracking(const Ufe::Path& pulledPath);
+
+    //! Stop recording the edits made to the Maya nodes pulled from the given path, and
+    //! return the merge arguments restricted to the edited nodes, if they are known.
+    //! Otherwise, the merge arguments are returned as-is, to merge the whole hierarchy.
+    PushToUsdArgs endEditTracking(const PushToUsdArgs& mergeArgs);
+
 //! Record pull information for the pulled path, for inspection on
 //! scene changes.
 #ifdef HAS_ORPHANED_NODES_MANAGER
@@ -183,6 +195,10 @@ private:
 
     bool _inPushPull { false };
 
+    // Edits made to the pulled Maya nodes since they were pulled, used to only export the
+    // edited nodes when merging them back to USD.
+    std::unordered_map<Ufe::Path, std::unique_ptr<MayaUsd::PullEditTracker>> _editTrackers;
+
     // Orphaned nodes manager that observes the scene, to determine when to hide
     // pulled prims that have become orphaned, or to show them again, because
     // of structural changes to their USD or Maya ancestors.
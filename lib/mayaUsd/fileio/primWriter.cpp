@@ -221,6 +221,18 @@ bool UsdMayaPrimWriter::ExportsGprims() const { return false; }
 /* virtual */
 bool UsdMayaPrimWriter::ShouldPruneChildren() const { return false; }
 
+/* virtual */
+bool UsdMayaPrimWriter::SupportsParallelWrite() const { return false; }
+
+/* virtual */
+bool UsdMayaPrimWriter::SupportsContextEvaluation() const { return false; }
+
+/* virtual */
+void UsdMayaPrimWriter::FetchFrameData(const UsdTimeCode&) { }
+
+/* virtual */
+void UsdMayaPrimWriter::StageFrameData(const UsdTimeCode&) { }
+
 /* virtual */
 void UsdMayaPrimWriter::PostExport() { MakeSingleSamplesStatic(); }
 
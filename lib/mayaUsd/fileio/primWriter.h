@@ -91,6 +91,51 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual void Write(const UsdTimeCode& usdTime);
 
+    /// Whether the animated frames of this prim writer can be exported in
+    /// parallel with the other prim writers.
+    ///
+    /// When the parallelFrameExport export argument is set, each animated
+    /// frame of the writers returning \c true is exported in three steps:
+    /// FetchFrameData() is called serially on the main thread, then
+    /// StageFrameData() is called concurrently on worker threads, and finally
+    /// Write() is called serially, in the usual writer order and within a
+    /// single SdfChangeBlock for the whole frame. The writers that do not
+    /// support parallel export are written before them. With only the
+    /// contextEvaluation export argument, the three steps are called one
+    /// writer at a time, on the main thread.
+    ///
+    /// Base implementation returns \c false.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool SupportsParallelWrite() const;
+
+    /// Retrieves, on the main thread, the Maya data needed to export the frame
+    /// at \p usdTime, once the scene has been evaluated at that frame. After
+    /// this call, StageFrameData() must not need to evaluate the Maya scene.
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void FetchFrameData(const UsdTimeCode& usdTime);
+
+    /// Converts the data retrieved by FetchFrameData() into the values to
+    /// author at \p usdTime, so that Write() only has to author them. This is
+    /// called concurrently for several prim writers: it must neither author
+    /// USD data nor use Maya API that could trigger an evaluation.
+    ///
+    /// Base implementation does nothing.
+    MAYAUSD_CORE_PUBLIC
+    virtual void StageFrameData(const UsdTimeCode& usdTime);
+
+    /// Whether the animated frames of this prim writer can be exported while
+    /// the Maya scene is evaluated in a DG context rather than at the current
+    /// time (see the contextEvaluation export argument). The writers returning
+    /// \c true must read all their time-varying Maya data through plugs or
+    /// through the data staged by FetchFrameData(). The export falls back to
+    /// changing the current time as soon as one writer returns \c false.
+    ///
+    /// Base implementation returns \c false.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool SupportsContextEvaluation() const;
+
     /// Post export function that runs before saving the stage.
     ///
     /// Base implementation handles optional optimization of data.
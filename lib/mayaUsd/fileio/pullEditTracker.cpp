@@ -0,0 +1,302 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "pullEditTracker.h"
+
+#include <maya/MDagPathArray.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MFnSet.h>
+#include <maya/MItDag.h>
+#include <maya/MItDependencyGraph.h>
+#include <maya/MMessage.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+#include <maya/MSelectionList.h>
+
+namespace {
+
+// Attribute messages that may change the exported USD data of a node. Evaluation and
+// dirty propagation messages are ignored: they follow from a change to an upstream node,
+// which is tracked.
+constexpr int kEditMessages = MNodeMessage::kConnectionMade | MNodeMessage::kConnectionBroken
+    | MNodeMessage::kAttributeSet | MNodeMessage::kAttributeArrayAdded
+    | MNodeMessage::kAttributeArrayRemoved | MNodeMessage::kAttributeRemoved
+    | MNodeMessage::kAttributeRenamed | MNodeMessage::kAttributeAdded;
+
+} // namespace
+
+namespace MAYAUSD_NS_DEF {
+
+PullEditTracker::PullEditTracker(const MDagPath& pulledRoot)
+    : _root(pulledRoot)
+    , _rootHandle(pulledRoot.node())
+{
+    MStatus status;
+    MItDag  dagIt(MItDag::kDepthFirst, MFn::kInvalid, &status);
+    if (!status || !dagIt.reset(pulledRoot)) {
+        _topologyChanged = true;
+        return;
+    }
+
+    // Track the pulled Dag nodes first, so that the upstream traversals stop at them.
+    std::vector<MObject> dagNodes;
+    for (; !dagIt.isDone(); dagIt.next()) {
+        MObject node = dagIt.currentItem();
+        if (_tracked.count(MObjectHandle(node)) > 0) {
+            // Instanced node, already tracked.
+            continue;
+        }
+        trackNode(node, true);
+        dagNodes.push_back(node);
+    }
+    _dagNodeCount = dagNodes.size();
+
+    for (const MObject& node : dagNodes) {
+        trackUpstream(node, false);
+
+        // The shading groups are downstream of the shapes: track them and their upstream
+        // shading networks, but not their other members.
+        MFnDependencyNode depFn(node);
+        MPlugArray        connectedPlugs;
+        depFn.getConnections(connectedPlugs);
+        for (unsigned int i = 0; i < connectedPlugs.length(); ++i) {
+            MPlugArray dstPlugs;
+            connectedPlugs[i].connectedTo(dstPlugs, false, true);
+            for (unsigned int j = 0; j < dstPlugs.length(); ++j) {
+                MObject dstNode = dstPlugs[j].node();
+                if (!dstNode.hasFn(MFn::kShadingEngine)
+                    || _tracked.count(MObjectHandle(dstNode)) > 0) {
+                    continue;
+                }
+                trackNode(dstNode, false);
+                trackUpstream(dstNode, true);
+            }
+        }
+    }
+
+    _callbacks.append(MDagMessage::addAllDagChangesCallback(dagChangedCB, this, &status));
+    CHECK_MSTATUS(status);
+}
+
+PullEditTracker::~PullEditTracker() { untrack(); }
+
+void PullEditTracker::untrack()
+{
+    if (_callbacks.length() == 0)
+        return;
+
+    MStatus status = MMessage::removeCallbacks(_callbacks);
+    CHECK_MSTATUS(status);
+    _callbacks.clear();
+}
+
+void PullEditTracker::trackNode(const MObject& node, bool isDagNode)
+{
+    MObject obj(node);
+    _tracked.insert(MObjectHandle(obj));
+
+    MStatus status;
+    _callbacks.append(
+        MNodeMessage::addAttributeChangedCallback(obj, attributeChangedCB, this, &status));
+    CHECK_MSTATUS(status);
+
+    // Renaming a pulled Dag node renames its USD prim.
+    if (isDagNode) {
+        _callbacks.append(MNodeMessage::addNameChangedCallback(obj, nameChangedCB, this, &status));
+        CHECK_MSTATUS(status);
+    }
+}
+
+void PullEditTracker::trackUpstream(const MObject& node, bool skipDagNodes)
+{
+    MObject            startNode(node);
+    MStatus            status;
+    MItDependencyGraph graphIt(
+        startNode,
+        MFn::kInvalid,
+        MItDependencyGraph::kUpstream,
+        MItDependencyGraph::kDepthFirst,
+        MItDependencyGraph::kNodeLevel,
+        &status);
+    if (!status)
+        return;
+
+    // The first item is the start node itself.
+    for (graphIt.next(); !graphIt.isDone(); graphIt.next()) {
+        MObject upstreamNode = graphIt.currentItem();
+
+        // The time node changes on every frame, without changing the exported data.
+        if (upstreamNode.hasFn(MFn::kTime) || _tracked.count(MObjectHandle(upstreamNode)) > 0) {
+            graphIt.prune();
+            continue;
+        }
+
+        if (upstreamNode.hasFn(MFn::kDagNode)) {
+            // Pulled Dag nodes are tracked from the constructor. A Dag node outside of the
+            // pulled hierarchy, such as a constraint target, is tracked without its upstream.
+            graphIt.prune();
+            if (skipDagNodes)
+                continue;
+        }
+
+        trackNode(upstreamNode, false);
+    }
+}
+
+bool PullEditTracker::isTracking(const MDagPath& pulledRoot) const
+{
+    return _rootHandle.isAlive() && _rootHandle.isValid()
+        && _rootHandle.object() == pulledRoot.node();
+}
+
+bool PullEditTracker::isUnderRoot(MDagPath dagPath) const
+{
+    const MObject root = _rootHandle.object();
+    while (dagPath.length() > 0) {
+        if (dagPath.node() == root)
+            return true;
+        dagPath.pop();
+    }
+    return false;
+}
+
+void PullEditTracker::addEditedDagPaths(
+    const MObject&         node,
+    HandleSet&             added,
+    std::vector<MDagPath>& paths) const
+{
+    if (!added.insert(MObjectHandle(node)).second)
+        return;
+
+    MDagPathArray nodePaths;
+    MDagPath::getAllPathsTo(node, nodePaths);
+    for (unsigned int i = 0; i < nodePaths.length(); ++i) {
+        if (isUnderRoot(nodePaths[i]))
+            paths.push_back(nodePaths[i]);
+    }
+}
+
+bool PullEditTracker::getEditedDagPaths(std::vector<MDagPath>& editedPaths) const
+{
+    if (_topologyChanged || _usdEdited || _edited.empty() || !_rootHandle.isAlive())
+        return false;
+
+    const MObject root = _rootHandle.object();
+
+    // Map the edited nodes to the pulled Dag nodes they affect: a pulled Dag node affects
+    // itself, other nodes affect the pulled Dag nodes downstream of them, directly or
+    // through a shading group.
+    HandleSet             added;
+    std::vector<MDagPath> paths;
+    for (const MObjectHandle& handle : _edited) {
+        if (!handle.isAlive() || !handle.isValid())
+            continue;
+
+        MObject node = handle.object();
+        if (node == root)
+            return false;
+
+        if (node.hasFn(MFn::kDagNode)) {
+            MDagPath dagPath;
+            if (MDagPath::getAPathTo(node, dagPath) && isUnderRoot(dagPath)) {
+                addEditedDagPaths(node, added, paths);
+                continue;
+            }
+        }
+
+        MStatus            status;
+        MItDependencyGraph graphIt(
+            node,
+            MFn::kInvalid,
+            MItDependencyGraph::kDownstream,
+            MItDependencyGraph::kBreadthFirst,
+            MItDependencyGraph::kNodeLevel,
+            &status);
+        if (!status)
+            continue;
+
+        for (graphIt.next(); !graphIt.isDone(); graphIt.next()) {
+            MObject downstreamNode = graphIt.currentItem();
+            if (downstreamNode.hasFn(MFn::kDagNode)) {
+                graphIt.prune();
+                if (_tracked.count(MObjectHandle(downstreamNode)) > 0)
+                    addEditedDagPaths(downstreamNode, added, paths);
+            } else if (downstreamNode.hasFn(MFn::kShadingEngine)) {
+                graphIt.prune();
+                MSelectionList members;
+                MFnSet(downstreamNode).getMembers(members, false);
+                for (unsigned int i = 0; i < members.length(); ++i) {
+                    MDagPath memberPath;
+                    MObject  components;
+                    if (members.getDagPath(i, memberPath, components)
+                        && isUnderRoot(memberPath)) {
+                        addEditedDagPaths(memberPath.node(), added, paths);
+                    }
+                }
+            }
+        }
+    }
+
+    // Nothing left to skip: export the whole hierarchy.
+    if (paths.empty() || added.size() >= _dagNodeCount)
+        return false;
+
+    for (const MDagPath& path : paths) {
+        if (path == _root || path.node() == root)
+            return false;
+    }
+
+    editedPaths = std::move(paths);
+    return true;
+}
+
+/* static */
+void PullEditTracker::attributeChangedCB(
+    MNodeMessage::AttributeMessage msg,
+    MPlug&                         plug,
+    MPlug&,
+    void* clientData)
+{
+    if ((msg & kEditMessages) == 0)
+        return;
+
+    auto* tracker = static_cast<PullEditTracker*>(clientData);
+    tracker->_edited.insert(MObjectHandle(plug.node()));
+}
+
+/* static */
+void PullEditTracker::nameChangedCB(MObject&, const MString&, void* clientData)
+{
+    static_cast<PullEditTracker*>(clientData)->_topologyChanged = true;
+}
+
+/* static */
+void PullEditTracker::dagChangedCB(
+    MDagMessage::DagMessage,
+    MDagPath& child,
+    MDagPath& parent,
+    void*     clientData)
+{
+    auto* tracker = static_cast<PullEditTracker*>(clientData);
+    if (tracker->_topologyChanged || !tracker->_rootHandle.isAlive())
+        return;
+
+    if ((parent.isValid() && tracker->isUnderRoot(parent))
+        || (child.isValid() && tracker->isUnderRoot(child))) {
+        tracker->_topologyChanged = true;
+    }
+}
+
+} // namespace MAYAUSD_NS_DEF
@@ -0,0 +1,113 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_PULLEDITTRACKER_H
+#define MAYAUSD_PULLEDITTRACKER_H
+
+#include <mayaUsd/base/api.h>
+
+#include <maya/MCallbackIdArray.h>
+#include <maya/MDagMessage.h>
+#include <maya/MDagPath.h>
+#include <maya/MNodeMessage.h>
+#include <maya/MObjectHandle.h>
+
+#include <unordered_set>
+#include <vector>
+
+namespace MAYAUSD_NS_DEF {
+
+/// \class PullEditTracker
+///
+/// \brief Records which Maya nodes of a hierarchy edited as Maya were modified since the pull.
+///
+/// The tracker observes the Dag nodes of the pulled hierarchy, as well as the nodes upstream of
+/// them and of their shading groups. A node is considered edited when one of its attributes is
+/// set, added, removed or renamed, or when one of its connections changes. Any change to the
+/// Dag hierarchy itself (parenting, instancing or renaming a node of the pulled hierarchy) is
+/// a topology change, for which the whole hierarchy must be exported again.
+///
+/// The merge to USD uses the edited nodes to only export the parts of the pulled hierarchy
+/// that may differ from the USD data. Edits are tracked per node, not per attribute: all the
+/// attributes of an edited node are exported again.
+///
+/// Exporting only the edited nodes must author the same USD data as exporting the whole
+/// hierarchy, where the Maya data replaces the USD data of every pulled prim. This only holds
+/// as long as the USD data of the pulled prims was not edited since the pull, so the owner
+/// of the tracker reports such edits with markUsdEdited().
+
+class MAYAUSD_CORE_PUBLIC PullEditTracker
+{
+public:
+    /// \brief Starts tracking the edits of the hierarchy rooted at \p pulledRoot.
+    explicit PullEditTracker(const MDagPath& pulledRoot);
+    ~PullEditTracker();
+
+    MAYAUSD_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(PullEditTracker);
+
+    /// \brief Returns true if \p pulledRoot is the root of the tracked hierarchy.
+    bool isTracking(const MDagPath& pulledRoot) const;
+
+    /// \brief Returns true if the tracked Dag hierarchy changed since the pull.
+    bool topologyChanged() const { return _topologyChanged; }
+
+    /// \brief Records that the USD data of the pulled prims was edited since the pull.
+    void markUsdEdited() { _usdEdited = true; }
+
+    /// \brief Gets the Dag paths of the pulled hierarchy that must be exported again to
+    /// reflect the edits, without the descendants of other edited paths.
+    ///
+    /// Returns false if the whole hierarchy must be exported, because of a topology change,
+    /// because the root itself was edited, because the USD data was edited, or because
+    /// nothing was edited.
+    bool getEditedDagPaths(std::vector<MDagPath>& editedPaths) const;
+
+private:
+    struct HandleHash
+    {
+        std::size_t operator()(const MObjectHandle& obj) const { return obj.hashCode(); }
+    };
+    using HandleSet = std::unordered_set<MObjectHandle, HandleHash>;
+
+    void trackNode(const MObject& node, bool isDagNode);
+    void trackUpstream(const MObject& node, bool skipDagNodes);
+    void untrack();
+
+    bool isUnderRoot(MDagPath dagPath) const;
+    void addEditedDagPaths(const MObject& node, HandleSet& added, std::vector<MDagPath>& paths)
+        const;
+
+    static void attributeChangedCB(
+        MNodeMessage::AttributeMessage msg,
+        MPlug&                         plug,
+        MPlug&                         otherPlug,
+        void*                          clientData);
+    static void nameChangedCB(MObject& node, const MString& prevName, void* clientData);
+    static void
+    dagChangedCB(MDagMessage::DagMessage msg, MDagPath& child, MDagPath& parent, void* clientData);
+
+    MDagPath         _root;
+    MObjectHandle    _rootHandle;
+    HandleSet        _tracked;
+    HandleSet        _edited;
+    size_t           _dagNodeCount { 0 };
+    bool             _topologyChanged { false };
+    bool             _usdEdited { false };
+    MCallbackIdArray _callbacks;
+};
+
+} // namespace MAYAUSD_NS_DEF
+
+#endif
@@ -63,6 +63,7 @@
 #include <maya/MString.h>
 #include <maya/MUuid.h>
 
+#include <memory>
 #include <regex>
 #include <string>
 #include <utility>
@@ -235,6 +236,53 @@ MObject UsdMayaShadingModeExportContext::GetDisplacementShader() const
     return _GetShaderFromShadingEngine(_shadingEngine, _displacementShaderPlugName);
 }
 
+/// Shading engines of the exported shapes, with the faces assigned to each of
+/// them. A shape assigned to many shading engines is a member of each of them,
+/// so the assignments of a shape are gathered once per export context and
+/// reused for all its shading engines, instead of once per shading engine.
+struct UsdMayaShadingModeExportContext::_AssignmentTable
+{
+    struct FaceSet
+    {
+        MObject    shadingEngine;
+        VtIntArray faceIndices;
+    };
+
+    const std::vector<FaceSet>&
+    GetFaceSets(MFnDagNode& dagNode, const MDagPath& dagPath, unsigned int instanceNumber)
+    {
+        auto iter = _faceSets.find(dagPath);
+        if (iter != _faceSets.end()) {
+            return iter->second;
+        }
+
+        std::vector<FaceSet>& faceSets = _faceSets[dagPath];
+
+        MObjectArray sgObjs, compObjs;
+        if (dagNode.getConnectedSetsAndMembers(instanceNumber, sgObjs, compObjs, true)
+            != MS::kSuccess) {
+            return faceSets;
+        }
+
+        faceSets.resize(sgObjs.length());
+        for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+            faceSets[j].shadingEngine = sgObjs[j];
+            if (!compObjs[j].isNull()) {
+                VtIntArray&    faceIndices = faceSets[j].faceIndices;
+                MItMeshPolygon faceIt(dagPath, compObjs[j]);
+                faceIndices.reserve(faceIt.count());
+                for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
+                    faceIndices.push_back(faceIt.index());
+                }
+            }
+        }
+        return faceSets;
+    }
+
+private:
+    UsdMayaUtil::MDagPathMap<std::vector<FaceSet>> _faceSets;
+};
+
 UsdMayaShadingModeExportContext::AssignmentsInfo
 UsdMayaShadingModeExportContext::GetAssignments() const
 {
@@ -339,28 +387,19 @@ UsdMayaShadingModeExportContext::GetAssignments() const
             continue;
         }
 
-        MObjectArray sgObjs, compObjs;
-        status = dagNode.getConnectedSetsAndMembers(instanceNumber, sgObjs, compObjs, true);
-        if (status != MS::kSuccess) {
-            continue;
+        if (!_assignmentTable) {
+            _assignmentTable = std::make_shared<_AssignmentTable>();
         }
 
-        for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+        const auto& faceSets = _assignmentTable->GetFaceSets(dagNode, dagPath, instanceNumber);
+        for (const auto& faceSet : faceSets) {
             // If the shading group isn't the one we're interested in, skip it.
-            if (sgObjs[j] != _shadingEngine) {
+            if (faceSet.shadingEngine != _shadingEngine) {
                 continue;
             }
 
-            VtIntArray faceIndices;
-            if (!compObjs[j].isNull()) {
-                MItMeshPolygon faceIt(dagPath, compObjs[j]);
-                faceIndices.reserve(faceIt.count());
-                for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
-                    faceIndices.push_back(faceIt.index());
-                }
-            }
             ret.assignments.push_back(Assignment {
-                usdPath, faceIndices, TfToken(dagNode.name().asChar()), dagNode.object() });
+                usdPath, faceSet.faceIndices, TfToken(dagNode.name().asChar()), dagNode.object() });
         }
     }
     return ret;
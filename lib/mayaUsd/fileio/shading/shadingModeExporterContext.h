@@ -31,6 +31,7 @@
 #include <maya/MObject.h>
 #include <maya/MPlug.h>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -105,6 +106,11 @@ public:
 
     /// Returns a vector of binding assignments associated with the shading
     /// engine.
+    ///
+    /// The shading engines and face sets of each exported shape are gathered
+    /// the first time one of its shading engines is queried, and reused for
+    /// its other shading engines. They are kept by this context, so each
+    /// shading mode exporter, which creates its own context, gathers them again.
     MAYAUSD_CORE_PUBLIC
     AssignmentsInfo GetAssignments() const;
 
@@ -133,6 +139,8 @@ public:
         const UsdMayaUtil::MDagPathMap<SdfPath>& dagPathToUsdMap);
 
 private:
+    struct _AssignmentTable;
+
     MObject                                  _shadingEngine;
     const UsdStageRefPtr&                    _stage;
     const UsdMayaUtil::MDagPathMap<SdfPath>& _dagPathToUsdMap;
@@ -144,6 +152,10 @@ private:
     /// Shaders that are bound to prims under \p _bindableRoot paths will get
     /// exported. If \p bindableRoots is empty, it will export all.
     SdfPathSet _bindableRoots;
+
+    /// Shading engines and face sets of the exported shapes, filled as the
+    /// shading engines of this context are queried.
+    mutable std::shared_ptr<_AssignmentTable> _assignmentTable;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -43,6 +43,7 @@
 #include <maya/MFnTransform.h>
 #include <maya/MString.h>
 
+#include <typeinfo>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -785,4 +786,11 @@ void UsdMayaTransformWriter::Write(const UsdTimeCode& usdTime)
     }
 }
 
+/* virtual */
+bool UsdMayaTransformWriter::SupportsContextEvaluation() const
+{
+    return typeid(*this) == typeid(UsdMayaTransformWriter)
+        && GetMayaObject().hasFn(MFn::kTransform);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
\ No newline at end of file
@@ -57,6 +57,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     void Write(const UsdTimeCode& usdTime) override;
 
+    /// The animated transform channels are read through their plugs, so they
+    /// can be evaluated in a DG context. Subclasses write more than these
+    /// channels and must opt in themselves.
+    MAYAUSD_CORE_PUBLIC
+    bool SupportsContextEvaluation() const override;
+
 private:
     // Cache of previous rotations.
     using _TokenRotationMap
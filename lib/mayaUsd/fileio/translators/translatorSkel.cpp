@@ -44,6 +44,14 @@
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // There are a lot of nodes and connections that go into a basic skinning rig.
@@ -205,6 +213,104 @@ bool _SetAnimPlugData(
     return true;
 }
 
+/// Translate, rotate and scale components of a transform animation,
+/// holding one value per time.
+struct _TransformAnimComponents
+{
+    std::vector<double> translates[3];
+    std::vector<double> rotates[3];
+    std::vector<double> scales[3];
+};
+
+/// Get the rotation order of \p transformNode, for Euler filtering.
+MEulerRotation::RotationOrder _GetRotationOrder(const MFnDependencyNode& transformNode)
+{
+    MPlug rotOrder = transformNode.findPlug("rotateOrder");
+    return static_cast<MEulerRotation::RotationOrder>(rotOrder.asInt());
+}
+
+/// Decompose the \p xforms of a transform animation into \p components.
+/// If \p eulerFilterOrder is not null, each rotation is replaced by its
+/// closest solution to the previous rotation, in that rotation order.
+/// This does not access the Maya scene, so it can run on any thread.
+void _DecomposeTransformAnim(
+    const std::vector<GfMatrix4d>&       xforms,
+    const MEulerRotation::RotationOrder* eulerFilterOrder,
+    _TransformAnimComponents*            components)
+{
+    const size_t numSamples = xforms.size();
+    for (int c = 0; c < 3; ++c) {
+        components->translates[c].assign(numSamples, 0.0);
+        components->rotates[c].assign(numSamples, 0.0);
+        components->scales[c].assign(numSamples, 1.0);
+    }
+
+    // Decompose all transforms.
+    for (size_t i = 0; i < numSamples; ++i) {
+        GfVec3d t, r, s;
+        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xforms[i], &t, &r, &s)) {
+            for (int c = 0; c < 3; ++c) {
+                components->translates[c][i] = t[c];
+                components->rotates[c][i] = r[c];
+                components->scales[c][i] = s[c];
+            }
+        }
+    }
+
+    if (eulerFilterOrder && numSamples > 0) {
+        auto& rotates = components->rotates;
+
+        MEulerRotation last(rotates[0][0], rotates[1][0], rotates[2][0], *eulerFilterOrder);
+        for (size_t i = 1; i < numSamples; ++i) {
+            MEulerRotation current(rotates[0][i], rotates[1][i], rotates[2][i], *eulerFilterOrder);
+            current.setToClosestSolution(last);
+            rotates[0][i] = current[0];
+            rotates[1][i] = current[1];
+            rotates[2][i] = current[2];
+            last = current;
+        }
+    }
+}
+
+/// Create the animation curves of \p transformNode from its decomposed
+/// animation \p components, at the given \p times.
+bool _SetTransformAnimCurves(
+    MFnDependencyNode&              transformNode,
+    const _TransformAnimComponents& components,
+    MTimeArray&                     times,
+    const UsdMayaPrimReaderContext* context)
+{
+    const unsigned int numSamples = times.length();
+    for (int c = 0; c < 3; ++c) {
+        MDoubleArray translates(components.translates[c].data(), numSamples);
+        MDoubleArray rotates(components.rotates[c].data(), numSamples);
+        MDoubleArray scales(components.scales[c].data(), numSamples);
+        if (!_SetAnimPlugData(
+                transformNode, _MayaTokens->translates[c], translates, times, context)
+            || !_SetAnimPlugData(transformNode, _MayaTokens->rotates[c], rotates, times, context)
+            || !_SetAnimPlugData(transformNode, _MayaTokens->scales[c], scales, times, context)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Set the static transform \p xform on \p transformNode.
+bool _SetTransform(MFnDependencyNode& transformNode, const GfMatrix4d& xform)
+{
+    GfVec3d t, r, s;
+    if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
+        for (int c = 0; c < 3; ++c) {
+            if (!UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->translates[c], t[c])
+                || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->rotates[c], r[c])
+                || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->scales[c], s[c])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /// Set animation on \p transformNode.
 /// The \p xforms holds transforms at each time, while the \p times
 /// array holds the corresponding times.
@@ -222,72 +328,18 @@ bool _SetTransformAnim(
     if (xforms.empty())
         return true;
 
-    MStatus status;
-
-    const unsigned int numSamples = times.length();
-
-    if (numSamples > 1) {
-        MDoubleArray translates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray rotates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray scales[3] = { MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1) };
-
-        // Decompose all transforms.
-        for (unsigned int i = 0; i < numSamples; ++i) {
-            const auto& xform = xforms[i];
-            GfVec3d     t, r, s;
-            if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-                for (int c = 0; c < 3; ++c) {
-                    translates[c][i] = t[c];
-                    rotates[c][i] = r[c];
-                    scales[c][i] = s[c];
-                }
-            }
-        }
-
-        if (applyEulerFilter) {
-            MPlug                         rotOrder = transformNode.findPlug("rotateOrder");
-            MEulerRotation::RotationOrder order
-                = static_cast<MEulerRotation::RotationOrder>(rotOrder.asInt());
-
-            MEulerRotation last(rotates[0][0], rotates[1][0], rotates[2][0], order);
-            for (unsigned int i = 1; i < rotates[0].length(); ++i) {
-                MEulerRotation current(rotates[0][i], rotates[1][i], rotates[2][i], order);
-                current.setToClosestSolution(last);
-                rotates[0][i] = current[0];
-                rotates[1][i] = current[1];
-                rotates[2][i] = current[2];
-                last = current;
-            }
-        }
+    if (xforms.size() == 1) {
+        return _SetTransform(transformNode, xforms.front());
+    }
 
-        for (int c = 0; c < 3; ++c) {
-            if (!_SetAnimPlugData(
-                    transformNode, _MayaTokens->translates[c], translates[c], times, context)
-                || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->rotates[c], rotates[c], times, context)
-                || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->scales[c], scales[c], times, context)) {
-                return false;
-            }
-        }
-    } else {
-        const auto& xform = xforms.front();
-        GfVec3d     t, r, s;
-        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-            for (int c = 0; c < 3; ++c) {
-                if (!UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->translates[c], t[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->rotates[c], r[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->scales[c], s[c])) {
-                    return false;
-                }
-            }
-        }
+    MEulerRotation::RotationOrder rotOrder = MEulerRotation::kXYZ;
+    if (applyEulerFilter) {
+        rotOrder = _GetRotationOrder(transformNode);
     }
-    return true;
+
+    _TransformAnimComponents components;
+    _DecomposeTransformAnim(xforms, applyEulerFilter ? &rotOrder : nullptr, &components);
+    return _SetTransformAnimCurves(transformNode, components, times, context);
 }
 
 void _GetJointAnimTimeSamples(
@@ -501,14 +553,37 @@ bool _CopyAnimFromSkel(
 
     MStatus status;
 
-    // Pre-sample the Skeleton's local transforms.
-    std::vector<GfMatrix4d>      skelLocalXforms(usdTimes.size());
+    // Pre-sample the Skeleton's local transforms and all joint animation,
+    // for all times concurrently.
+    const size_t                 numTimes = usdTimes.size();
+    const UsdSkelTopology&       topology = skelQuery.GetTopology();
+    std::vector<GfMatrix4d>      skelLocalXforms(numTimes);
+    std::vector<VtMatrix4dArray> samples(numTimes);
     UsdGeomXformable::XformQuery xfQuery(skelQuery.GetSkeleton());
-    for (size_t i = 0; i < usdTimes.size(); ++i) {
-        if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i], usdTimes[i])) {
-            skelLocalXforms[i].SetIdentity();
-        }
-    }
+    std::atomic<bool>            sampled(true);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numTimes), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i], usdTimes[i])) {
+                    skelLocalXforms[i].SetIdentity();
+                }
+                if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
+                    sampled = false;
+                    continue;
+                }
+                if (!jointContainerIsSkeleton) {
+                    // We do not have a node to receive the local transforms of the
+                    // Skeleton, so any local transforms on the Skeleton must be
+                    // concatened onto the root joints instead.
+                    for (size_t j = 0; j < topology.GetNumJoints(); ++j) {
+                        if (topology.GetParent(j) < 0) {
+                            // This is a root joint. Concat by the local skel xform.
+                            samples[i][j] *= skelLocalXforms[i];
+                        }
+                    }
+                }
+            }
+        });
 
     if (jointContainerIsSkeleton) {
         // The jointContainer is being used to represent the Skeleton.
@@ -527,41 +602,63 @@ bool _CopyAnimFromSkel(
         }
     }
 
-    // Pre-sample all joint animation.
-    std::vector<VtMatrix4dArray> samples(usdTimes.size());
-    for (size_t i = 0; i < samples.size(); ++i) {
-        if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
-            return false;
-        }
-        if (!jointContainerIsSkeleton) {
-            // We do not have a node to receive the local transforms of the
-            // Skeleton, so any local transforms on the Skeleton must be
-            // concatened onto the root joints instead.
-            for (size_t j = 0; j < skelQuery.GetTopology().GetNumJoints(); ++j) {
-                if (skelQuery.GetTopology().GetParent(j) < 0) {
-                    // This is a root joint. Concat by the local skel xform.
-                    samples[i][j] *= skelLocalXforms[i];
-                }
+    if (!sampled) {
+        return false;
+    }
+    if (numTimes == 0) {
+        return true;
+    }
+
+    MFnDependencyNode jointDep;
+
+    const size_t numJoints = jointNodes.size();
+
+    if (numTimes == 1) {
+        for (size_t jointIdx = 0; jointIdx < numJoints; ++jointIdx) {
+            if (jointDep.setObject(jointNodes[jointIdx])
+                && !_SetTransform(jointDep, samples[0][jointIdx])) {
+                return false;
             }
         }
+        return true;
     }
 
-    MFnDependencyNode jointDep;
+    // The rotation orders for the Euler filter are read from the scene on
+    // the main thread, before the transforms of all joints are decomposed
+    // concurrently.
+    const bool applyEulerFilter = args.GetJobArguments().applyEulerFilter;
+    std::vector<MEulerRotation::RotationOrder> rotOrders(
+        applyEulerFilter ? numJoints : 0, MEulerRotation::kXYZ);
+    for (size_t jointIdx = 0; jointIdx < rotOrders.size(); ++jointIdx) {
+        if (jointDep.setObject(jointNodes[jointIdx])) {
+            rotOrders[jointIdx] = _GetRotationOrder(jointDep);
+        }
+    }
 
-    std::vector<GfMatrix4d> xforms(samples.size());
+    std::vector<_TransformAnimComponents> jointComponents(numJoints);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numJoints), [&](const tbb::blocked_range<size_t>& range) {
+            std::vector<GfMatrix4d> xforms(numTimes);
+            for (size_t jointIdx = range.begin(); jointIdx != range.end(); ++jointIdx) {
+                // Get the transforms of just this joint.
+                for (size_t i = 0; i < numTimes; ++i) {
+                    xforms[i] = samples[i][jointIdx];
+                }
+                _DecomposeTransformAnim(
+                    xforms,
+                    applyEulerFilter ? &rotOrders[jointIdx] : nullptr,
+                    &jointComponents[jointIdx]);
+            }
+        });
+    samples.clear();
 
-    for (size_t jointIdx = 0; jointIdx < jointNodes.size(); ++jointIdx) {
+    // Build the animation curves of all joints in one pass on the main thread.
+    for (size_t jointIdx = 0; jointIdx < numJoints; ++jointIdx) {
 
         if (!jointDep.setObject(jointNodes[jointIdx]))
             continue;
 
-        // Get the transforms of just this joint.
-        for (size_t i = 0; i < samples.size(); ++i) {
-            xforms[i] = samples[i][jointIdx];
-        }
-
-        if (!_SetTransformAnim(
-                jointDep, xforms, mayaTimes, context, args.GetJobArguments().applyEulerFilter))
+        if (!_SetTransformAnimCurves(jointDep, jointComponents[jointIdx], mayaTimes, context))
             return false;
     }
     return true;
@@ -911,33 +1008,6 @@ bool _SetVaryingJointInfluences(
 
     const unsigned int numJoints = static_cast<unsigned int>(joints.size());
 
-    // Compute a vertex-ordered weight arrays. Weights are stored as:
-    //   vert_0_joint_0 ... vert_0_joint_n ... vert_n_joint_0 ... vert_n_joint_n
-    MDoubleArray vertOrderedWeights(numPoints * numJoints, 0.0f);
-    for (unsigned int pt = 0; pt < numPoints; ++pt) {
-        for (int c = 0; c < numInfluencesPerPoint; ++c) {
-            int jointIdx = indices[pt * numInfluencesPerPoint + c];
-            if (jointIdx >= 0 && static_cast<unsigned int>(jointIdx) < numJoints) {
-                float w = weights[pt * numInfluencesPerPoint + c];
-                // There may be multiple influences referencing the same joint
-                // for this point. eg., 'unweighted' points are assigned
-                // index 0 and weight 0. Sum the weight contributions to ensure
-                // that we properly account for this.
-                vertOrderedWeights[pt * numJoints + jointIdx] += w;
-            }
-        }
-    }
-
-    MIntArray influenceIndices(numJoints);
-    for (unsigned int i = 0; i < numJoints; ++i) {
-        influenceIndices[i] = i;
-    }
-
-    // Set all weights in one batch
-    MFnSingleIndexedComponent components;
-    components.create(MFn::kMeshVertComponent);
-    components.setCompleteData(numPoints);
-
     // XXX: Note that weights are expected to be pre-normalized in USD.
     // In order to faithfully transfer our source data, we do not perform
     // any normalization on import. Maya's weight normalization also seems
@@ -962,16 +1032,113 @@ bool _SetVaryingJointInfluences(
     status = skinClusterFn.setObject(skinCluster);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
-    // Apply the weights. Note that this fails with kInvalidParameter
-    // if the influenceIndices are invalid. Validity is based on the
-    // set of joints wired up to the skinCluster.
-    status = skinClusterFn.setWeights(
-        dagPath,
-        components.object(),
-        influenceIndices,
-        vertOrderedWeights,
-        /*normalize*/ false);
-    CHECK_MSTATUS_AND_RETURN(status, false);
+    // The weights are set in batches of consecutive points, with the weights of all the joints
+    // influencing any point of the batch. Neighbouring points are usually influenced by the
+    // same joints, so a batch covers many points while its weights stay within the size of the
+    // sparse influences, instead of expanding them to numPoints * numJoints weights.
+    const size_t maxBatchWeights = static_cast<size_t>(numPoints) * numInfluencesPerPoint;
+
+    // Column of each joint in the batch weights, or -1 if no point of the batch uses it.
+    std::vector<int>                    jointColumns(numJoints, -1);
+    MIntArray                           batchJoints;
+    MIntArray                           batchPoints;
+    std::vector<std::pair<int, double>> batchInfluences;
+    std::vector<size_t>                 batchOffsets(1, 0);
+    std::vector<std::pair<int, double>> pointInfluences;
+
+    auto setBatchWeights = [&]() {
+        const unsigned int numBatchPoints = batchPoints.length();
+        if (numBatchPoints == 0) {
+            return true;
+        }
+
+        // Weights are stored as:
+        //   vert_0_joint_0 ... vert_0_joint_n ... vert_n_joint_0 ... vert_n_joint_n
+        const unsigned int numColumns = batchJoints.length();
+        MDoubleArray       batchWeights(numBatchPoints * numColumns, 0.0);
+        for (unsigned int i = 0; i < numBatchPoints; ++i) {
+            for (size_t k = batchOffsets[i]; k < batchOffsets[i + 1]; ++k) {
+                const auto& influence = batchInfluences[k];
+                batchWeights[i * numColumns + jointColumns[influence.first]] = influence.second;
+            }
+        }
+
+        MFnSingleIndexedComponent components;
+        MObject                   componentsObj = components.create(MFn::kMeshVertComponent);
+        components.addElements(batchPoints);
+
+        // Apply the weights. Note that this fails with kInvalidParameter
+        // if the influenceIndices are invalid. Validity is based on the
+        // set of joints wired up to the skinCluster.
+        status = skinClusterFn.setWeights(
+            dagPath, componentsObj, batchJoints, batchWeights, /*normalize*/ false);
+        CHECK_MSTATUS_AND_RETURN(status, false);
+
+        for (unsigned int i = 0; i < numColumns; ++i) {
+            jointColumns[batchJoints[i]] = -1;
+        }
+        batchJoints.clear();
+        batchPoints.clear();
+        batchInfluences.clear();
+        batchOffsets.resize(1);
+        return true;
+    };
+
+    for (unsigned int pt = 0; pt < numPoints; ++pt) {
+        pointInfluences.clear();
+        for (int c = 0; c < numInfluencesPerPoint; ++c) {
+            int jointIdx = indices[pt * numInfluencesPerPoint + c];
+            if (jointIdx >= 0 && static_cast<unsigned int>(jointIdx) < numJoints) {
+                float w = weights[pt * numInfluencesPerPoint + c];
+                // There may be multiple influences referencing the same joint
+                // for this point. eg., 'unweighted' points are assigned
+                // index 0 and weight 0. Sum the weight contributions to ensure
+                // that we properly account for this.
+                auto found = std::find_if(
+                    pointInfluences.begin(),
+                    pointInfluences.end(),
+                    [jointIdx](const std::pair<int, double>& influence) {
+                        return influence.first == jointIdx;
+                    });
+                if (found != pointInfluences.end()) {
+                    found->second += w;
+                } else {
+                    pointInfluences.emplace_back(jointIdx, 0.0 + w);
+                }
+            }
+        }
+
+        // Points without influences keep no weights, which reads back as zero weights.
+        if (pointInfluences.empty()) {
+            continue;
+        }
+
+        size_t numNewJoints = 0;
+        for (const auto& influence : pointInfluences) {
+            numNewJoints += (jointColumns[influence.first] < 0) ? 1 : 0;
+        }
+        const size_t numBatchWeights
+            = (batchPoints.length() + 1) * (batchJoints.length() + numNewJoints);
+        if (batchPoints.length() > 0 && numBatchWeights > maxBatchWeights) {
+            if (!setBatchWeights()) {
+                return false;
+            }
+        }
+
+        for (const auto& influence : pointInfluences) {
+            if (jointColumns[influence.first] < 0) {
+                jointColumns[influence.first] = batchJoints.length();
+                batchJoints.append(influence.first);
+            }
+            batchInfluences.push_back(influence);
+        }
+        batchPoints.append(pt);
+        batchOffsets.push_back(batchInfluences.size());
+    }
+
+    if (!setBatchWeights()) {
+        return false;
+    }
 
     // Reset the normalization flag to its previous value.
     if (!normalizeWeights.isNull()) {
@@ -822,29 +822,42 @@ void UsdMayaMeshWriteUtils::assignSubDivTagsToUSDPrim(
     }
 }
 
-void UsdMayaMeshWriteUtils::writePointsData(
-    const MFnMesh&             meshFn,
-    UsdGeomMesh&               primSchema,
-    const UsdTimeCode&         usdTime,
-    const double               distanceUnitsScalar,
-    FlexibleSparseValueWriter* valueWriter)
+bool UsdMayaMeshWriteUtils::getPointsData(
+    const MFnMesh& meshFn,
+    VtVec3fArray*  points,
+    VtVec3fArray*  extent)
 {
     MStatus status { MS::kSuccess };
 
     const uint32_t numVertices = meshFn.numVertices();
     const float*   pointsData = meshFn.getRawPoints(&status);
     if (!status) {
-        MGlobal::displayError(
-            MString("Unable to access mesh vertices on mesh: ") + meshFn.fullPathName());
-        return;
+        return false;
     }
 
     const GfVec3f* vecData = reinterpret_cast<const GfVec3f*>(pointsData);
-    VtVec3fArray   points(vecData, vecData + numVertices);
+    points->assign(vecData, vecData + numVertices);
 
-    VtVec3fArray extent(2);
     // Compute the extent using the raw points
-    UsdGeomPointBased::ComputeExtent(points, &extent);
+    extent->resize(2);
+    UsdGeomPointBased::ComputeExtent(*points, extent);
+    return true;
+}
+
+void UsdMayaMeshWriteUtils::writePointsData(
+    const MFnMesh&             meshFn,
+    UsdGeomMesh&               primSchema,
+    const UsdTimeCode&         usdTime,
+    const double               distanceUnitsScalar,
+    FlexibleSparseValueWriter* valueWriter)
+{
+    VtVec3fArray points;
+    VtVec3fArray extent;
+    if (!getPointsData(meshFn, &points, &extent)) {
+        MGlobal::displayError(
+            MString("Unable to access mesh vertices on mesh: ") + meshFn.fullPathName());
+        return;
+    }
 
     UsdMayaWriteUtil::SetScaledAttribute(
         primSchema.GetPointsAttr(), &points, distanceUnitsScalar, usdTime, valueWriter);
@@ -852,27 +865,36 @@ void UsdMayaMeshWriteUtils::writePointsData(
         primSchema.CreateExtentAttr(), &extent, distanceUnitsScalar, usdTime, valueWriter);
 }
 
+void UsdMayaMeshWriteUtils::getFaceVertexIndicesData(
+    const MFnMesh& meshFn,
+    VtIntArray*    faceVertexCounts,
+    VtIntArray*    faceVertexIndices)
+{
+    // Fetch the whole topology at once rather than one polygon at a time.
+    MIntArray mayaFaceVertexCounts;
+    MIntArray mayaFaceVertexIndices;
+    meshFn.getVertices(mayaFaceVertexCounts, mayaFaceVertexIndices);
+
+    faceVertexCounts->resize(mayaFaceVertexCounts.length());
+    if (!faceVertexCounts->empty()) {
+        mayaFaceVertexCounts.get(faceVertexCounts->data());
+    }
+    faceVertexIndices->resize(mayaFaceVertexIndices.length());
+    if (!faceVertexIndices->empty()) {
+        mayaFaceVertexIndices.get(faceVertexIndices->data());
+    }
+}
+
 void UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
     const MFnMesh&             meshFn,
     UsdGeomMesh&               primSchema,
     const UsdTimeCode&         usdTime,
     FlexibleSparseValueWriter* valueWriter)
 {
-    const int numFaceVertices = meshFn.numFaceVertices();
-    const int numPolygons = meshFn.numPolygons();
-
-    VtIntArray   faceVertexCounts(numPolygons);
-    VtIntArray   faceVertexIndices(numFaceVertices);
-    MIntArray    mayaFaceVertexIndices; // used in loop below
-    unsigned int curFaceVertexIndex = 0;
-    for (int i = 0; i < numPolygons; i++) {
-        meshFn.getPolygonVertices(i, mayaFaceVertexIndices);
-        faceVertexCounts[i] = mayaFaceVertexIndices.length();
-        for (unsigned int j = 0; j < mayaFaceVertexIndices.length(); j++) {
-            faceVertexIndices[curFaceVertexIndex] = mayaFaceVertexIndices[j]; // push_back
-            curFaceVertexIndex++;
-        }
-    }
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    getFaceVertexIndicesData(meshFn, &faceVertexCounts, &faceVertexIndices);
+
     UsdMayaWriteUtil::SetAttribute(
         primSchema.GetFaceVertexCountsAttr(), &faceVertexCounts, usdTime, valueWriter);
     UsdMayaWriteUtil::SetAttribute(
@@ -118,6 +118,18 @@ void assignSubDivTagsToUSDPrim(
     UsdGeomMesh&               primSchema,
     FlexibleSparseValueWriter* valueWriter);
 
+/// Helper method for getting Maya mesh points, and their extent, as VtVec3fArrays.
+/// Does not report errors, so that it can be used from worker threads.
+MAYAUSD_CORE_PUBLIC
+bool getPointsData(const MFnMesh& meshFn, VtVec3fArray* points, VtVec3fArray* extent);
+
+/// Helper method for getting the Maya mesh faces as USD face vertex counts and indices.
+MAYAUSD_CORE_PUBLIC
+void getFaceVertexIndicesData(
+    const MFnMesh& meshFn,
+    VtIntArray*    faceVertexCounts,
+    VtIntArray*    faceVertexIndices);
+
 MAYAUSD_CORE_PUBLIC
 void writePointsData(
     const MFnMesh&             meshFn,
@@ -68,6 +68,9 @@
 #include <ufe/observableSelection.h>
 #include <ufe/selectionNotification.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <algorithm>
 #include <cstdio>
 #include <iostream>
@@ -332,7 +335,7 @@ public:
     bool saveLayerManagerSelectedStage();
     bool loadLayerManagerSelectedStage(MayaUsd::LayerManager& layerManager);
 
-    SdfLayerHandle findLayer(std::string identifier) const;
+    SdfLayerHandle findLayer(std::string identifier);
 
     LayerManager::LayerNameMap getLayerNameMap() const;
 
@@ -342,7 +345,10 @@ private:
     void registerCallbacks();
     void unregisterCallbacks();
 
-    void _addLayer(SdfLayerRefPtr layer, const std::string& identifier);
+    void           _addLayer(SdfLayerRefPtr layer, const std::string& identifier);
+    SdfLayerHandle _findLayer(const std::string& identifier) const;
+    void           loadPendingContent(const SdfLayerHandle& layer);
+    void           loadAllPendingContent();
     void onStageSet(const MayaUsdProxyStageSetNotice& notice);
 
     bool            saveUsd(bool isExport);
@@ -360,6 +366,10 @@ private:
     void updateLayerManagers();
 
     std::map<std::string, SdfLayerRefPtr> _idToLayer;
+    // Serialized content of the anonymous layers read from the Maya file, imported in
+    // the layers by the first findLayer() call for them, which is made by the first
+    // compute of their proxy shape.
+    std::map<SdfLayerHandle, std::string> _pendingContent;
     TfNotice::Key                         _onStageSetKey;
     std::set<unsigned int>                _supportedTypes;
     std::vector<StageSavingInfo>          _proxiesToSave;
@@ -642,6 +652,11 @@ void LayerDatabase::cleanupForExport(void*)
 void LayerDatabase::prepareForWriteCheck(bool* retCode, bool isExport)
 {
     _isSavingMayaFile = true;
+
+    // The anonymous layers whose proxy shape was not computed yet still hold their content
+    // as read from the Maya file. Import it before the database is cleared, otherwise
+    // those layers would be lost or saved empty.
+    LayerDatabase::instance().loadAllPendingContent();
     cleanUpNewScene(nullptr);
 
     LayerDatabase::instance().saveLayerManagerSelectedStage();
@@ -923,17 +938,49 @@ bool LayerDatabase::saveUsd(bool isExport)
     return (MayaUsd::kCompleted == result);
 }
 
-MStatus addLayerToBuilder(
-    MayaUsd::LayerManager* lm,
-    MArrayDataBuilder&     builder,
-    SdfLayerHandle         layer,
-    bool                   isAnon,
-    bool                   stubOnly = false,
-    bool                   exportOnlyIfDirty = false)
+// A layer to save in the layer manager node, with its serialized content.
+struct LayerToSave
+{
+    SdfLayerHandle layer;
+    bool           isAnon { false };
+    bool           stubOnly { false };
+    bool           exportOnlyIfDirty { false };
+    bool           exportFailed { false };
+    std::string    serialized;
+};
+
+void serializeLayers(std::vector<LayerToSave>& layersToSave)
+{
+    // The optionVar is read on the main thread, the layers are then serialized in parallel
+    // since exporting large layers dominates the time to save them.
+    const MayaUsd::utils::USDSerializedEditsFormat format
+        = MayaUsd::utils::serializedUsdEditsFormatOption();
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, layersToSave.size(), 1),
+        [&layersToSave, format](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                LayerToSave& toSave = layersToSave[i];
+                if (toSave.stubOnly || (toSave.exportOnlyIfDirty && !toSave.layer->IsDirty()))
+                    continue;
+
+                if (!MayaUsd::utils::exportLayerToString(
+                        *toSave.layer, format, &toSave.serialized)) {
+                    toSave.serialized.clear();
+                    toSave.exportFailed = true;
+                }
+            }
+        });
+}
+
+MStatus
+addLayerToBuilder(MayaUsd::LayerManager* lm, MArrayDataBuilder& builder, const LayerToSave& toSave)
 {
     if (!lm)
         return MS::kFailure;
 
+    const SdfLayerHandle& layer = toSave.layer;
+
     MStatus     status = MS::kSuccess;
     MDataHandle layersElemHandle = builder.addLast(&status);
     CHECK_MSTATUS_AND_RETURN_IT(status);
@@ -943,19 +990,16 @@ MStatus addLayerToBuilder(
     MDataHandle anonHandle = layersElemHandle.child(lm->anonymous);
 
     idHandle.setString(UsdMayaUtil::convert(layer->GetIdentifier()));
-    anonHandle.setBool(isAnon);
+    anonHandle.setBool(toSave.isAnon);
 
     auto fileFormatIdToken = layer->GetFileFormat()->GetFormatId();
     fileFormatIdHandle.setString(UsdMayaUtil::convert(fileFormatIdToken.GetString()));
 
-    std::string temp;
-    if (!stubOnly && ((exportOnlyIfDirty && layer->IsDirty()) || !exportOnlyIfDirty)) {
-        if (!layer->ExportToString(&temp)) {
-            status = MS::kFailure;
-        }
+    if (toSave.exportFailed) {
+        status = MS::kFailure;
     }
 
-    serializedHandle.setString(UsdMayaUtil::convert(temp));
+    serializedHandle.setString(UsdMayaUtil::convert(toSave.serialized));
 
     return status;
 }
@@ -975,24 +1019,22 @@ struct SaveStageToMayaResult
 
 template <typename T, typename IgnoreLayerFn>
 void saveLayersToMayaFile(
-    const T&               allLayers,
-    const IgnoreLayerFn&&  ignoreLayerFn,
-    MayaUsd::LayerManager* lm,
-    MArrayDataBuilder&     builder,
-    MayaUsdProxyShapeBase& proxyShape,
-    SaveStageToMayaResult& result)
+    const T&                  allLayers,
+    const IgnoreLayerFn&&     ignoreLayerFn,
+    std::vector<LayerToSave>& layersToSave,
+    MayaUsdProxyShapeBase&    proxyShape,
+    SaveStageToMayaResult&    result)
 {
     for (auto layer : allLayers) {
         if (ignoreLayerFn(layer)) {
             continue;
         }
-        addLayerToBuilder(
-            lm,
-            builder,
-            layer,
-            layer->IsAnonymous(),
-            proxyShape.isIncomingLayer(layer->GetIdentifier()),
-            true);
+        LayerToSave toSave;
+        toSave.layer = layer;
+        toSave.isAnon = layer->IsAnonymous();
+        toSave.stubOnly = proxyShape.isIncomingLayer(layer->GetIdentifier());
+        toSave.exportOnlyIfDirty = true;
+        layersToSave.push_back(std::move(toSave));
         if (layer->IsDirty()) {
             result._stageHasDirtyLayers = true;
         }
@@ -1019,6 +1061,7 @@ SaveStageToMayaResult saveStageToMayaFile(
     pShape->setLayerManager(nullptr);
 
     std::unordered_set<std::string> localLayerIds;
+    std::vector<LayerToSave>        layersToSave;
 
     // Save session layer and its sublayers
     saveLayersToMayaFile(
@@ -1027,8 +1070,7 @@ SaveStageToMayaResult saveStageToMayaFile(
             localLayerIds.emplace(layer->GetIdentifier());
             return false;
         },
-        lm,
-        builder,
+        layersToSave,
         *pShape,
         result);
 
@@ -1039,8 +1081,7 @@ SaveStageToMayaResult saveStageToMayaFile(
             localLayerIds.emplace(layer->GetIdentifier());
             return false;
         },
-        lm,
-        builder,
+        layersToSave,
         *pShape,
         result);
 
@@ -1052,8 +1093,7 @@ SaveStageToMayaResult saveStageToMayaFile(
             [&localLayerIds](const auto& layer) {
                 return !localLayerIds.emplace(layer->GetIdentifier()).second;
             },
-            lm,
-            builder,
+            layersToSave,
             *pShape,
             result);
     }
@@ -1066,11 +1106,15 @@ SaveStageToMayaResult saveStageToMayaFile(
             return TF_VERIFY(layer)
                 && localLayerIds.find(layer->GetIdentifier()) != localLayerIds.cend();
         },
-        lm,
-        builder,
+        layersToSave,
         *pShape,
         result);
 
+    serializeLayers(layersToSave);
+    for (const LayerToSave& toSave : layersToSave) {
+        addLayerToBuilder(lm, builder, toSave);
+    }
+
     if (result._stageHasDirtyLayers) {
         setValueForAttr(
             proxyNode,
@@ -1283,7 +1327,11 @@ void LayerDatabase::saveUsdLayerToMayaFile(
     MArrayDataHandle  layersHandle = dataBlock.outputArrayValue(lm->layers, &status);
     MArrayDataBuilder builder(&dataBlock, lm->layers, 1 /*maybe nb stages?*/, &status);
 
-    addLayerToBuilder(lm, builder, layer, asAnonymous);
+    std::vector<LayerToSave> layersToSave(1);
+    layersToSave[0].layer = layer;
+    layersToSave[0].isAnon = asAnonymous;
+    serializeLayers(layersToSave);
+    addLayerToBuilder(lm, builder, layersToSave[0]);
 
     layersHandle.set(builder);
 
@@ -1405,7 +1453,12 @@ void LayerDatabase::loadLayersPostRead(MayaUsdProxyShapeBase* forProxyShape)
 
         if (layer) {
             if (layerContainsEdits) {
-                if (!layer->ImportFromString(serializedVal)) {
+                // Anonymous layers can only be reached through the database, so their
+                // content is imported by the first findLayer() for them. The other layers can be
+                // opened directly by their identifier, so they are imported now.
+                if (isAnon) {
+                    LayerDatabase::instance()._pendingContent[layer] = std::move(serializedVal);
+                } else if (!MayaUsd::utils::importLayerFromString(layer, serializedVal)) {
                     MGlobal::displayError(
                         MString("Failed to import serialized layer: ") + serializedVal.c_str());
                     continue;
@@ -1421,9 +1474,12 @@ void LayerDatabase::loadLayersPostRead(MayaUsdProxyShapeBase* forProxyShape)
 
     removeManagerNode(lm, forProxyShape);
 
+    // The sub-layer paths of the pending layers are remapped once they are imported.
+    const auto& pendingContent = LayerDatabase::instance()._pendingContent;
     for (auto it = createdLayers.begin(); it != createdLayers.end(); ++it) {
         SdfLayerHandle lh = (*it);
-        LayerDatabase::instance().remapSubLayerPaths(lh);
+        if (pendingContent.count(lh) == 0)
+            LayerDatabase::instance().remapSubLayerPaths(lh);
     }
 }
 
@@ -1490,9 +1546,12 @@ void LayerDatabase::_addLayer(SdfLayerRefPtr layer, const std::string& identifie
 
 bool LayerDatabase::removeLayer(SdfLayerRefPtr layer)
 {
+    // A layer that was never imported has no sub-layers yet.
+    _pendingContent.erase(layer);
+
     std::vector<std::string> paths = layer->GetSubLayerPaths();
     for (auto pathName : paths) {
-        SdfLayerRefPtr childLayer = findLayer(pathName);
+        SdfLayerRefPtr childLayer = _findLayer(pathName);
         if (childLayer) {
             removeLayer(childLayer);
         }
@@ -1509,9 +1568,22 @@ bool LayerDatabase::removeLayer(SdfLayerRefPtr layer)
     return true;
 }
 
-void LayerDatabase::removeAllLayers() { _idToLayer.clear(); }
+void LayerDatabase::removeAllLayers()
+{
+    _idToLayer.clear();
+    _pendingContent.clear();
+}
 
-SdfLayerHandle LayerDatabase::findLayer(std::string identifier) const
+SdfLayerHandle LayerDatabase::findLayer(std::string identifier)
+{
+    SdfLayerHandle layer = _findLayer(identifier);
+    if (layer) {
+        loadPendingContent(layer);
+    }
+    return layer;
+}
+
+SdfLayerHandle LayerDatabase::_findLayer(const std::string& identifier) const
 {
     auto foundIdAndLayer = _idToLayer.find(identifier);
     if (foundIdAndLayer != _idToLayer.end()) {
@@ -1521,6 +1593,38 @@ SdfLayerHandle LayerDatabase::findLayer(std::string identifier) const
     return SdfLayerHandle();
 }
 
+void LayerDatabase::loadPendingContent(const SdfLayerHandle& layer)
+{
+    auto pendingIt = _pendingContent.find(layer);
+    if (pendingIt == _pendingContent.end())
+        return;
+
+    // Remove the content before importing it, since remapping the sub-layer paths
+    // finds, and thus imports, the sub-layers.
+    const std::string serialized = std::move(pendingIt->second);
+    _pendingContent.erase(pendingIt);
+
+    if (!MayaUsd::utils::importLayerFromString(layer, serialized)) {
+        MGlobal::displayError(
+            MString("Failed to import serialized layer: ") + layer->GetIdentifier().c_str());
+        return;
+    }
+
+    remapSubLayerPaths(layer);
+}
+
+void LayerDatabase::loadAllPendingContent()
+{
+    // Importing a layer can import its sub-layers, so restart from the first pending layer.
+    while (!_pendingContent.empty()) {
+        const SdfLayerHandle layer = _pendingContent.begin()->first;
+        if (layer)
+            loadPendingContent(layer);
+        else
+            _pendingContent.erase(_pendingContent.begin());
+    }
+}
+
 void LayerDatabase::clearManagerNode(MayaUsd::LayerManager* lm)
 {
     if (!lm)
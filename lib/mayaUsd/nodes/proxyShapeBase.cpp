@@ -1366,6 +1366,7 @@ MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
 
     const bool isNormalContext = dataBlock.context().isNormal();
     if (isNormalContext) {
+        _boundsCache.Clear();
         TfReset(_boundingBoxCache);
 
         // Reset the stage listener until we determine that everything is valid.
@@ -1660,12 +1661,11 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
     dataBlock.inputValue(outStageDataAttr, &status);
     CHECK_MSTATUS_AND_RETURN(status, MBoundingBox());
 
-    // XXX:
-    // If we could cheaply determine whether a stage only has static geometry,
-    // we could make this value a constant one for that case, avoiding the
-    // memory overhead of a cache entry per frame
     UsdTimeCode currTime = GetOutputTime(dataBlock);
 
+    // The final bounding boxes, including the pulled prims, are cached per time code. They are
+    // cleared on any stage change, after which the bounds cache below only recomputes the
+    // subtrees that changed.
     std::map<UsdTimeCode, MBoundingBox>::const_iterator cacheLookup
         = _boundingBoxCache.find(currTime);
 
@@ -1673,32 +1673,38 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
         return cacheLookup->second;
     }
 
-    MProfilingScope profilingScope(
-        _shapeBaseProfilerCategory, MProfiler::kColorB_L1, "Compute USD Stage BoundingBox");
-
     UsdPrim prim = _GetUsdPrim(dataBlock);
     if (!prim) {
         return MBoundingBox();
     }
 
-    const UsdGeomImageable imageablePrim(prim);
-
     bool drawRenderPurpose = false;
     bool drawProxyPurpose = true;
     bool drawGuidePurpose = false;
     _GetDrawPurposeToggles(dataBlock, &drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
 
-    const TfToken purpose1 = UsdGeomTokens->default_;
-    const TfToken purpose2 = drawRenderPurpose ? UsdGeomTokens->render : TfToken();
-    const TfToken purpose3 = drawProxyPurpose ? UsdGeomTokens->proxy : TfToken();
-    const TfToken purpose4 = drawGuidePurpose ? UsdGeomTokens->guide : TfToken();
+    TfTokenVector purposes { UsdGeomTokens->default_ };
+    if (drawRenderPurpose) {
+        purposes.push_back(UsdGeomTokens->render);
+    }
+    if (drawProxyPurpose) {
+        purposes.push_back(UsdGeomTokens->proxy);
+    }
+    if (drawGuidePurpose) {
+        purposes.push_back(UsdGeomTokens->guide);
+    }
 
     // Compute the bound in "Usd World" space. This will apply the transform the
-    // referenced prim may have relative to the root of its Usd scene
-    GfBBox3d allBox
-        = imageablePrim.ComputeWorldBound(currTime, purpose1, purpose2, purpose3, purpose4);
+    // referenced prim may have relative to the root of its Usd scene. The bounds
+    // cache only recomputes the subtrees that changed since the last call, and
+    // keeps a single bound for subtrees that do not vary over time.
+    GfBBox3d allBox;
+    {
+        MProfilingScope profilingScope(
+            _shapeBaseProfilerCategory, MProfiler::kColorB_L1, "Compute USD Stage BoundingBox");
 
-    UsdMayaUtil::AddMayaExtents(allBox, prim, currTime);
+        allBox = nonConstThis->_boundsCache.ComputeWorldBound(prim, currTime, purposes);
+    }
 
     Ufe::BBox3d pulledUfeBBox = MayaUsd::ufe::getPulledPrimsBoundingBox(ufePath());
     if (!pulledUfeBBox.empty()) {
@@ -1725,7 +1731,11 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
     return retval;
 }
 
-void MayaUsdProxyShapeBase::clearBoundingBoxCache() { _boundingBoxCache.clear(); }
+void MayaUsdProxyShapeBase::clearBoundingBoxCache()
+{
+    _boundsCache.Clear();
+    _boundingBoxCache.clear();
+}
 
 bool MayaUsdProxyShapeBase::isStageValid() const
 {
@@ -2352,10 +2362,10 @@ void MayaUsdProxyShapeBase::_OnStageObjectsChanged(const UsdNotice::ObjectsChang
     case UsdMayaStageNoticeListener::ChangeType::kUpdate: ++_UsdStageUpdateCounter; break;
     }
 
-    // This will definitely force a BBox recomputation on "Frame All" or when framing a selected
-    // stage. Computing bounds in USD is expensive, so if it pops up in other frequently used
-    // scenarios we will have to investigate ways to make this cache clearing less expensive.
-    clearBoundingBoxCache();
+    // Only the bounds of the changed prims and of their ancestors are recomputed on the next
+    // "Frame All" or when framing a selected stage.
+    _boundsCache.Invalidate(notice);
+    _boundingBoxCache.clear();
 
     ProxyAccessor::stageChanged(_usdAccessor, thisMObject(), notice);
     MayaUsdProxyStageObjectsChangedNotice(*this, notice).Send();
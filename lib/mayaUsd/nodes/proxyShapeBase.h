@@ -47,6 +47,7 @@ UFE_NS_DEF { class Path; }
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/listeners/stageNoticeListener.h>
 #include <mayaUsd/nodes/proxyAccessor.h>
+#include <mayaUsd/nodes/proxyShapeBoundsCache.h>
 #include <mayaUsd/nodes/proxyStageProvider.h>
 #include <mayaUsd/nodes/usdPrimProvider.h>
 #include <mayaUsd/utils/mayaNodeObserver.h>
@@ -453,6 +454,7 @@ private:
 
     UsdMayaStageNoticeListener _stageNoticeListener;
 
+    MayaUsdProxyShapeBoundsCache        _boundsCache;
     std::map<UsdTimeCode, MBoundingBox> _boundingBoxCache;
     size_t                              _excludePrimPathsVersion { 1 };
     size_t                              _UsdStageVersion { 1 };
@@ -0,0 +1,549 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "proxyShapeBoundsCache.h"
+
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/usd/usdGeom/camera.h>
+#include <pxr/usd/usdGeom/imageable.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
+#include <pxr/usd/usdGeom/pointBased.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+#include <pxr/usd/usdGeom/xformable.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+struct MayaUsdProxyShapeBoundsCache::_Node
+{
+    explicit _Node(const SdfPath& path)
+        : _path(path)
+    {
+    }
+
+    void InvalidateBounds()
+    {
+        _hasStaticBound = false;
+        _timeBounds.clear();
+        _isSubtreeVarianceKnown = false;
+    }
+
+    void InvalidateChildren()
+    {
+        InvalidateBounds();
+        _children.clear();
+        _expanded = false;
+    }
+
+    SdfPath _path;
+
+    //! Child entries. Only group prims have children, the bound of any other prim is computed
+    //! with a UsdGeomBBoxCache over its whole subtree.
+    std::vector<std::unique_ptr<_Node>> _children;
+    bool                                _expanded { false };
+
+    //! Cached bound, in the local space of the prim.
+    bool                            _hasStaticBound { false };
+    GfBBox3d                        _staticBound;
+    std::map<UsdTimeCode, GfBBox3d> _timeBounds;
+    bool                            _timeVarying { false };
+
+    //! For a subtree computed with a UsdGeomBBoxCache, true once its prims were checked for
+    //! time-varying bounds.
+    bool _isSubtreeVarianceKnown { false };
+};
+
+//! A leaf subtree whose bound must be computed with a UsdGeomBBoxCache for the current query.
+struct MayaUsdProxyShapeBoundsCache::_DirtySubtree
+{
+    _Node*  _node;
+    UsdPrim _prim;
+    bool    _visibilityTimeVarying;
+};
+
+namespace {
+
+bool _MightBeTimeVarying(const UsdAttribute& attr)
+{
+    return attr && attr.ValueMightBeTimeVarying();
+}
+
+//! Returns true if the bound contributed by the prim itself may vary over time.
+bool _IsPrimBoundTimeVarying(const UsdPrim& prim)
+{
+    const UsdGeomImageable imageable(prim);
+    if (!imageable) {
+        return false;
+    }
+
+    if (_MightBeTimeVarying(imageable.GetVisibilityAttr())) {
+        return true;
+    }
+
+    const UsdGeomXformable xformable(prim);
+    if (xformable && xformable.TransformMightBeTimeVarying()) {
+        return true;
+    }
+
+    if (_MightBeTimeVarying(UsdGeomModelAPI(prim).GetExtentsHintAttr())) {
+        return true;
+    }
+
+    const UsdGeomBoundable boundable(prim);
+    if (!boundable) {
+        return false;
+    }
+
+    if (_MightBeTimeVarying(boundable.GetExtentAttr())) {
+        return true;
+    }
+
+    const UsdGeomPointBased pointBased(prim);
+    if (pointBased && _MightBeTimeVarying(pointBased.GetPointsAttr())) {
+        return true;
+    }
+
+    const UsdGeomPointInstancer instancer(prim);
+    if (instancer
+        && (_MightBeTimeVarying(instancer.GetPositionsAttr())
+            || _MightBeTimeVarying(instancer.GetOrientationsAttr())
+            || _MightBeTimeVarying(instancer.GetScalesAttr())
+            || _MightBeTimeVarying(instancer.GetProtoIndicesAttr())
+            || _MightBeTimeVarying(instancer.GetInvisibleIdsAttr()))) {
+        return true;
+    }
+
+    return false;
+}
+
+//! Returns true if the bound of any prim of the subtree may vary over time.
+bool _IsSubtreeBoundTimeVarying(const UsdPrim& root)
+{
+    for (const UsdPrim& prim : UsdPrimRange(root, UsdTraverseInstanceProxies())) {
+        if (_IsPrimBoundTimeVarying(prim)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! Returns true if the bound of the prim is only the union of the bounds of its children, in
+//! which case each child gets its own cache entry. Everything else (geometry, instances, cameras,
+//! prims with extents hints or authored purposes...) is handled by a UsdGeomBBoxCache, to keep
+//! all its rules about purposes, instancing and extents.
+bool _IsGroup(const UsdPrim& prim)
+{
+    if (prim.IsPseudoRoot()) {
+        return true;
+    }
+
+    if (prim.IsInstance() || !prim.IsA<UsdGeomXformable>() || prim.IsA<UsdGeomBoundable>()
+        || prim.IsA<UsdGeomCamera>()) {
+        return false;
+    }
+
+    // Children inherit the purpose of their parent, so their bounds depend on it.
+    const UsdGeomImageable imageable(prim);
+    if (imageable.GetPurposeAttr().HasAuthoredValue()) {
+        return false;
+    }
+
+    const UsdAttribute extentsHint = UsdGeomModelAPI(prim).GetExtentsHintAttr();
+    if (extentsHint && extentsHint.HasAuthoredValue()) {
+        return false;
+    }
+
+    bool hasChildren = false;
+    for (const UsdPrim& child : prim.GetChildren()) {
+        hasChildren = true;
+
+        // The transform of such a child is not relative to this prim.
+        const UsdGeomXformable xformable(child);
+        if (xformable && xformable.GetResetXformStack()) {
+            return false;
+        }
+    }
+
+    return hasChildren;
+}
+
+//! Same as UsdGeomBBoxCache: invisible prims do not contribute to bounds.
+bool _IsVisible(const UsdPrim& prim, UsdTimeCode time, bool& timeVarying)
+{
+    timeVarying = false;
+
+    const UsdGeomImageable imageable(prim);
+    if (!imageable) {
+        return true;
+    }
+
+    const UsdAttribute visibilityAttr = imageable.GetVisibilityAttr();
+    timeVarying = _MightBeTimeVarying(visibilityAttr);
+
+    TfToken visibility;
+    return !visibilityAttr.Get(&visibility, time) || visibility != UsdGeomTokens->invisible;
+}
+
+} // namespace
+
+MayaUsdProxyShapeBoundsCache::MayaUsdProxyShapeBoundsCache() = default;
+
+MayaUsdProxyShapeBoundsCache::~MayaUsdProxyShapeBoundsCache() = default;
+
+GfBBox3d MayaUsdProxyShapeBoundsCache::ComputeWorldBound(
+    const UsdPrim&       prim,
+    UsdTimeCode          time,
+    const TfTokenVector& purposes)
+{
+    TRACE_FUNCTION();
+
+    if (!prim) {
+        return GfBBox3d();
+    }
+
+    if (!_root || _root->_path != prim.GetPath() || _purposes != purposes) {
+        _root = std::make_unique<_Node>(prim.GetPath());
+        _purposes = purposes;
+    }
+
+    const UsdStagePtr stage = prim.GetStage();
+
+    std::vector<_DirtySubtree> dirtySubtrees;
+    _CollectDirtySubtrees(*_root, stage, time, dirtySubtrees);
+
+    // The dirty subtrees are independent, so they are computed in parallel. A UsdGeomBBoxCache is
+    // not safe for concurrent queries, so each worker thread has its own, shared by all the
+    // subtrees it computes so that the instance prototypes they share are computed once per
+    // thread. Like UsdGeomImageable::ComputeWorldBound, authored extents hints are not trusted.
+    if (dirtySubtrees.size() > 1) {
+        tbb::enumerable_thread_specific<UsdGeomBBoxCache> bboxCaches([&]() {
+            return UsdGeomBBoxCache(time, _purposes, /*useExtentsHint=*/false);
+        });
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, dirtySubtrees.size(), 1),
+            [&](const tbb::blocked_range<size_t>& range) {
+                UsdGeomBBoxCache& bboxCache = bboxCaches.local();
+                for (size_t i = range.begin(); i < range.end(); ++i) {
+                    _ComputeSubtreeBound(dirtySubtrees[i], bboxCache);
+                }
+            });
+    } else if (!dirtySubtrees.empty()) {
+        UsdGeomBBoxCache bboxCache(time, _purposes, /*useExtentsHint=*/false);
+        _ComputeSubtreeBound(dirtySubtrees.front(), bboxCache);
+    }
+
+    // All the dirty subtrees are now cached, only the group entries above them are left.
+    GfBBox3d bound = _ComputeUntransformedBound(*_root, stage, time);
+
+    if (!prim.IsPseudoRoot()) {
+        UsdGeomXformCache xformCache(time);
+        bound.Transform(xformCache.GetLocalToWorldTransform(prim));
+    }
+
+    return bound;
+}
+
+void MayaUsdProxyShapeBoundsCache::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    if (!_root) {
+        return;
+    }
+
+    auto invalidate = [this](const SdfPath& path) {
+        if (path.IsAbsoluteRootOrPrimPath()) {
+            _InvalidatePath(path, TfToken());
+        } else {
+            _InvalidatePath(path.GetPrimPath(), path.GetNameToken());
+        }
+    };
+
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        invalidate(path);
+    }
+
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        invalidate(path);
+    }
+}
+
+void MayaUsdProxyShapeBoundsCache::Clear()
+{
+    _root.reset();
+    _purposes.clear();
+}
+
+bool MayaUsdProxyShapeBoundsCache::_GetCachedBound(
+    const _Node& node,
+    UsdTimeCode  time,
+    GfBBox3d&    bound)
+{
+    if (node._hasStaticBound) {
+        bound = node._staticBound;
+        return true;
+    }
+
+    const auto found = node._timeBounds.find(time);
+    if (found != node._timeBounds.end()) {
+        bound = found->second;
+        return true;
+    }
+
+    return false;
+}
+
+void MayaUsdProxyShapeBoundsCache::_SetCachedBound(
+    _Node&          node,
+    UsdTimeCode     time,
+    const GfBBox3d& bound,
+    bool            timeVarying)
+{
+    node._timeVarying = timeVarying;
+    if (timeVarying) {
+        node._timeBounds[time] = bound;
+    } else {
+        node._staticBound = bound;
+        node._hasStaticBound = true;
+    }
+}
+
+void MayaUsdProxyShapeBoundsCache::_ExpandNode(_Node& node, const UsdPrim& prim)
+{
+    if (node._expanded) {
+        return;
+    }
+
+    // Keep the entries of the children that are still there, only their parent changed.
+    std::unordered_map<SdfPath, std::unique_ptr<_Node>, SdfPath::Hash> previousChildren;
+    for (auto& child : node._children) {
+        previousChildren.emplace(child->_path, std::move(child));
+    }
+    node._children.clear();
+
+    if (_IsGroup(prim)) {
+        for (const UsdPrim& child : prim.GetChildren()) {
+            // Same as UsdGeomBBoxCache: only imageable prims contribute to bounds.
+            if (!child.IsA<UsdGeomImageable>()) {
+                continue;
+            }
+
+            auto previous = previousChildren.find(child.GetPath());
+            if (previous != previousChildren.end()) {
+                node._children.push_back(std::move(previous->second));
+            } else {
+                node._children.push_back(std::make_unique<_Node>(child.GetPath()));
+            }
+        }
+    }
+    node._expanded = true;
+}
+
+void MayaUsdProxyShapeBoundsCache::_CollectDirtySubtrees(
+    _Node&                      node,
+    const UsdStagePtr&          stage,
+    UsdTimeCode                 time,
+    std::vector<_DirtySubtree>& dirtySubtrees)
+{
+    GfBBox3d bound;
+    if (_GetCachedBound(node, time, bound)) {
+        return;
+    }
+
+    const UsdPrim prim = stage->GetPrimAtPath(node._path);
+    if (!prim) {
+        return;
+    }
+
+    // Expanding changes the tree, so it is only done here, before the parallel computation.
+    _ExpandNode(node, prim);
+
+    bool visibilityTimeVarying = false;
+    if (!_IsVisible(prim, time, visibilityTimeVarying)) {
+        return;
+    }
+
+    if (node._children.empty()) {
+        dirtySubtrees.push_back({ &node, prim, visibilityTimeVarying });
+        return;
+    }
+
+    for (const auto& child : node._children) {
+        _CollectDirtySubtrees(*child, stage, time, dirtySubtrees);
+    }
+}
+
+GfBBox3d MayaUsdProxyShapeBoundsCache::_ComputeSubtreeBound(
+    const _DirtySubtree& subtree,
+    UsdGeomBBoxCache&    bboxCache)
+{
+    const UsdTimeCode time = bboxCache.GetTime();
+    _Node&            node = *subtree._node;
+    bool              timeVarying = subtree._visibilityTimeVarying;
+
+    GfBBox3d bound = bboxCache.ComputeUntransformedBound(subtree._prim);
+    UsdMayaUtil::AddMayaExtents(bound, subtree._prim, time);
+
+    // Finding whether the subtree varies over time takes a second traversal, so it is only done
+    // once its bound is needed at another time code. Until then, the bound is kept for this time
+    // code only.
+    if (node._isSubtreeVarianceKnown) {
+        timeVarying = true;
+    } else if (!node._timeBounds.empty()) {
+        node._isSubtreeVarianceKnown = true;
+        timeVarying = timeVarying || _IsSubtreeBoundTimeVarying(subtree._prim);
+        if (!timeVarying) {
+            node._timeBounds.clear();
+        }
+    } else {
+        timeVarying = true;
+    }
+
+    _SetCachedBound(node, time, bound, timeVarying);
+    return bound;
+}
+
+GfBBox3d MayaUsdProxyShapeBoundsCache::_ComputeUntransformedBound(
+    _Node&             node,
+    const UsdStagePtr& stage,
+    UsdTimeCode        time)
+{
+    GfBBox3d bound;
+    if (_GetCachedBound(node, time, bound)) {
+        return bound;
+    }
+
+    bool          timeVarying = false;
+    const UsdPrim prim = stage->GetPrimAtPath(node._path);
+    if (prim) {
+        _ExpandNode(node, prim);
+
+        const bool visible = _IsVisible(prim, time, timeVarying);
+        if (visible && node._children.empty()) {
+            // Only reached for subtrees that were not collected as dirty beforehand.
+            UsdGeomBBoxCache bboxCache(time, _purposes, /*useExtentsHint=*/false);
+            return _ComputeSubtreeBound({ &node, prim, timeVarying }, bboxCache);
+        }
+
+        if (visible) {
+            // Bring the bounds of the children into the local space of this prim.
+            for (const auto& childNode : node._children) {
+                GfBBox3d     childBound = _ComputeUntransformedBound(*childNode, stage, time);
+                const _Node& child = *childNode;
+                timeVarying |= child._timeVarying;
+
+                const UsdGeomXformable xformable(stage->GetPrimAtPath(child._path));
+                if (xformable) {
+                    timeVarying |= xformable.TransformMightBeTimeVarying();
+
+                    GfMatrix4d localXform;
+                    bool       resetsXformStack = false;
+                    if (xformable.GetLocalTransformation(&localXform, &resetsXformStack, time)) {
+                        childBound.Transform(localXform);
+                    }
+                }
+
+                bound = GfBBox3d::Combine(bound, childBound);
+            }
+        }
+    }
+
+    _SetCachedBound(node, time, bound, timeVarying);
+    return bound;
+}
+
+void MayaUsdProxyShapeBoundsCache::_InvalidatePath(
+    const SdfPath& primPath,
+    const TfToken& propertyName)
+{
+    if (!_root) {
+        return;
+    }
+
+    if (UsdPrim::IsPrototypePath(primPath) || UsdPrim::IsPathInPrototype(primPath)) {
+        // Prototypes are shared by instances anywhere in the stage.
+        Clear();
+        return;
+    }
+
+    if (!primPath.HasPrefix(_root->_path)) {
+        // Changes above the root prim may affect everything below it.
+        if (_root->_path.HasPrefix(primPath)) {
+            Clear();
+        }
+        return;
+    }
+
+    // Changes on the prim itself (resync, metadata) may change its whole subtree.
+    const bool primChanged = propertyName.IsEmpty();
+
+    // Invalidate the entries from the root down to the deepest entry containing the prim.
+    _Node* parent = nullptr;
+    _Node* node = _root.get();
+    while (true) {
+        node->InvalidateBounds();
+
+        if (node->_path == primPath) {
+            if (primChanged || propertyName == UsdGeomTokens->purpose) {
+                // Descendants inherit the purpose of the prim.
+                node->InvalidateChildren();
+            } else if (propertyName == UsdGeomTokens->extentsHint) {
+                node->_expanded = false;
+            }
+
+            // The prim may have been removed or may now reset the transform stack.
+            if (parent && (primChanged || propertyName == UsdGeomTokens->xformOpOrder)) {
+                parent->_expanded = false;
+            }
+            return;
+        }
+
+        _Node* next = nullptr;
+        for (const auto& child : node->_children) {
+            if (primPath.HasPrefix(child->_path)) {
+                next = child.get();
+                break;
+            }
+        }
+
+        if (!next) {
+            // A child may have been added to this prim.
+            if (primChanged && primPath.GetParentPath() == node->_path) {
+                node->_expanded = false;
+            }
+            return;
+        }
+
+        parent = node;
+        node = next;
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,105 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_PROXY_SHAPE_BOUNDS_CACHE_H
+#define MAYAUSD_PROXY_SHAPE_BOUNDS_CACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class MayaUsdProxyShapeBoundsCache
+/// \brief Hierarchical cache of the bounds of the prims of a proxy shape stage.
+///
+/// The cache keeps one entry per group prim (a transformable prim whose bound is only the union
+/// of the bounds of its children) and one entry per leaf subtree below them, whose bound is
+/// computed with a UsdGeomBBoxCache. Each entry remembers whether its bound may vary over time:
+/// time-invariant entries hold a single bound shared by all frames, while time-varying entries
+/// hold one bound per time code.
+///
+/// When the stage changes, only the entries of the changed prims and of their ancestors are
+/// invalidated, so the next query only recomputes the dirty subtrees. The dirty subtrees are
+/// computed in parallel, with one UsdGeomBBoxCache per worker thread, then combined into the
+/// entries of their ancestors.
+class MayaUsdProxyShapeBoundsCache
+{
+public:
+    MAYAUSD_CORE_PUBLIC
+    MayaUsdProxyShapeBoundsCache();
+
+    MAYAUSD_CORE_PUBLIC
+    ~MayaUsdProxyShapeBoundsCache();
+
+    MayaUsdProxyShapeBoundsCache(const MayaUsdProxyShapeBoundsCache&) = delete;
+    MayaUsdProxyShapeBoundsCache& operator=(const MayaUsdProxyShapeBoundsCache&) = delete;
+
+    /// \brief Computes the bound of the prim and its descendants in world space, for the given
+    /// time and purposes. Maya-specific extents (for example of cameras) are included.
+    MAYAUSD_CORE_PUBLIC
+    GfBBox3d
+    ComputeWorldBound(const UsdPrim& prim, UsdTimeCode time, const TfTokenVector& purposes);
+
+    /// \brief Invalidates the cached bounds affected by the changes described by the notice.
+    MAYAUSD_CORE_PUBLIC
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
+    /// \brief Invalidates all cached bounds.
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+private:
+    struct _Node;
+    struct _DirtySubtree;
+
+    static bool _GetCachedBound(const _Node& node, UsdTimeCode time, GfBBox3d& bound);
+    static void
+    _SetCachedBound(_Node& node, UsdTimeCode time, const GfBBox3d& bound, bool timeVarying);
+    static void _ExpandNode(_Node& node, const UsdPrim& prim);
+
+    //! Expands the entries that need it and collects the leaf subtrees without a cached bound at
+    //! the time code. Only called from the main thread, since it changes the tree.
+    static void _CollectDirtySubtrees(
+        _Node&                      node,
+        const UsdStagePtr&          stage,
+        UsdTimeCode                 time,
+        std::vector<_DirtySubtree>& dirtySubtrees);
+
+    //! Computes and caches the bound of a dirty subtree. Only touches the entry of the subtree,
+    //! so different subtrees can be computed concurrently, each with its own bboxCache.
+    static GfBBox3d
+    _ComputeSubtreeBound(const _DirtySubtree& subtree, UsdGeomBBoxCache& bboxCache);
+
+    GfBBox3d _ComputeUntransformedBound(_Node& node, const UsdStagePtr& stage, UsdTimeCode time);
+    void     _InvalidatePath(const SdfPath& primPath, const TfToken& propertyName);
+
+    std::unique_ptr<_Node> _root;
+    TfTokenVector          _purposes;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
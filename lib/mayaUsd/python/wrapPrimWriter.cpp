@@ -653,7 +653,10 @@ void wrapJobExportArgs()
         .add_property(
             "shadingMode",
             make_getter(&UsdMayaJobExportArgs::shadingMode, return_value_policy<return_by_value>()))
+        .def_readonly("parallelFrameExport", &UsdMayaJobExportArgs::parallelFrameExport)
+        .def_readonly("contextEvaluation", &UsdMayaJobExportArgs::contextEvaluation)
         .def_readonly("staticSingleSample", &UsdMayaJobExportArgs::staticSingleSample)
+        .def_readonly("streamingFrameWindow", &UsdMayaJobExportArgs::streamingFrameWindow)
         .def_readonly("stripNamespaces", &UsdMayaJobExportArgs::stripNamespaces)
         .def_readonly("worldspace", &UsdMayaJobExportArgs::worldspace)
         .add_property(
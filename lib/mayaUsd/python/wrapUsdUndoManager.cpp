@@ -72,6 +72,13 @@ void _trackLayerStates(const SdfLayerHandle& layer)
     UsdUfe::UsdUndoManager::instance().trackLayerStates(layer);
 }
 
+void _setMemoryLimit(std::size_t byteSize)
+{
+    UsdUfe::UsdUndoManager::instance().setMemoryLimit(byteSize);
+}
+
+std::size_t _getMemoryLimit() { return UsdUfe::UsdUndoManager::instance().getMemoryLimit(); }
+
 } // namespace
 
 void wrapUsdUndoManager()
@@ -81,14 +88,20 @@ void wrapUsdUndoManager()
         typedef UsdUfe::UsdUndoManager This;
         class_<This, PXR_BOOST_PYTHON_NAMESPACE::noncopyable>("UsdUndoManager", no_init)
             .def("trackLayerStates", &_trackLayerStates)
-            .staticmethod("trackLayerStates");
+            .staticmethod("trackLayerStates")
+            .def("setMemoryLimit", &_setMemoryLimit)
+            .staticmethod("setMemoryLimit")
+            .def("getMemoryLimit", &_getMemoryLimit)
+            .staticmethod("getMemoryLimit");
     }
 
     // UsdUfe::UsdUndoableItem
     {
         class_<UsdUfe::UsdUndoableItem>("UsdUndoableItem")
             .def("undo", &UsdUfe::UsdUndoableItem::undo)
-            .def("redo", &UsdUfe::UsdUndoableItem::redo);
+            .def("redo", &UsdUfe::UsdUndoableItem::redo)
+            .def("getEditCount", &UsdUfe::UsdUndoableItem::getEditCount)
+            .def("getByteSize", &UsdUfe::UsdUndoableItem::getByteSize);
     }
 
     // UsdUndoBlock
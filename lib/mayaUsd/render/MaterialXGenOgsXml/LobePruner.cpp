@@ -18,6 +18,7 @@
 #include <MaterialXGenGlsl/GlslShaderGenerator.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <map>
 #include <memory>
@@ -91,6 +92,7 @@ public:
 
     PXR_NS::TfToken getOptimizedNodeId(const PXR_NS::HdMaterialNode2& node);
     bool            isOptimizedNodeId(const PXR_NS::TfToken& nodeId);
+    size_t          getLibraryGeneration() const { return _libraryGeneration; }
 
     void optimizeLibrary(const MaterialX::DocumentPtr& library);
 
@@ -138,6 +140,7 @@ private:
     std::unordered_map<PXR_NS::TfToken, NodeDefData, PXR_NS::TfToken::HashFunctor> _prunerData;
     mx::DocumentPtr                                                                _library;
     PXR_NS::TfToken::HashSet _optimizedNodeIds;
+    std::atomic<size_t>      _libraryGeneration { 0 };
 };
 
 const std::string LobePrunerImpl::ND_PREFIX = "LPOPTIND_";
@@ -228,6 +231,8 @@ void LobePrunerImpl::optimizeLibrary(const MaterialX::DocumentPtr& library)
         return;
     }
 
+    ++_libraryGeneration;
+
     std::set<std::string> allDefinedNodeGraphs;
     // Go thru all NodeGraphs found in the library that have an associated NodeDef:
     for (const auto& ng : library->getNodeGraphs()) {
@@ -482,6 +487,7 @@ mx::NodeDefPtr LobePrunerImpl::getOrAddOptimizedNodeDef(
     }
 
     _optimizedNodeIds.insert(PXR_NS::TfToken(optimizedNodeDefName));
+    ++_libraryGeneration;
 
     auto optimizedNodeDef
         = _library->addNodeDef(optimizedNodeDefName, "surfaceshader", optimizedNodeName);
@@ -714,6 +720,11 @@ bool LobePruner::isOptimizedNodeId(const PXR_NS::TfToken& nodeId)
     return _impl ? _impl->isOptimizedNodeId(nodeId) : false;
 }
 
+size_t LobePruner::getLibraryGeneration() const
+{
+    return _impl ? _impl->getLibraryGeneration() : 0;
+}
+
 const std::string& LobePruner::getOptimizedNodeDefPrefix() { return LobePrunerImpl::ND_PREFIX; }
 
 const std::string& LobePruner::getDarkBaseNodeName() { return LobePrunerImpl::DARK_BASE; }
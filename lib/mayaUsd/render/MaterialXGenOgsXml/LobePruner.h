@@ -96,6 +96,13 @@ public:
      */
     bool isOptimizedNodeId(const PXR_NS::TfToken& nodeId);
 
+    /*! Returns a counter incremented every time the LobePruner adds optimized NodeDefs and
+     * NodeGraphs to its library, or optimizes a library in place. Copies of the library made
+     * before the counter changed are missing these additions.
+     *  \return the generation of the library.
+     */
+    size_t getLibraryGeneration() const;
+
     /*! Returns the NodeDef prefix common to all LobePruner optimized definitions.
      *  \return the LobePruner NodeDef prefix
      */
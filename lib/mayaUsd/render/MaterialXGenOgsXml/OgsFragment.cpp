@@ -383,9 +383,10 @@ std::string getOriginalName(const std::string& parameterName, const mx::NodeDefP
     }
 
     // Here we try to find back the original name in case it conflicted with an identifier (like
-    // "mix") A one level cache will help reduce churn:
-    static std::string           gLastNodeDef;
-    static std::set<std::string> gParameters;
+    // "mix") A one level cache will help reduce churn. Fragments can be generated concurrently, so
+    // the cache is per thread:
+    thread_local std::string           gLastNodeDef;
+    thread_local std::set<std::string> gParameters;
 
     if (gLastNodeDef != shaderNodeDef->getName()) {
         gParameters.clear();
@@ -23,6 +23,7 @@ TF_REGISTRY_FUNCTION(TfDebug)
 {
     TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_MATERIAL, "Debug material");
     TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_MESH, "Debug mesh");
+    TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_TEXTURE_LOADING, "Debug asynchronous texture loading");
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,363 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "fragmentDiskCache.h"
+
+#include "debugCodes.h"
+
+#include <pxr/base/js/json.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/stringUtils.h>
+
+#include <ghc/filesystem.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_FRAGMENT_CACHE_DIR,
+    "",
+    "Folder where the OGS fragments generated for MaterialX materials are cached between "
+    "sessions. The cache is disabled when not set.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_FRAGMENT_CACHE_MAX_SIZE_MB,
+    256,
+    "Maximum size in megabytes of the MaterialX fragment cache. 0 disables the cache.");
+
+namespace {
+
+//! Bump when the content of the entries changes.
+constexpr int kCacheFormatVersion = 1;
+
+const char* const kFormatVersionKey = "formatVersion";
+const char* const kDescriptionKey = "description";
+const char* const kFragmentNameKey = "fragmentName";
+const char* const kFragmentSourceKey = "fragmentSource";
+const char* const kPrimvarsKey = "requiredPrimvars";
+const char* const kRenamedParametersKey = "renamedParameters";
+const char* const kEntryExtension = ".json";
+
+//! 64-bit FNV-1a hash of a string. Unlike std::hash, it is stable across sessions and platforms.
+uint64_t _Fnv1a(const std::string& str, uint64_t hash)
+{
+    for (unsigned char c : str) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+//! Final avalanche of the 64-bit MurmurHash3, spreads the bits of a hash.
+uint64_t _Mix(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+//! 128-bit key of a description, as 32 hexadecimal digits.
+std::string _ComputeKey(const std::string& description)
+{
+    const uint64_t low = _Mix(_Fnv1a(description, 0xcbf29ce484222325ULL));
+    const uint64_t high = _Mix(_Fnv1a(description, 0x84222325cbf29ce4ULL) ^ description.size());
+    return TfStringPrintf("%016llx%016llx", (unsigned long long)high, (unsigned long long)low);
+}
+
+} // namespace
+
+HdVP2FragmentDiskCache& HdVP2FragmentDiskCache::GetInstance()
+{
+    static HdVP2FragmentDiskCache sInstance;
+    return sInstance;
+}
+
+HdVP2FragmentDiskCache::HdVP2FragmentDiskCache()
+    : _maxSizeInBytes(
+        std::uintmax_t(std::max(0, TfGetEnvSetting(MAYAUSD_VP2_FRAGMENT_CACHE_MAX_SIZE_MB))) << 20)
+{
+    if (_maxSizeInBytes == 0) {
+        return;
+    }
+
+    // No default folder: a shared one, like the temporary folder, would let other users plant
+    // fragments that VP2 then compiles.
+    const ghc::filesystem::path folder(TfGetEnvSetting(MAYAUSD_VP2_FRAGMENT_CACHE_DIR));
+    if (folder.empty()) {
+        return;
+    }
+
+    std::error_code ec;
+    ghc::filesystem::create_directories(folder, ec);
+    if (ec) {
+        TF_WARN(
+            "Unable to create the MaterialX fragment cache folder %s: %s",
+            folder.string().c_str(),
+            ec.message().c_str());
+        return;
+    }
+
+    _folder = folder.string();
+    _enabled = true;
+}
+
+std::string HdVP2FragmentDiskCache::_GetEntryPath(const std::string& description) const
+{
+    return (ghc::filesystem::path(_folder) / (_ComputeKey(description) + kEntryExtension))
+        .string();
+}
+
+bool HdVP2FragmentDiskCache::Load(const std::string& description, Entry& entry)
+{
+    if (!_enabled) {
+        return false;
+    }
+
+    const std::string path = _GetEntryPath(description);
+
+    auto miss = [this]() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_stats._misses;
+        return false;
+    };
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return miss();
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    file.close();
+
+    const JsValue root = JsParseString(buffer.str());
+    if (!root.IsObject()) {
+        return miss();
+    }
+    const JsObject& object = root.GetJsObject();
+
+    auto getString = [&object](const char* key) -> const std::string* {
+        const auto it = object.find(key);
+        return (it != object.end() && it->second.IsString()) ? &it->second.GetString() : nullptr;
+    };
+
+    // Keys are hashes: compare the full description to rule out collisions.
+    const auto         versionIt = object.find(kFormatVersionKey);
+    const std::string* storedDescription = getString(kDescriptionKey);
+    const std::string* fragmentName = getString(kFragmentNameKey);
+    const std::string* fragmentSource = getString(kFragmentSourceKey);
+    if (versionIt == object.end() || !versionIt->second.IsInt()
+        || versionIt->second.GetInt() != kCacheFormatVersion || !storedDescription
+        || *storedDescription != description || !fragmentName || !fragmentSource) {
+        return miss();
+    }
+
+    entry._fragmentName = *fragmentName;
+    entry._fragmentSource = *fragmentSource;
+
+    entry._requiredPrimvars.clear();
+    const auto primvarsIt = object.find(kPrimvarsKey);
+    if (primvarsIt != object.end() && primvarsIt->second.IsArray()) {
+        for (const JsValue& primvar : primvarsIt->second.GetJsArray()) {
+            if (primvar.IsString()) {
+                entry._requiredPrimvars.emplace_back(primvar.GetString());
+            }
+        }
+    }
+
+    entry._renamedParameters.clear();
+    const auto renamedIt = object.find(kRenamedParametersKey);
+    if (renamedIt != object.end() && renamedIt->second.IsObject()) {
+        for (const auto& renamed : renamedIt->second.GetJsObject()) {
+            if (renamed.second.IsString()) {
+                entry._renamedParameters.emplace(renamed.first, renamed.second.GetString());
+            }
+        }
+    }
+
+    // Mark the entry as recently used for the eviction policy.
+    std::error_code ec;
+    ghc::filesystem::last_write_time(path, ghc::filesystem::file_time_type::clock::now(), ec);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_stats._hits;
+    TF_DEBUG(HDVP2_DEBUG_MATERIAL)
+        .Msg(
+            "Fragment cache hit for %s (%zu hits, %zu misses)\n",
+            entry._fragmentName.c_str(),
+            _stats._hits,
+            _stats._misses);
+    return true;
+}
+
+void HdVP2FragmentDiskCache::Store(const std::string& description, const Entry& entry)
+{
+    if (!_enabled || entry._fragmentName.empty() || entry._fragmentSource.empty()) {
+        return;
+    }
+
+    JsArray primvars;
+    for (const TfToken& primvar : entry._requiredPrimvars) {
+        primvars.emplace_back(primvar.GetString());
+    }
+
+    JsObject renamedParameters;
+    for (const auto& renamed : entry._renamedParameters) {
+        renamedParameters.emplace(renamed.first, JsValue(renamed.second));
+    }
+
+    JsObject object;
+    object[kFormatVersionKey] = JsValue(kCacheFormatVersion);
+    object[kDescriptionKey] = JsValue(description);
+    object[kFragmentNameKey] = JsValue(entry._fragmentName);
+    object[kFragmentSourceKey] = JsValue(entry._fragmentSource);
+    object[kPrimvarsKey] = JsValue(primvars);
+    object[kRenamedParametersKey] = JsValue(renamedParameters);
+
+    const std::string content = JsWriteToString(JsValue(object));
+
+    // Write to a temporary file first so that other Maya sessions sharing the cache never read a
+    // partially written entry.
+    static std::atomic<unsigned> sTempCounter { 0 };
+    const std::string            path = _GetEntryPath(description);
+    const std::string            tempPath = TfStringPrintf(
+        "%s.%zx.%u.tmp",
+        path.c_str(),
+        std::hash<std::thread::id>()(std::this_thread::get_id()),
+        sTempCounter++);
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(content.data(), content.size())) {
+            return;
+        }
+    }
+
+    // An existing entry is replaced, so its size no longer counts towards the cache size.
+    std::error_code ec;
+    const auto      previousSize = ghc::filesystem::file_size(path, ec);
+    const bool      replaced = !ec;
+
+    ghc::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        ghc::filesystem::remove(tempPath, ec);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_stats._writes;
+    if (!_sizeKnown) {
+        _ComputeSize();
+    } else {
+        if (replaced) {
+            _stats._sizeInBytes -= std::min(static_cast<size_t>(previousSize), _stats._sizeInBytes);
+        }
+        _stats._sizeInBytes += content.size();
+    }
+    if (_stats._sizeInBytes > _maxSizeInBytes) {
+        _Evict();
+    }
+}
+
+HdVP2FragmentDiskCache::Stats HdVP2FragmentDiskCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+void HdVP2FragmentDiskCache::_ComputeSize()
+{
+    _stats._sizeInBytes = 0;
+
+    std::error_code ec;
+    for (ghc::filesystem::directory_iterator it(_folder, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        if (it->path().extension() == kEntryExtension) {
+            std::error_code sizeEc;
+            const auto      size = ghc::filesystem::file_size(it->path(), sizeEc);
+            if (!sizeEc) {
+                _stats._sizeInBytes += size;
+            }
+        }
+    }
+    _sizeKnown = true;
+}
+
+void HdVP2FragmentDiskCache::_Evict()
+{
+    struct CachedFile
+    {
+        ghc::filesystem::path           _path;
+        ghc::filesystem::file_time_type _time;
+        std::uintmax_t                  _size;
+    };
+    std::vector<CachedFile> files;
+
+    // Other sessions may share the folder, so start from what is actually on disk.
+    std::error_code ec;
+    for (ghc::filesystem::directory_iterator it(_folder, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        if (it->path().extension() != kEntryExtension) {
+            continue;
+        }
+        std::error_code fileEc;
+        CachedFile      file { it->path(),
+                          ghc::filesystem::last_write_time(it->path(), fileEc),
+                          ghc::filesystem::file_size(it->path(), fileEc) };
+        if (!fileEc) {
+            files.push_back(file);
+        }
+    }
+
+    std::sort(files.begin(), files.end(), [](const CachedFile& a, const CachedFile& b) {
+        return a._time < b._time;
+    });
+
+    std::uintmax_t totalSize = 0;
+    for (const CachedFile& file : files) {
+        totalSize += file._size;
+    }
+
+    // Evict down to three quarters of the limit to avoid evicting on every write.
+    const std::uintmax_t targetSize = _maxSizeInBytes / 4 * 3;
+    for (const CachedFile& file : files) {
+        if (totalSize <= targetSize) {
+            break;
+        }
+        std::error_code removeEc;
+        if (ghc::filesystem::remove(file._path, removeEc)) {
+            totalSize -= file._size;
+            ++_stats._evictions;
+        }
+    }
+
+    _stats._sizeInBytes = totalSize;
+    TF_DEBUG(HDVP2_DEBUG_MATERIAL)
+        .Msg(
+            "Fragment cache evicted down to %zu bytes (%zu evictions)\n",
+            _stats._sizeInBytes,
+            _stats._evictions);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_FRAGMENT_DISK_CACHE
+#define HD_VP2_FRAGMENT_DISK_CACHE
+
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Persistent cache of the OGS fragments generated for MaterialX networks.
+    \class  HdVP2FragmentDiskCache
+
+    Generating the OGS fragment of a MaterialX network is much more expensive than having VP2
+    compile it, and the result only depends on the network and on the environment used to generate
+    it. This cache stores the generated fragment and its companion data on disk so that later
+    sessions can skip the generation entirely.
+
+    Entries are content addressed: the key is a hash of the network description combined with the
+    MaterialX library version, the specular environment key and the color management settings.
+    Each entry is a small JSON file. The total size of the cache is bounded, the least recently
+    used entries being evicted first.
+
+    The cache is stored in the folder given by the MAYAUSD_VP2_FRAGMENT_CACHE_DIR environment
+    variable, and is disabled when it is not set: the cached fragments are compiled by VP2, so
+    they must not be read from a location other users can write to. Setting
+    MAYAUSD_VP2_FRAGMENT_CACHE_MAX_SIZE_MB to 0 also disables it.
+*/
+class HdVP2FragmentDiskCache
+{
+public:
+    //! Data needed to create a shader instance without generating the fragment.
+    struct Entry
+    {
+        std::string   _fragmentName;     //!< Name of the generated fragment
+        std::string   _fragmentSource;   //!< OGS XML source of the generated fragment
+        TfTokenVector _requiredPrimvars; //!< Primvars required by the fragment vertex stage
+        std::unordered_map<std::string, std::string>
+            _renamedParameters; //!< Parameters renamed to avoid reserved keywords
+    };
+
+    //! Usage counters since the start of the session.
+    struct Stats
+    {
+        size_t _hits { 0 };        //!< Lookups that found a valid entry
+        size_t _misses { 0 };      //!< Lookups that did not find a valid entry
+        size_t _writes { 0 };      //!< Entries added to the cache
+        size_t _evictions { 0 };   //!< Entries removed to keep the cache under its size limit
+        size_t _sizeInBytes { 0 }; //!< Current size of the cache on disk
+    };
+
+    static HdVP2FragmentDiskCache& GetInstance();
+
+    //! Whether the cache can be used.
+    bool IsEnabled() const { return _enabled; }
+
+    /*! \brief  Reads the entry stored for a network.
+
+        \param description A description which uniquely identifies the generated code, for
+                           example the serialized network followed by the generation settings.
+        \param entry       Receives the stored data.
+        \return False if no valid entry was found.
+     */
+    bool Load(const std::string& description, Entry& entry);
+
+    //! Stores the entry of a network and evicts old entries if the cache gets too large.
+    void Store(const std::string& description, const Entry& entry);
+
+    Stats GetStats() const;
+
+private:
+    HdVP2FragmentDiskCache();
+    ~HdVP2FragmentDiskCache() = default;
+
+    std::string _GetEntryPath(const std::string& description) const;
+    void        _ComputeSize();
+    void        _Evict();
+
+    std::string        _folder;          //!< Folder where entries are stored
+    std::uintmax_t     _maxSizeInBytes;  //!< Size above which entries get evicted
+    bool               _enabled { false };
+    bool               _sizeKnown { false };
+    mutable std::mutex _mutex;
+    Stats              _stats;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_FRAGMENT_DISK_CACHE
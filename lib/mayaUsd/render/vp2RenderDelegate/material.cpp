@@ -16,6 +16,7 @@
 #include "material.h"
 
 #include "debugCodes.h"
+#include "fragmentDiskCache.h"
 #include "pxr/usd/sdr/registry.h"
 #include "pxr/usd/sdr/shaderNode.h"
 #include "renderDelegate.h"
@@ -33,9 +34,11 @@
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/getenv.h>
 #include <pxr/base/tf/pathUtils.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/imaging/hd/renderIndex.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
 
 #ifdef WANT_MATERIALX_BUILD
@@ -74,6 +77,7 @@
 #endif
 
 #include <MaterialXCore/Document.h>
+#include <MaterialXCore/Util.h>
 #include <MaterialXFormat/File.h>
 #include <MaterialXFormat/Util.h>
 #include <MaterialXGenGlsl/GlslShaderGenerator.h>
@@ -90,11 +94,16 @@
 #include <boost/functional/hash.hpp>
 #endif
 #include <ghc/filesystem.hpp>
+#include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
 
+#include <algorithm>
+#include <deque>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -391,6 +400,42 @@ struct _MaterialXData
                 "Caught exception '%s' while initializing MaterialX library", e.what());
         }
     }
+    //! Returns the library the material documents are created from: the MaterialX library,
+    //! along with the OCIO library when color management is supported. The combined library is
+    //! passed to every material document and must not be modified. It is created again when
+    //! OCIO nodes were registered, or when the lobe pruner added optimized definitions to the
+    //! MaterialX library, since the last call.
+    //!
+    //! Only the combination of the libraries is shared: each material document still holds a
+    //! copy of the combined library, which HdMtlxCreateMtlxDocumentFromHdNetwork imports in the
+    //! document it creates.
+    MaterialX::DocumentPtr GetCompleteLibrary()
+    {
+#ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
+        mx::DocumentPtr ocioLibrary = MaterialXMaya::OgsFragment::getOCIOLibrary();
+        const size_t    ocioLibrarySize = ocioLibrary ? ocioLibrary->getChildren().size() : 0;
+#if MX_COMBINED_VERSION >= 13808
+        const size_t prunerGeneration = _lobePruner ? _lobePruner->getLibraryGeneration() : 0;
+#else
+        const size_t prunerGeneration = 0;
+#endif
+
+        std::lock_guard<std::mutex> lock(_completeLibraryMutex);
+        if (!_completeLibrary || ocioLibrarySize != _completeLibraryOCIOSize
+            || prunerGeneration != _completeLibraryPrunerGeneration) {
+            mx::DocumentPtr completeLibrary = mx::createDocument();
+            completeLibrary->importLibrary(_mtlxLibrary);
+            completeLibrary->importLibrary(ocioLibrary);
+            _completeLibrary = completeLibrary;
+            _completeLibraryOCIOSize = ocioLibrarySize;
+            _completeLibraryPrunerGeneration = prunerGeneration;
+        }
+        return _completeLibrary;
+#else
+        return _mtlxLibrary;
+#endif
+    }
+
     MaterialX::FileSearchPath _mtlxSearchPath; //!< MaterialX library search path
     MaterialX::DocumentPtr    _mtlxLibrary;    //!< MaterialX library
     std::string               _mainUvSetName;  //!< Main UV set name
@@ -399,6 +444,13 @@ struct _MaterialXData
 #endif
 
 private:
+#ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
+    std::mutex             _completeLibraryMutex;
+    MaterialX::DocumentPtr _completeLibrary;                     //!< MaterialX and OCIO libraries
+    size_t                 _completeLibraryOCIOSize = 0;         //!< OCIO library size
+    size_t                 _completeLibraryPrunerGeneration = 0; //!< Lobe pruner generation
+#endif
+
     void _FixLibraryTangentInputs(MaterialX::DocumentPtr& mtlxLibrary);
 #if MX_COMBINED_VERSION >= 13900
     void _RemovePreviewSurfaceEmbeddedNormalmap(MaterialX::DocumentPtr& mtlxLibrary);
@@ -414,6 +466,39 @@ _MaterialXData& _GetMaterialXData()
     return *materialXData;
 }
 
+//! Describes everything the OGS fragment generated for a MaterialX network depends on, to be used
+//! as key of the persistent fragment cache.
+#if !defined(MAYAUSD_VERSION)
+#error "MAYAUSD_VERSION is not defined"
+#endif
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x)  STRINGIFY(x)
+
+//! Version of the OGS fragments generated by MaterialXGenOgsXml. Increment it when a change to
+//! the OgsXmlGenerator or the GlslFragmentGenerator modifies the generated fragments without
+//! changing the maya-usd version, so that the fragments cached on disk are not reused.
+constexpr int kFragmentGeneratorVersion = 1;
+
+std::string _GetFragmentDescription(const std::string& networkDescription)
+{
+    std::string description = networkDescription;
+    description += "\nMayaUsd:" TOSTRING(MAYAUSD_VERSION);
+    description += "\nFragmentGenerator:" + std::to_string(kFragmentGeneratorVersion);
+    description += "\nMaterialX:" + mx::getVersionString();
+    description += "\nMaya:" + std::to_string(MAYA_API_VERSION);
+    description += "\nPrimaryUVSet:" + _GetMaterialXData()._mainUvSetName;
+#ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
+    if (MayaUsd::ColorManagementPreferences::Active()) {
+        description += "\nOCIOConfig:";
+        description += MayaUsd::ColorManagementPreferences::ConfigFilePath().asChar();
+        description += "\nRenderingSpace:";
+        description += MayaUsd::ColorManagementPreferences::RenderingSpaceName().asChar();
+    }
+#endif
+    return description;
+}
+
 //! Return true if that node parameter has topological impact on the generated code.
 //
 // Swizzle and geompropvalue nodes are known to have an attribute that affects
@@ -649,6 +734,47 @@ std::string _GenerateXMLString(const HdMaterialNetwork2& materialNetwork)
     return result.str();
 }
 
+//! Helper function to generate a shader cache key from the nodes and relationships in the
+//! specified material network. Covers the same information as _GenerateXMLString() without
+//! serializing the network.
+HdVP2ShaderCacheKey _GenerateShaderCacheKey(const HdMaterialNetwork2& materialNetwork)
+{
+    HdVP2ShaderCacheKey key;
+
+    if (ARCH_LIKELY(!materialNetwork.nodes.empty())) {
+        key.Append(static_cast<uint64_t>(materialNetwork.terminals.size()));
+        for (const auto& c : materialNetwork.terminals) {
+            key.Append(c.first);
+            key.Append(c.second.upstreamNode.GetString());
+        }
+
+        key.Append(static_cast<uint64_t>(materialNetwork.nodes.size()));
+        for (const auto& nodePair : materialNetwork.nodes) {
+            const auto& node = nodePair.second;
+            key.Append(nodePair.first.GetString());
+            key.Append(node.nodeTypeId);
+
+            key.Append(static_cast<uint64_t>(node.parameters.size()));
+            for (auto const& p : node.parameters) {
+                key.Append(p.first);
+                key.Append(p.second);
+            }
+
+            key.Append(static_cast<uint64_t>(node.inputConnections.size()));
+            for (auto const& i : node.inputConnections) {
+                key.Append(i.first);
+                key.Append(static_cast<uint64_t>(i.second.size()));
+                for (auto const& c : i.second) {
+                    key.Append(c.upstreamNode.GetString());
+                    key.Append(c.upstreamOutputName);
+                }
+            }
+        }
+    }
+
+    return key;
+}
+
 // MaterialX FA nodes will "upgrade" the in2 uniform to whatever the vector type it needs for its
 // arithmetic operation. So we need to "upgrade" the value we want to set as well.
 //
@@ -1146,6 +1272,183 @@ void _AddMissingBitangents(mx::DocumentPtr& mtlxDoc)
 
 #endif
 
+//! Generates the OGS fragment of the surface of a MaterialX network, anonymized by
+//! _ApplyMtlxVP2Fixes(). Fragments of independent networks can be generated concurrently: the
+//! MaterialX library is only read, and the primary UV set name of the OGS XML generator must be
+//! set by the caller beforehand. Returns false if no fragment could be generated.
+bool _GenerateMaterialXFragment(
+    const SdfPath&                 materialId,
+    const HdMaterialNetwork2&      fixedNetwork,
+    HdVP2FragmentDiskCache::Entry& fragment)
+{
+    const auto terminalIt = fixedNetwork.terminals.find(HdMaterialTerminalTokens->surface);
+    if (terminalIt == fixedNetwork.terminals.end()) {
+        return false;
+    }
+    const SdfPath& fixedPath = terminalIt->second.upstreamNode;
+    const auto     nodeIt = fixedNetwork.nodes.find(fixedPath);
+    if (nodeIt == fixedNetwork.nodes.end()) {
+        return false;
+    }
+    const HdMaterialNode2& surfTerminal = nodeIt->second;
+
+    try {
+        // The HdMtlxCreateMtlxDocumentFromHdNetwork function can throw if any MaterialX error
+        // is raised.
+
+        // Check if the Terminal is a MaterialX Node
+        SdrRegistry&                sdrRegistry = SdrRegistry::GetInstance();
+        const SdrShaderNodeConstPtr mtlxSdrNode = sdrRegistry.GetShaderNodeByIdentifierAndType(
+            surfTerminal.nodeTypeId, HdVP2Tokens->mtlx);
+
+        mx::DocumentPtr           mtlxDoc;
+        const mx::FileSearchPath& crLibrarySearchPath(_GetMaterialXData()._mtlxSearchPath);
+#if MX_COMBINED_VERSION >= 13808
+        if (mtlxSdrNode
+            || _GetMaterialXData()._lobePruner->isOptimizedNodeId(surfTerminal.nodeTypeId)) {
+#else
+        if (mtlxSdrNode) {
+#endif
+
+            // HdMtlxCreateMtlxDocumentFromHdNetwork copies the library in the document it
+            // creates, so this is not avoided, but the combined library itself is only created
+            // when it changed.
+            mx::DocumentPtr completeLibrary = _GetMaterialXData().GetCompleteLibrary();
+
+            // Create the MaterialX Document from the HdMaterialNetwork
+#if PXR_VERSION > 2111
+            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
+                fixedNetwork,
+                surfTerminal, // MaterialX HdNode
+                fixedPath,
+                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
+                completeLibrary);
+#else
+            std::set<SdfPath> hdTextureNodes;
+            mx::StringMap mxHdTextureMap; // Mx-Hd texture name counterparts
+            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
+                fixedNetwork,
+                surfTerminal, // MaterialX HdNode
+                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
+                completeLibrary,
+                &hdTextureNodes,
+                &mxHdTextureMap);
+#endif
+
+            if (!mtlxDoc) {
+                return false;
+            }
+
+            // Touchups required to fix input stream issues:
+            _AddMissingTangents(mtlxDoc);
+#if MX_COMBINED_VERSION >= 13900
+            _AddMissingBitangents(mtlxDoc);
+#endif
+
+            if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
+                std::cout << "generated shader code for " << materialId.GetText() << ":\n";
+                std::cout << "Generated graph\n==============================\n";
+                mx::writeToXmlStream(mtlxDoc, std::cout);
+                std::cout << "\n==============================\n";
+            }
+        } else {
+            return false;
+        }
+
+        mx::NodePtr materialNode;
+        for (const mx::NodePtr& material : mtlxDoc->getMaterialNodes()) {
+            if (material->getName() == _mtlxTokens->USD_Mtlx_VP2_Material.GetText()) {
+                materialNode = material;
+            }
+        }
+
+        if (!materialNode) {
+            return false;
+        }
+
+        MaterialXMaya::OgsFragment ogsFragment(materialNode, crLibrarySearchPath);
+
+        fragment._fragmentName = ogsFragment.getFragmentName();
+        fragment._fragmentSource = ogsFragment.getFragmentSource();
+
+        // Explore the fragment for primvars:
+        mx::ShaderPtr            shader = ogsFragment.getShader();
+        const mx::VariableBlock& vertexInputs
+            = shader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
+        for (size_t i = 0; i < vertexInputs.size(); ++i) {
+            const mx::ShaderPort* variable = vertexInputs[i];
+            // Position is always assumed.
+            // Tangent will be generated in the vertex shader using a utility fragment
+            if (variable->getName() == mx::HW::T_IN_NORMAL) {
+                fragment._requiredPrimvars.push_back(HdTokens->normals);
+            }
+        }
+
+        // Remember inputs that were renamed because they conflicted with reserved keywords:
+        for (const auto& namePair : ogsFragment.getPathInputMap()) {
+            std::string path = namePair.first;
+            std::string input = namePair.second;
+            // Renaming adds digits at the end, so only compare the backs.
+            if (path.back() != input.back()) {
+                // If a digit was added, we should be able to find the last path element inside
+                // the input name:
+                size_t      lastSlash = path.rfind("/");
+                std::string originalName = path;
+                if (lastSlash != std::string::npos) {
+                    originalName = path.substr(lastSlash + 1);
+                }
+                size_t foundOriginal = input.find(originalName);
+                if (foundOriginal != std::string::npos) {
+                    std::string uniqueName = input;
+                    input = input.substr(0, foundOriginal + originalName.size());
+                    fragment._renamedParameters.emplace(input, uniqueName);
+                }
+            }
+        }
+    } catch (mx::Exception& e) {
+        TF_RUNTIME_ERROR(
+            "Caught exception '%s' while processing '%s'", e.what(), materialId.GetText());
+        return false;
+    }
+    return true;
+}
+
+//! Fragments generated by HdVP2Material::PrepareMaterialXFragments() ahead of the sync of their
+//! materials, by shader cache key. A fragment that failed to generate is kept with an empty name,
+//! so that the sync does not try again. Only accessed from the main thread.
+class _PregeneratedFragments
+{
+public:
+    static _PregeneratedFragments& GetInstance()
+    {
+        static _PregeneratedFragments instance;
+        return instance;
+    }
+
+    void Add(const HdVP2ShaderCacheKey& key, HdVP2FragmentDiskCache::Entry&& fragment)
+    {
+        _fragments.emplace(key, std::move(fragment));
+    }
+
+    bool Contains(const HdVP2ShaderCacheKey& key) const { return _fragments.count(key) > 0; }
+
+    bool Take(const HdVP2ShaderCacheKey& key, HdVP2FragmentDiskCache::Entry& fragment)
+    {
+        auto it = _fragments.find(key);
+        if (it == _fragments.end()) {
+            return false;
+        }
+        fragment = std::move(it->second);
+        _fragments.erase(it);
+        return true;
+    }
+
+    void Clear() { _fragments.clear(); }
+
+private:
+    HdVP2ShaderCache::KeyMap<HdVP2FragmentDiskCache::Entry> _fragments;
+};
+
 #endif // WANT_MATERIALX_BUILD
 
 #if PXR_VERSION <= 2211
@@ -1296,6 +1599,46 @@ std::string _GenerateXMLString(const HdMaterialNetwork& materialNetwork, bool in
     return result;
 }
 
+//! Helper function to generate a shader cache key from the nodes, relationships and primvars in
+//! the specified material network. Covers the same information as _GenerateXMLString() without
+//! serializing the network.
+HdVP2ShaderCacheKey
+_GenerateShaderCacheKey(const HdMaterialNetwork& materialNetwork, bool includeParams = true)
+{
+    HdVP2ShaderCacheKey key;
+
+    if (ARCH_LIKELY(!materialNetwork.nodes.empty())) {
+        key.Append(static_cast<uint64_t>(materialNetwork.nodes.size()));
+        for (const HdMaterialNode& node : materialNetwork.nodes) {
+            key.Append(node.path.GetString());
+            key.Append(node.identifier);
+
+            if (includeParams) {
+                key.Append(static_cast<uint64_t>(node.parameters.size()));
+                for (auto const& parameter : node.parameters) {
+                    key.Append(parameter.first);
+                    key.Append(parameter.second);
+                }
+            }
+        }
+
+        key.Append(static_cast<uint64_t>(materialNetwork.relationships.size()));
+        for (const HdMaterialRelationship& rel : materialNetwork.relationships) {
+            key.Append(rel.inputId.GetString());
+            key.Append(rel.inputName);
+            key.Append(rel.outputId.GetString());
+            key.Append(rel.outputName);
+        }
+
+        key.Append(static_cast<uint64_t>(materialNetwork.primvars.size()));
+        for (TfToken const& primvar : materialNetwork.primvars) {
+            key.Append(primvar);
+        }
+    }
+
+    return key;
+}
+
 #ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
 void _AddColorManagementFragments(HdMaterialNetwork& net)
 {
@@ -1729,8 +2072,12 @@ MHWRender::MSamplerStateDesc _GetSamplerStateDesc(const HdMaterialNode& node)
     return desc;
 }
 
-MHWRender::MTexture*
-_LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& uvScaleOffset)
+MHWRender::MTexture* _LoadUdimTexture(
+    const std::string& path,
+    const std::string& textureName,
+    int                maxResolution,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset)
 {
     /*
         For this method to work path needs to be an absolute file path, not an asset path.
@@ -1761,7 +2108,7 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
         return nullptr;
     }
 
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
+    MHWRender::MTexture* texture = textureMgr->findTexture(textureName.c_str());
     if (texture) {
         return texture;
     }
@@ -1798,15 +2145,21 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
         int maxTileId = std::get<0>(tiles.back());
         int maxU = maxTileId % 10;
         int maxV = (maxTileId - maxU) / 10;
-        if ((tileWidth * maxU > maxWidth) || (tileHeight * maxV > maxHeight))
+
+        // Let VP2 downscale the tiles when the viewport texture resolution is limited.
+        if (maxResolution > 0) {
+            maxWidth = std::min(maxWidth, static_cast<unsigned int>(maxResolution * (maxU + 1)));
+            maxHeight = std::min(maxHeight, static_cast<unsigned int>(maxResolution * (maxV + 1)));
+        } else if ((tileWidth * maxU > maxWidth) || (tileHeight * maxV > maxHeight)) {
             TF_WARN(
                 "UDIM texture %s creates a tiled texture larger than the maximum texture size. Some"
                 "resolution will be lost.",
                 path.c_str());
+        }
     }
 
-    MString textureName(
-        path.c_str()); // used for caching, using the string with <UDIM> in it is fine
+    // used for caching, using the string with <UDIM> in it is fine
+    MString      tiledTextureName(textureName.c_str());
     MStringArray tilePaths;
     MFloatArray  tilePositions;
     for (auto& tile : tiles) {
@@ -1835,7 +2188,7 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
     MColor       undefinedColor(0.0f, 1.0f, 0.0f, 1.0f);
     MStringArray failedTilePaths;
     texture = textureMgr->acquireTiledTexture(
-        textureName,
+        tiledTextureName,
         tilePaths,
         tilePositions,
         undefinedColor,
@@ -1877,40 +2230,165 @@ MHWRender::MTexture* _GenerateFallbackTexture(
     return textureMgr->acquireTexture(path.c_str(), desc, texels.data());
 }
 
-//! Load texture from the specified path
-MHWRender::MTexture* _LoadTexture(
-    const std::string& path,
-    bool               hasFallbackColor,
-    const GfVec4f&     fallbackColor,
-    bool&              isColorSpaceSRGB,
-    MFloatArray&       uvScaleOffset)
+//! Result of decoding a texture file into texels that VP2 can consume directly.
+struct _DecodedTexture
 {
-    MProfilingScope profilingScope(
-        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
+    MHWRender::MTextureDescription _desc;                       //!< VP2 texture description
+    std::vector<unsigned char>     _texels;                     //!< Texels matching _desc
+    bool                           _isColorSpaceSRGB { false }; //!< Needs sRGB linearization
+};
 
-    // If it is a UDIM texture we need to modify the path before calling OpenForReading
-    if (HdStIsSupportedUdimTexture(path))
-        return _LoadUdimTexture(path, isColorSpaceSRGB, uvScaleOffset);
+//! Status of a texture decode.
+enum class _DecodeStatus
+{
+    kDecoded,    //!< Texels are ready for upload
+    kOpenFailed, //!< The image could not be opened, a fallback texture may be used
+    kFailed      //!< The image could not be read or has an unsupported format
+};
 
-    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
-    MHWRender::MTextureManager* const textureMgr
-        = renderer ? renderer->getTextureManager() : nullptr;
-    if (!TF_VERIFY(textureMgr)) {
-        return nullptr;
+//! Returns the number of times the resolution must be halved to fit in maxResolution.
+int _ComputeTextureLod(int width, int height, int maxResolution)
+{
+    int lod = 0;
+    if (maxResolution > 0) {
+        while ((width > maxResolution || height > maxResolution) && (width > 1 || height > 1)) {
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+            ++lod;
+        }
     }
+    return lod;
+}
 
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
-    if (texture) {
-        return texture;
+//! Name under which a texture loaded with the given resolution limit is cached.
+std::string _GetTextureCacheKey(const std::string& path, int maxResolution)
+{
+    return maxResolution > 0 ? TfStringPrintf("%s?maxResolution=%d", path.c_str(), maxResolution)
+                             : path;
+}
+
+//! Converts a texel component to float for filtering.
+inline float _ToFloat(uint8_t value) { return static_cast<float>(value); }
+inline float _ToFloat(GfHalf value) { return static_cast<float>(value); }
+inline float _ToFloat(float value) { return value; }
+
+//! Converts a filtered value back to a texel component.
+template <typename T> T _FromFloat(float value);
+template <> inline uint8_t _FromFloat<uint8_t>(float value)
+{
+    return static_cast<uint8_t>(value + 0.5f);
+}
+template <> inline GfHalf _FromFloat<GfHalf>(float value) { return GfHalf(value); }
+template <> inline float  _FromFloat<float>(float value) { return value; }
+
+/*! \brief  Halves the resolution of the texels with a 2x2 box filter.
+
+    The inner loop works on contiguous components with no branches so that compilers vectorize
+    it, and rows are filtered in parallel.
+ */
+template <typename T, int NumChannels>
+void _BoxDownsample(
+    const std::vector<unsigned char>& src,
+    int                               width,
+    int                               height,
+    std::vector<unsigned char>&       dst,
+    int                               dstWidth,
+    int                               dstHeight)
+{
+    dst.resize(size_t(dstWidth) * dstHeight * NumChannels * sizeof(T));
+
+    const T* srcTexels = reinterpret_cast<const T*>(src.data());
+    T*       dstTexels = reinterpret_cast<T*>(dst.data());
+
+    tbb::parallel_for(tbb::blocked_range<int>(0, dstHeight), [&](const tbb::blocked_range<int>& r) {
+        for (int y = r.begin(); y < r.end(); ++y) {
+            // Odd sizes repeat the last row or column.
+            const size_t y0 = std::min(2 * y, height - 1);
+            const size_t y1 = std::min(2 * y + 1, height - 1);
+            const T*     row0 = srcTexels + y0 * width * NumChannels;
+            const T*     row1 = srcTexels + y1 * width * NumChannels;
+            T*           out = dstTexels + size_t(y) * dstWidth * NumChannels;
+
+            for (int x = 0; x < dstWidth; ++x) {
+                const int x0 = std::min(2 * x, width - 1) * NumChannels;
+                const int x1 = std::min(2 * x + 1, width - 1) * NumChannels;
+                for (int c = 0; c < NumChannels; ++c) {
+                    const float sum = _ToFloat(row0[x0 + c]) + _ToFloat(row0[x1 + c])
+                        + _ToFloat(row1[x0 + c]) + _ToFloat(row1[x1 + c]);
+                    out[x * NumChannels + c] = _FromFloat<T>(sum * 0.25f);
+                }
+            }
+        }
+    });
+}
+
+/*! \brief  Reduces the decoded texels by the given number of levels of detail.
+ */
+void _DownsampleTexture(_DecodedTexture& decoded, int lod)
+{
+    MHWRender::MTextureDescription& desc = decoded._desc;
+
+    int                        width = desc.fWidth;
+    int                        height = desc.fHeight;
+    std::vector<unsigned char> downsampled;
+
+    for (int level = 0; level < lod && (width > 1 || height > 1); ++level) {
+        const int dstWidth = std::max(1, width / 2);
+        const int dstHeight = std::max(1, height / 2);
+
+        switch (desc.fFormat) {
+        case MHWRender::kR8G8B8A8_UNORM:
+            _BoxDownsample<uint8_t, 4>(
+                decoded._texels, width, height, downsampled, dstWidth, dstHeight);
+            break;
+        case MHWRender::kR16G16B16A16_FLOAT:
+            _BoxDownsample<GfHalf, 4>(
+                decoded._texels, width, height, downsampled, dstWidth, dstHeight);
+            break;
+        case MHWRender::kR32G32B32_FLOAT:
+            _BoxDownsample<float, 3>(
+                decoded._texels, width, height, downsampled, dstWidth, dstHeight);
+            break;
+        case MHWRender::kR32G32B32A32_FLOAT:
+            _BoxDownsample<float, 4>(
+                decoded._texels, width, height, downsampled, dstWidth, dstHeight);
+            break;
+        default: return;
+        }
+
+        decoded._texels.swap(downsampled);
+        desc.fBytesPerRow = desc.fBytesPerRow / width * dstWidth;
+        desc.fBytesPerSlice = desc.fBytesPerRow * dstHeight;
+        desc.fWidth = width = dstWidth;
+        desc.fHeight = height = dstHeight;
     }
+}
 
+/*! \brief  Reads the specified image and converts its pixels to a format supported by VP2.
+
+    When maxResolution is positive, the largest mip level of the file that fits is read. If the
+    file does not provide such a level, the texels are downsampled on the CPU.
+
+    This function only relies on HioImage and plain CPU loops, it does not touch any Maya or VP2
+    API and is therefore safe to call from worker threads.
+ */
+_DecodeStatus
+_DecodeTexture(const std::string& path, int maxResolution, _DecodedTexture& decoded)
+{
     HioImageSharedPtr image = HioImage::OpenForReading(path);
     if (!TF_VERIFY(image, "Unable to create an image from %s", path.c_str())) {
-        if (!hasFallbackColor) {
-            return nullptr;
+        return _DecodeStatus::kOpenFailed;
+    }
+
+    int lod = _ComputeTextureLod(image->GetWidth(), image->GetHeight(), maxResolution);
+    if (lod > 0) {
+        const int mip = std::min(lod, image->GetNumMipLevels() - 1);
+        if (mip > 0) {
+            if (HioImageSharedPtr mipImage = HioImage::OpenForReading(path, 0, mip)) {
+                image = mipImage;
+            }
         }
-        // Create a 1x1 texture of the fallback color, if it was specified:
-        return _GenerateFallbackTexture(textureMgr, path, fallbackColor);
+        lod = _ComputeTextureLod(image->GetWidth(), image->GetHeight(), maxResolution);
     }
 
     // This image is used for loading pixel data from usdz only and should
@@ -1931,16 +2409,18 @@ MHWRender::MTexture* _LoadTexture(
     spec.data = storage.data();
 
     if (!image->Read(spec)) {
-        return nullptr;
+        return _DecodeStatus::kFailed;
     }
 
-    MHWRender::MTextureDescription desc;
+    MHWRender::MTextureDescription& desc = decoded._desc;
     desc.setToDefault2DTexture();
     desc.fWidth = spec.width;
     desc.fHeight = spec.height;
     desc.fBytesPerRow = bytesPerRow;
     desc.fBytesPerSlice = bytesPerSlice;
 
+    std::vector<unsigned char>& texels = decoded._texels;
+
     auto specFormat = spec.format;
     switch (specFormat) {
     // Single Channel
@@ -1952,7 +2432,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_RGB32;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint32_t* texels32 = (uint32_t*)texels.data();
         uint32_t* storage32 = (uint32_t*)storage.data();
@@ -1963,8 +2443,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels32++ = pixel;
             *texels32++ = pixel;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
     } break;
     case HioFormatFloat16: {
         // We want white instead or red when expanding to RGB, so convert to kR16G16B16A16_FLOAT
@@ -1974,7 +2452,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_8;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         GfHalf         opaqueAlpha(1.0f);
         const uint16_t alphaBits = opaqueAlpha.bits();
@@ -1989,8 +2467,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels16++ = pixel;
             *texels16++ = alphaBits;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
     } break;
     case HioFormatUNorm8: {
         // We want white instead or red when expanding to RGB, so convert to kR8G8B8A8_UNORM
@@ -2000,7 +2476,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_4;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint8_t* texels8 = (uint8_t*)texels.data();
         uint8_t* storage8 = (uint8_t*)storage.data();
@@ -2013,8 +2489,7 @@ MHWRender::MTexture* _LoadTexture(
             *texels8++ = 0xFF;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
     } break;
 
     // Dual channel (quite rare, but seen with mono + alpha files)
@@ -2026,7 +2501,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_RGBA32;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint32_t* texels32 = (uint32_t*)texels.data();
         uint32_t* storage32 = (uint32_t*)storage.data();
@@ -2038,8 +2513,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels32++ = pixel;
             *texels32++ = *storage32++;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
     } break;
     case HioFormatFloat16Vec2: {
         // R16G16 is not supported by VP2. Converted to R16G16B16A16.
@@ -2049,7 +2522,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_8;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint16_t* texels16 = (uint16_t*)texels.data();
         uint16_t* storage16 = (uint16_t*)storage.data();
@@ -2061,8 +2534,6 @@ MHWRender::MTexture* _LoadTexture(
             *texels16++ = pixel;
             *texels16++ = *storage16++;
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
         break;
     }
     case HioFormatUNorm8Vec2:
@@ -2074,7 +2545,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_4;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         uint8_t* texels8 = (uint8_t*)texels.data();
         uint8_t* storage8 = (uint8_t*)storage.data();
@@ -2087,15 +2558,14 @@ MHWRender::MTexture* _LoadTexture(
             *texels8++ = *storage8++;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 3-Channel
     case HioFormatFloat32Vec3:
         desc.fFormat = MHWRender::kR32G32B32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        texels = std::move(storage);
         break;
     case HioFormatFloat16Vec3: {
         // R16G16B16 is not supported by VP2. Converted to R16G16B16A16.
@@ -2110,7 +2580,7 @@ MHWRender::MTexture* _LoadTexture(
         const unsigned char  lowAlpha = reinterpret_cast<const unsigned char*>(&alphaBits)[0];
         const unsigned char  highAlpha = reinterpret_cast<const unsigned char*>(&alphaBits)[1];
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         for (int y = 0; y < spec.height; y++) {
             for (int x = 0; x < spec.width; x++) {
@@ -2125,13 +2595,11 @@ MHWRender::MTexture* _LoadTexture(
                 texels[t * bpp_8 + 7] = highAlpha;
             }
         }
-
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
         break;
     }
     case HioFormatFloat16Vec4:
         desc.fFormat = MHWRender::kR16G16B16A16_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec3:
     case HioFormatUNorm8Vec3srgb: {
@@ -2142,7 +2610,7 @@ MHWRender::MTexture* _LoadTexture(
         desc.fBytesPerRow = spec.width * bpp_4;
         desc.fBytesPerSlice = desc.fBytesPerRow * spec.height;
 
-        std::vector<unsigned char> texels(desc.fBytesPerSlice);
+        texels.resize(desc.fBytesPerSlice);
 
         for (int y = 0; y < spec.height; y++) {
             for (int x = 0; x < spec.width; x++) {
@@ -2154,31 +2622,94 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 4-Channel
     case HioFormatFloat32Vec4:
         desc.fFormat = MHWRender::kR32G32B32A32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec4:
     case HioFormatUNorm8Vec4srgb:
         desc.fFormat = MHWRender::kR8G8B8A8_UNORM;
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        texels = std::move(storage);
         break;
     default:
         TF_WARN(
             "VP2 renderer delegate: unsupported pixel format (%d) in texture file %s.",
             (int)specFormat,
             path.c_str());
-        break;
+        return _DecodeStatus::kFailed;
     }
 
-    return texture;
+    if (lod > 0) {
+        _DownsampleTexture(decoded, lod);
+    }
+
+    return _DecodeStatus::kDecoded;
+}
+
+/*! \brief  Hands decoded texels over to VP2. Must be called from the main thread.
+ */
+MHWRender::MTexture* _UploadTexture(
+    MHWRender::MTextureManager* const textureMgr,
+    const std::string&                path,
+    const _DecodedTexture&            decoded,
+    bool&                             isColorSpaceSRGB)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "UploadTexture",
+        path.c_str());
+
+    isColorSpaceSRGB = decoded._isColorSpaceSRGB;
+    return textureMgr->acquireTexture(path.c_str(), decoded._desc, decoded._texels.data());
+}
+
+//! Load texture from the specified path and register it in VP2 under textureName
+MHWRender::MTexture* _LoadTexture(
+    const std::string& path,
+    const std::string& textureName,
+    int                maxResolution,
+    bool               hasFallbackColor,
+    const GfVec4f&     fallbackColor,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
+
+    // If it is a UDIM texture we need to modify the path before calling OpenForReading
+    if (HdStIsSupportedUdimTexture(path))
+        return _LoadUdimTexture(
+            path, textureName, maxResolution, isColorSpaceSRGB, uvScaleOffset);
+
+    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+    MHWRender::MTextureManager* const textureMgr
+        = renderer ? renderer->getTextureManager() : nullptr;
+    if (!TF_VERIFY(textureMgr)) {
+        return nullptr;
+    }
+
+    MHWRender::MTexture* texture = textureMgr->findTexture(textureName.c_str());
+    if (texture) {
+        return texture;
+    }
+
+    _DecodedTexture decoded;
+    switch (_DecodeTexture(path, maxResolution, decoded)) {
+    case _DecodeStatus::kDecoded:
+        return _UploadTexture(textureMgr, textureName, decoded, isColorSpaceSRGB);
+    case _DecodeStatus::kOpenFailed:
+        // Create a 1x1 texture of the fallback color, if it was specified:
+        return hasFallbackColor ? _GenerateFallbackTexture(textureMgr, textureName, fallbackColor)
+                                : nullptr;
+    default: return nullptr;
+    }
 }
 
 TfToken MayaDescriptorToToken(const MVertexBufferDescriptor& descriptor)
@@ -2218,18 +2749,23 @@ struct MStringHash
 } // anonymous namespace
 
 class HdVP2Material::TextureLoadingTask
+    : public std::enable_shared_from_this<HdVP2Material::TextureLoadingTask>
 {
 public:
     TextureLoadingTask(
         HdVP2Material*     parent,
         HdSceneDelegate*   sceneDelegate,
         const std::string& path,
+        const std::string& textureName,
+        int                maxResolution,
         bool               hasFallbackColor,
         const GfVec4f&     fallbackColor)
         : _parent(parent)
         , _sceneDelegate(sceneDelegate)
         , _path(path)
+        , _textureName(textureName)
         , _fallbackColor(fallbackColor)
+        , _maxResolution(maxResolution)
         , _hasFallbackColor(hasFallbackColor)
     {
     }
@@ -2255,58 +2791,323 @@ public:
         return _fallbackTextureInfo;
     }
 
-    bool EnqueueLoadOnIdle()
+    bool EnqueueLoadOnIdle();
+
+    //! Detaches the task from its material. The task is released by its last owner.
+    void Terminate() { _terminated = true; }
+
+    //! Reads and converts the texels. Called from a worker thread.
+    void Decode()
+    {
+        // UDIM textures are assembled by VP2 itself on the main thread.
+        if (_terminated || HdStIsSupportedUdimTexture(_path)) {
+            return;
+        }
+
+        MProfilingScope profilingScope(
+            HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorD_L2,
+            "DecodeTexture",
+            _path.c_str());
+
+        _decodeStatus = _DecodeTexture(_path, _maxResolution, _decoded);
+    }
+
+    //! Size in bytes of the decoded texels waiting to be uploaded.
+    size_t GetDecodedSize() const { return _decoded._texels.size(); }
+
+    //! Hands the decoded texels over to VP2. Called from the main thread.
+    void Upload()
+    {
+        if (_terminated) {
+            return;
+        }
+
+        bool                 isSRGB = false;
+        MFloatArray          uvScaleOffset;
+        MHWRender::MTexture* texture = nullptr;
+
+        if (HdStIsSupportedUdimTexture(_path)) {
+            texture = _LoadUdimTexture(_path, _textureName, _maxResolution, isSRGB, uvScaleOffset);
+        } else {
+            MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+            MHWRender::MTextureManager* const textureMgr
+                = renderer ? renderer->getTextureManager() : nullptr;
+            // Another material may have loaded the same file while this one was decoding.
+            texture
+                = TF_VERIFY(textureMgr) ? textureMgr->findTexture(_textureName.c_str()) : nullptr;
+            if (!texture && textureMgr) {
+                switch (_decodeStatus) {
+                case _DecodeStatus::kDecoded:
+                    texture = _UploadTexture(textureMgr, _textureName, _decoded, isSRGB);
+                    break;
+                case _DecodeStatus::kOpenFailed:
+                    if (_hasFallbackColor) {
+                        texture
+                            = _GenerateFallbackTexture(textureMgr, _textureName, _fallbackColor);
+                    }
+                    break;
+                default: break;
+                }
+            }
+        }
+        _decoded = _DecodedTexture();
+
+        _parent->_UpdateLoadedTexture(
+            _sceneDelegate, _textureName, texture, isSRGB, uvScaleOffset);
+    }
+
+private:
+    HdVP2TextureInfo  _fallbackTextureInfo;
+    HdVP2Material*    _parent;
+    HdSceneDelegate*  _sceneDelegate;
+    const std::string _path;
+    const std::string _textureName;
+    const GfVec4f     _fallbackColor;
+    const int         _maxResolution;
+    _DecodedTexture   _decoded;
+    _DecodeStatus     _decodeStatus { _DecodeStatus::kFailed };
+    std::atomic_bool  _started { false };
+    std::atomic_bool  _terminated { false };
+    bool              _hasFallbackColor;
+};
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_TEXTURE_DECODE_BUDGET_MB,
+    1024,
+    "Maximum amount of decoded texel memory, in megabytes, waiting to be uploaded to VP2 by the "
+    "asynchronous texture loader.");
+
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_VP2_TEXTURE_UPLOAD_BATCH_SIZE,
+    16,
+    "Number of decoded textures uploaded to VP2 by each idle task of the asynchronous texture "
+    "loader.");
+
+namespace {
+
+/*! \brief  Asynchronous texture loading pipeline.
+
+    HioImage reads and texel format conversions run concurrently on TBB worker threads. Decoded
+    textures are then uploaded to VP2 in batches by a single idle task on the main thread, the only
+    thread allowed to use MTextureManager. New decodes are only started while the amount of decoded
+    texel memory waiting for upload stays under a budget, so loading thousands of textures does not
+    hold all of them in system memory at once.
+
+    The pipeline shares the ownership of the tasks with their materials, and releases them after
+    the upload.
+ */
+class _TextureLoadingPipeline
+{
+public:
+    using Task = HdVP2Material::TextureLoadingTask;
+    using TaskPtr = std::shared_ptr<Task>;
+
+    static _TextureLoadingPipeline& GetInstance()
+    {
+        static _TextureLoadingPipeline sInstance;
+        return sInstance;
+    }
+
+    //! Queues the task for decoding. Returns false if the task could not be queued.
+    bool Push(const TaskPtr& task)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_isExiting) {
+            return false;
+        }
+
+        if (_IsIdle()) {
+            _busyStartTime = std::chrono::steady_clock::now();
+            _busyDuration = std::chrono::steady_clock::duration::zero();
+            _decodedCount = 0;
+            _uploadedCount = 0;
+            _decodedBytes = 0;
+        }
+
+        _pendingDecodes.push_back(task);
+        _DispatchDecodes();
+        return true;
+    }
+
+    HdVP2TextureLoadingStats GetStats()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        HdVP2TextureLoadingStats stats;
+        stats._pending = _pendingDecodes.size();
+        stats._decoding = _decodingCount;
+        stats._decoded = _decodedCount;
+        stats._uploaded = _uploadedCount;
+        stats._decodedBytes = _decodedBytes;
+        stats._inFlightBytes = _inFlightBytes;
+        stats._elapsedSeconds = std::chrono::duration<double>(
+                                    _IsIdle() ? _busyDuration
+                                              : std::chrono::steady_clock::now() - _busyStartTime)
+                                    .count();
+        return stats;
+    }
+
+    void OnMayaExit()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isExiting = true;
+            _pendingDecodes.clear();
+        }
+
+        // Let the running decodes finish before releasing what they produced.
+        _workers.wait();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingUploads.clear();
+        _inFlightBytes = 0;
+    }
+
+private:
+    _TextureLoadingPipeline()
+        : _maxConcurrentDecodes(std::max(1u, std::thread::hardware_concurrency()))
+        , _budget(size_t(std::max(0, TfGetEnvSetting(MAYAUSD_VP2_TEXTURE_DECODE_BUDGET_MB))) << 20)
+        , _batchSize(size_t(std::max(1, TfGetEnvSetting(MAYAUSD_VP2_TEXTURE_UPLOAD_BATCH_SIZE))))
     {
-        if (_started.exchange(true)) {
-            return false;
+    }
+    ~_TextureLoadingPipeline() = default;
+
+    bool _IsIdle() const
+    {
+        return _pendingDecodes.empty() && _decodingCount == 0 && _pendingUploads.empty();
+    }
+
+    //! Starts as many decodes as the concurrency and memory budget allow. _mutex must be held.
+    void _DispatchDecodes()
+    {
+        while (!_pendingDecodes.empty() && _decodingCount < _maxConcurrentDecodes) {
+            // Always let one texture through, even if it is larger than the whole budget.
+            const bool hasWork = _decodingCount > 0 || !_pendingUploads.empty();
+            if (hasWork && _inFlightBytes >= _budget) {
+                break;
+            }
+
+            TaskPtr task = _pendingDecodes.front();
+            _pendingDecodes.pop_front();
+            ++_decodingCount;
+            _workers.run([this, task]() { _Decode(task); });
         }
-        // Push the texture loading on idle
-        auto ret = MGlobal::executeTaskOnIdle(
-            [](void* data) {
-                auto* task = static_cast<HdVP2Material::TextureLoadingTask*>(data);
-                task->_Load();
-                // Once it is done, free the memory.
-                delete task;
-            },
-            this);
-        return ret == MStatus::kSuccess;
     }
 
-    bool Terminate()
+    //! Worker thread side of the pipeline.
+    void _Decode(const TaskPtr& task)
     {
-        _terminated = true;
-        // Return the started state to caller, the caller will delete this object
-        // if this task has not started yet.
-        // We will not be able to delete this object within its method.
-        return !_started.load();
+        task->Decode();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        --_decodingCount;
+        ++_decodedCount;
+        _decodedBytes += task->GetDecodedSize();
+        _inFlightBytes += task->GetDecodedSize();
+        _pendingUploads.push_back(task);
+
+        if (!_isUploadScheduled && !_isExiting) {
+            _isUploadScheduled = true;
+            MGlobal::executeTaskOnIdle(_UploadBatch, this);
+        }
+
+        _DispatchDecodes();
     }
 
-private:
-    void _Load()
+    //! Main thread side of the pipeline, runs on idle.
+    static void _UploadBatch(void* data)
     {
-        if (_terminated) {
-            return;
+        auto* self = static_cast<_TextureLoadingPipeline*>(data);
+
+        std::vector<TaskPtr> batch;
+        {
+            std::lock_guard<std::mutex> lock(self->_mutex);
+            if (self->_isExiting) {
+                self->_isUploadScheduled = false;
+                return;
+            }
+            const size_t count = std::min(self->_batchSize, self->_pendingUploads.size());
+            batch.assign(self->_pendingUploads.begin(), self->_pendingUploads.begin() + count);
+            self->_pendingUploads.erase(
+                self->_pendingUploads.begin(), self->_pendingUploads.begin() + count);
         }
-        bool        isSRGB = false;
-        MFloatArray uvScaleOffset;
-        auto*       texture
-            = _LoadTexture(_path, _hasFallbackColor, _fallbackColor, isSRGB, uvScaleOffset);
-        if (_terminated) {
-            return;
+
+        size_t uploadedBytes = 0;
+        {
+            MProfilingScope profilingScope(
+                HdVP2RenderDelegate::sProfilerCategory,
+                MProfiler::kColorD_L2,
+                "UploadTextureBatch");
+
+            for (const TaskPtr& task : batch) {
+                uploadedBytes += task->GetDecodedSize();
+                task->Upload();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(self->_mutex);
+        self->_inFlightBytes -= std::min(uploadedBytes, self->_inFlightBytes);
+        self->_uploadedCount += batch.size();
+
+        if (!self->_pendingUploads.empty()) {
+            MGlobal::executeTaskOnIdle(_UploadBatch, self);
+        } else {
+            self->_isUploadScheduled = false;
+        }
+
+        self->_DispatchDecodes();
+
+        if (self->_IsIdle()) {
+            self->_busyDuration = std::chrono::steady_clock::now() - self->_busyStartTime;
+            const double seconds = std::chrono::duration<double>(self->_busyDuration).count();
+            TF_DEBUG(HDVP2_DEBUG_TEXTURE_LOADING)
+                .Msg(
+                    "Loaded %zu textures (%.1f MB) in %.3f s: %.1f textures/s\n",
+                    self->_uploadedCount,
+                    self->_decodedBytes / (1024.0 * 1024.0),
+                    seconds,
+                    seconds > 0.0 ? self->_uploadedCount / seconds : 0.0);
         }
-        _parent->_UpdateLoadedTexture(_sceneDelegate, _path, texture, isSRGB, uvScaleOffset);
     }
 
-    HdVP2TextureInfo  _fallbackTextureInfo;
-    HdVP2Material*    _parent;
-    HdSceneDelegate*  _sceneDelegate;
-    const std::string _path;
-    const GfVec4f     _fallbackColor;
-    std::atomic_bool  _started { false };
-    bool              _terminated { false };
-    bool              _hasFallbackColor;
+    std::mutex        _mutex;
+    tbb::task_group   _workers;
+    std::deque<TaskPtr> _pendingDecodes; //!< Tasks waiting for a worker
+    std::deque<TaskPtr> _pendingUploads; //!< Decoded tasks waiting for the main thread
+
+    const size_t _maxConcurrentDecodes; //!< Maximum number of decodes running at once
+    const size_t _budget;               //!< Maximum decoded bytes waiting for upload
+    const size_t _batchSize;            //!< Maximum number of uploads per idle task
+
+    size_t _decodingCount { 0 };
+    size_t _decodedCount { 0 };
+    size_t _uploadedCount { 0 };
+    size_t _decodedBytes { 0 };
+    size_t _inFlightBytes { 0 };
+
+    std::chrono::steady_clock::time_point _busyStartTime;
+    std::chrono::steady_clock::duration   _busyDuration { 0 };
+
+    bool _isUploadScheduled { false };
+    bool _isExiting { false };
 };
 
+} // anonymous namespace
+
+bool HdVP2Material::TextureLoadingTask::EnqueueLoadOnIdle()
+{
+    if (_started.exchange(true)) {
+        return false;
+    }
+    // Decode on worker threads, the upload will happen on idle
+    if (!_TextureLoadingPipeline::GetInstance().Push(shared_from_this())) {
+        _started = false;
+        return false;
+    }
+    return true;
+}
+
 std::mutex                            HdVP2Material::_refreshMutex;
 std::chrono::steady_clock::time_point HdVP2Material::_startTime;
 std::atomic_size_t                    HdVP2Material::_runningTasksCounter;
@@ -2440,6 +3241,161 @@ void HdVP2Material::Sync(
     *dirtyBits = HdMaterial::Clean;
 }
 
+/*! \brief  Generate the fragments of the MaterialX materials about to be synced concurrently
+ */
+void HdVP2Material::PrepareMaterialXFragments(
+    HdRenderIndex&   renderIndex,
+    HdSceneDelegate* sceneDelegate)
+{
+#ifdef WANT_MATERIALX_BUILD
+    _PregeneratedFragments& pregeneratedFragments = _PregeneratedFragments::GetInstance();
+    pregeneratedFragments.Clear();
+
+    const HdDirtyBits materialDirtyBits = HdMaterial::DirtyResource | HdMaterial::DirtyParams;
+    HdChangeTracker&  changeTracker = renderIndex.GetChangeTracker();
+    SdfPathVector     dirtyMaterials;
+    for (const SdfPath& id : renderIndex.GetSprimSubtree(
+             HdPrimTypeTokens->material, SdfPath::AbsoluteRootPath())) {
+        if (changeTracker.GetSprimDirtyBits(id) & materialDirtyBits) {
+            dirtyMaterials.push_back(id);
+        }
+    }
+
+    // A single material, such as one being edited, does not benefit from concurrency: leave it to
+    // its sync rather than querying its network twice.
+    if (dirtyMaterials.size() < 2) {
+        return;
+    }
+
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorC_L2,
+        "HdVP2Material::PrepareMaterialXFragments");
+
+    auto* const renderDelegate = static_cast<HdVP2RenderDelegate*>(renderIndex.GetRenderDelegate());
+    auto* const param = static_cast<HdVP2RenderParam*>(renderDelegate->GetRenderParam());
+    const bool  needTexturedMaterials = param->GetDrawScene().NeedTexturedMaterials();
+
+    HdVP2FragmentDiskCache& diskCache = HdVP2FragmentDiskCache::GetInstance();
+
+    struct FragmentJob
+    {
+        SdfPath                       materialId;
+        HdMaterialNetwork2            fixedNetwork;
+        HdVP2ShaderCacheKey           shaderCacheID;
+        std::string                   fragmentDescription;
+        HdVP2FragmentDiskCache::Entry fragment;
+    };
+    std::vector<FragmentJob> jobs;
+    std::unordered_set<HdVP2ShaderCacheKey, HdVP2ShaderCacheKey::HashFunctor> jobKeys;
+    CompiledNetwork compiledNetwork(nullptr);
+
+    // Everything that depends on the scene or on the caches is done on the main thread: the
+    // networks are anonymized the same way their sync will, and the fragments that are already
+    // available are skipped.
+    auto addJob = [&](const SdfPath& id, const HdMaterialNetworkMap& networkMap) {
+        const auto bxdfNetIt = networkMap.map.find(HdMaterialTerminalTokens->surface);
+        if (bxdfNetIt == networkMap.map.end() || bxdfNetIt->second.nodes.empty()
+            || !_IsMaterialX(bxdfNetIt->second.nodes.back())) {
+            return;
+        }
+
+        bool isVolume = false;
+#if PXR_VERSION > 2203
+        const HdMaterialNetwork2 surfaceNetwork
+            = HdConvertToHdMaterialNetwork2(networkMap, &isVolume);
+#else
+        HdMaterialNetwork2 surfaceNetwork;
+        HdMaterialNetwork2ConvertFromHdMaterialNetworkMap(networkMap, &surfaceNetwork, &isVolume);
+#endif
+        if (isVolume || surfaceNetwork.terminals.count(HdMaterialTerminalTokens->surface) == 0) {
+            return;
+        }
+
+        FragmentJob job;
+        job.materialId = id;
+        compiledNetwork._ApplyMtlxVP2Fixes(job.fixedNetwork, surfaceNetwork);
+        job.shaderCacheID = _GenerateShaderCacheKey(job.fixedNetwork);
+        job.shaderCacheID.Append(MaterialXMaya::OgsFragment::getSpecularEnvKey());
+        if (renderDelegate->HasShaderInCache(job.shaderCacheID)
+            || pregeneratedFragments.Contains(job.shaderCacheID)
+            || !jobKeys.insert(job.shaderCacheID).second) {
+            return;
+        }
+
+        if (diskCache.IsEnabled()) {
+            job.fragmentDescription = _GetFragmentDescription(
+                _GenerateXMLString(job.fixedNetwork)
+                + MaterialXMaya::OgsFragment::getSpecularEnvKey());
+            if (diskCache.Load(job.fragmentDescription, job.fragment)) {
+                pregeneratedFragments.Add(job.shaderCacheID, std::move(job.fragment));
+                return;
+            }
+        }
+        jobs.push_back(std::move(job));
+    };
+
+    for (const SdfPath& id : dirtyMaterials) {
+        const VtValue vtMatResource = sceneDelegate->GetMaterialResource(id);
+        if (!vtMatResource.IsHolding<HdMaterialNetworkMap>()) {
+            continue;
+        }
+
+        // Same networks as the ones Sync() compiles.
+        const HdMaterialNetworkMap& fullNetworkMap
+            = vtMatResource.UncheckedGet<HdMaterialNetworkMap>();
+        HdMaterialNetworkMap untexturedNetworkMap = fullNetworkMap;
+        const bool didChangeUntextured = ConvertNetworkMapToUntextured(untexturedNetworkMap);
+
+        addJob(id, untexturedNetworkMap);
+        if (didChangeUntextured && needTexturedMaterials) {
+            addJob(id, fullNetworkMap);
+        }
+    }
+
+    if (jobs.empty()) {
+        return;
+    }
+
+    // The networks were anonymized above, which may have added optimized definitions to the
+    // MaterialX library: update the combined library once before generating the fragments.
+    _GetMaterialXData().GetCompleteLibrary();
+
+    // The generation settings are shared by all the fragments.
+    const auto prevUVSetName = mx::OgsXmlGenerator::getPrimaryUVSetName();
+    mx::OgsXmlGenerator::setPrimaryUVSetName(_GetMaterialXData()._mainUvSetName);
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, jobs.size(), 1),
+        [&jobs](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                FragmentJob& job = jobs[i];
+                if (!_GenerateMaterialXFragment(job.materialId, job.fixedNetwork, job.fragment)) {
+                    job.fragment = HdVP2FragmentDiskCache::Entry();
+                }
+            }
+        });
+
+    mx::OgsXmlGenerator::setPrimaryUVSetName(prevUVSetName);
+
+    for (FragmentJob& job : jobs) {
+        if (!job.fragmentDescription.empty() && !job.fragment._fragmentName.empty()) {
+            diskCache.Store(job.fragmentDescription, job.fragment);
+        }
+        pregeneratedFragments.Add(job.shaderCacheID, std::move(job.fragment));
+    }
+
+    TF_DEBUG(HDVP2_DEBUG_MATERIAL)
+        .Msg(
+            "Generated %zu MaterialX fragments for %zu materials ahead of their sync\n",
+            jobs.size(),
+            dirtyMaterials.size());
+#else
+    TF_UNUSED(renderIndex);
+    TF_UNUSED(sceneDelegate);
+#endif
+}
+
 void HdVP2Material::CompiledNetwork::Sync(
     HdSceneDelegate*            sceneDelegate,
     const HdMaterialNetworkMap& networkMap)
@@ -2508,14 +3464,14 @@ void HdVP2Material::CompiledNetwork::Sync(
     _ApplyVP2Fixes(vp2BxdfNet, bxdfNet);
 
     if (!vp2BxdfNet.nodes.empty()) {
-        // Generate a XML string from the material network and convert it to a token for
-        // faster hashing and comparison.
-        const TfToken token(_GenerateXMLString(vp2BxdfNet, false));
+        // Generate a key from the structure of the material network for fast hashing and
+        // comparison.
+        const HdVP2ShaderCacheKey key = _GenerateShaderCacheKey(vp2BxdfNet, false);
 
-        // Skip creating a new shader instance if the token is unchanged. There is no plan
+        // Skip creating a new shader instance if the key is unchanged. There is no plan
         // to implement fine-grain dirty bit in Hydra for the same purpose:
         // https://groups.google.com/g/usd-interest/c/xytT2azlJec/m/22Tnw4yXAAAJ
-        if (_surfaceNetworkToken != token) {
+        if (_surfaceNetworkKey != key) {
             MProfilingScope subProfilingScope(
                 HdVP2RenderDelegate::sProfilerCategory,
                 MProfiler::kColorD_L2,
@@ -2528,11 +3484,16 @@ void HdVP2Material::CompiledNetwork::Sync(
             MHWRender::MShaderInstance* shader;
 
 #ifndef HDVP2_DISABLE_SHADER_CACHE
+#if !defined(NDEBUG)
+            _owner->_renderDelegate->VerifyShaderCacheKey(
+                key, _GenerateXMLString(vp2BxdfNet, false));
+#endif
+
             // Acquire a shader instance from the shader cache. If a shader instance has
-            // been cached with the same token, a clone of the shader instance will be
+            // been cached with the same key, a clone of the shader instance will be
             // returned. Multiple clones of a shader instance will share the same shader
             // effect, thus reduce compilation overhead and enable material consolidation.
-            shader = _owner->_renderDelegate->GetShaderFromCache(token);
+            shader = _owner->_renderDelegate->GetShaderFromCache(key);
 
             // If the shader instance is not found in the cache, create one from the
             // material network and add a clone to the cache for reuse.
@@ -2540,7 +3501,7 @@ void HdVP2Material::CompiledNetwork::Sync(
                 shader = _CreateShaderInstance(vp2BxdfNet);
 
                 if (shader) {
-                    _owner->_renderDelegate->AddShaderToCache(token, *shader);
+                    _owner->_renderDelegate->AddShaderToCache(key, *shader);
                 }
             }
 #else
@@ -2606,9 +3567,9 @@ void HdVP2Material::CompiledNetwork::Sync(
                 }
             }
 
-            // The token is saved and will be used to determine whether a new shader
+            // The key is saved and will be used to determine whether a new shader
             // instance is needed during the next sync.
-            _surfaceNetworkToken = token;
+            _surfaceNetworkKey = key;
         }
 
         updateShaderInstance(bxdfNet);
@@ -3205,12 +4166,22 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
     HdMaterialNetwork2 fixedNetwork;
     _ApplyMtlxVP2Fixes(fixedNetwork, surfaceNetwork);
 
-    SdfPath       terminalPath = terminalConnIt->second.upstreamNode;
-    const TfToken shaderCacheID(
-        _GenerateXMLString(fixedNetwork) + MaterialXMaya::OgsFragment::getSpecularEnvKey());
+    SdfPath             terminalPath = terminalConnIt->second.upstreamNode;
+    HdVP2ShaderCacheKey shaderCacheID = _GenerateShaderCacheKey(fixedNetwork);
+    shaderCacheID.Append(MaterialXMaya::OgsFragment::getSpecularEnvKey());
+
+    // The serialized network is only needed to describe the fragment to the persistent cache, to
+    // verify the key and for debugging purposes. Only generate it when the shader is not cached.
+    auto getNetworkDescription = [&fixedNetwork]() {
+        return _GenerateXMLString(fixedNetwork) + MaterialXMaya::OgsFragment::getSpecularEnvKey();
+    };
+
+#if !defined(NDEBUG)
+    renderDelegate->VerifyShaderCacheKey(shaderCacheID, getNetworkDescription());
+#endif
 
     // Acquire a shader instance from the shader cache. If a shader instance has been cached with
-    // the same token, a clone of the shader instance will be returned. Multiple clones of a shader
+    // the same key, a clone of the shader instance will be returned. Multiple clones of a shader
     // instance will share the same shader effect, thus reduce compilation overhead and enable
     // material consolidation.
     shaderInstance = renderDelegate->GetShaderFromCache(shaderCacheID);
@@ -3228,190 +4199,101 @@ MHWRender::MShaderInstance* HdVP2Material::CompiledNetwork::_CreateMaterialXShad
         return shaderInstance;
     }
 
-    SdfPath fixedPath = fixedNetwork.terminals[HdMaterialTerminalTokens->surface].upstreamNode;
-    HdMaterialNode2 const* surfTerminal = &fixedNetwork.nodes[fixedPath];
-    if (!surfTerminal) {
-        return shaderInstance;
-    }
-
-    try {
-        // The HdMtlxCreateMtlxDocumentFromHdNetwork function can throw if any MaterialX error is
-        // raised.
-
-        // Check if the Terminal is a MaterialX Node
-        SdrRegistry&                sdrRegistry = SdrRegistry::GetInstance();
-        const SdrShaderNodeConstPtr mtlxSdrNode = sdrRegistry.GetShaderNodeByIdentifierAndType(
-            surfTerminal->nodeTypeId, HdVP2Tokens->mtlx);
+    // The generated fragment only depends on the network and on the generation settings. It may
+    // have been generated ahead of the sync, along with the fragments of other materials. Otherwise
+    // look it up in the persistent cache before running the expensive MaterialX code generation.
+    HdVP2FragmentDiskCache::Entry fragment;
+    if (!_PregeneratedFragments::GetInstance().Take(shaderCacheID, fragment)) {
+        HdVP2FragmentDiskCache& diskCache = HdVP2FragmentDiskCache::GetInstance();
+        const std::string       fragmentDescription = diskCache.IsEnabled()
+            ? _GetFragmentDescription(getNetworkDescription())
+            : std::string();
 
-        mx::DocumentPtr           mtlxDoc;
-        const mx::FileSearchPath& crLibrarySearchPath(_GetMaterialXData()._mtlxSearchPath);
-#if MX_COMBINED_VERSION >= 13808
-        if (mtlxSdrNode
-            || _GetMaterialXData()._lobePruner->isOptimizedNodeId(surfTerminal->nodeTypeId)) {
-#else
-        if (mtlxSdrNode) {
-#endif
+        if (fragmentDescription.empty() || !diskCache.Load(fragmentDescription, fragment)) {
+            // Enable changing texcoord to geompropvalue
+            const auto prevUVSetName = mx::OgsXmlGenerator::getPrimaryUVSetName();
+            mx::OgsXmlGenerator::setPrimaryUVSetName(_GetMaterialXData()._mainUvSetName);
 
-#ifdef HAS_COLOR_MANAGEMENT_SUPPORT_API
-            mx::DocumentPtr completeLibrary = mx::createDocument();
-            completeLibrary->importLibrary(_GetMaterialXData()._mtlxLibrary);
-            completeLibrary->importLibrary(MaterialXMaya::OgsFragment::getOCIOLibrary());
-#else
-            mx::DocumentPtr completeLibrary = _GetMaterialXData()._mtlxLibrary;
-#endif
+            const bool generated = _GenerateMaterialXFragment(materialId, fixedNetwork, fragment);
 
-            // Create the MaterialX Document from the HdMaterialNetwork
-#if PXR_VERSION > 2111
-            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
-                fixedNetwork,
-                *surfTerminal, // MaterialX HdNode
-                fixedPath,
-                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
-                completeLibrary);
-#else
-            std::set<SdfPath> hdTextureNodes;
-            mx::StringMap mxHdTextureMap; // Mx-Hd texture name counterparts
-            mtlxDoc = HdMtlxCreateMtlxDocumentFromHdNetwork(
-                fixedNetwork,
-                *surfTerminal, // MaterialX HdNode
-                SdfPath(_mtlxTokens->USD_Mtlx_VP2_Material),
-                completeLibrary,
-                &hdTextureNodes,
-                &mxHdTextureMap);
-#endif
+            // Restore previous UV set name
+            mx::OgsXmlGenerator::setPrimaryUVSetName(prevUVSetName);
 
-            if (!mtlxDoc) {
+            if (!generated) {
                 return shaderInstance;
             }
-
-            // Touchups required to fix input stream issues:
-            _AddMissingTangents(mtlxDoc);
-#if MX_COMBINED_VERSION >= 13900
-            _AddMissingBitangents(mtlxDoc);
-#endif
-
-            _surfaceShaderId = terminalPath;
-
-            if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
-                std::cout << "generated shader code for " << materialId.GetText() << ":\n";
-                std::cout << "Generated graph\n==============================\n";
-                mx::writeToXmlStream(mtlxDoc, std::cout);
-                std::cout << "\n==============================\n";
-            }
-        } else {
-            return shaderInstance;
-        }
-
-        mx::NodePtr materialNode;
-        for (const mx::NodePtr& material : mtlxDoc->getMaterialNodes()) {
-            if (material->getName() == _mtlxTokens->USD_Mtlx_VP2_Material.GetText()) {
-                materialNode = material;
+            if (!fragmentDescription.empty()) {
+                diskCache.Store(fragmentDescription, fragment);
             }
         }
+    }
 
-        if (!materialNode) {
-            return shaderInstance;
-        }
-
-        // Enable changing texcoord to geompropvalue
-        const auto prevUVSetName = mx::OgsXmlGenerator::getPrimaryUVSetName();
-        mx::OgsXmlGenerator::setPrimaryUVSetName(_GetMaterialXData()._mainUvSetName);
-
-        MaterialXMaya::OgsFragment ogsFragment(materialNode, crLibrarySearchPath);
+    // A fragment that failed to generate ahead of the sync has no name.
+    if (fragment._fragmentName.empty()) {
+        return shaderInstance;
+    }
+    _surfaceShaderId = terminalPath;
+
+    _requiredPrimvars.insert(
+        _requiredPrimvars.end(),
+        fragment._requiredPrimvars.begin(),
+        fragment._requiredPrimvars.end());
+    for (const auto& renamed : fragment._renamedParameters) {
+        _renamedParameters.emplace(renamed.first, MString(renamed.second.c_str()));
+    }
 
-        // Restore previous UV set name
-        mx::OgsXmlGenerator::setPrimaryUVSetName(prevUVSetName);
+    MHWRender::MRenderer* const renderer = MHWRender::MRenderer::theRenderer();
+    if (!TF_VERIFY(renderer)) {
+        return shaderInstance;
+    }
 
-        // Explore the fragment for primvars:
-        mx::ShaderPtr            shader = ogsFragment.getShader();
-        const mx::VariableBlock& vertexInputs
-            = shader->getStage(mx::Stage::VERTEX).getInputBlock(mx::HW::VERTEX_INPUTS);
-        for (size_t i = 0; i < vertexInputs.size(); ++i) {
-            const mx::ShaderPort* variable = vertexInputs[i];
-            // Position is always assumed.
-            // Tangent will be generated in the vertex shader using a utility fragment
-            if (variable->getName() == mx::HW::T_IN_NORMAL) {
-                _requiredPrimvars.push_back(HdTokens->normals);
-            }
-        }
+    MHWRender::MFragmentManager* const fragmentManager = renderer->getFragmentManager();
+    if (!TF_VERIFY(fragmentManager)) {
+        return shaderInstance;
+    }
 
-        MHWRender::MRenderer* const renderer = MHWRender::MRenderer::theRenderer();
-        if (!TF_VERIFY(renderer)) {
-            return shaderInstance;
-        }
+    MString fragmentName(fragment._fragmentName.c_str());
 
-        MHWRender::MFragmentManager* const fragmentManager = renderer->getFragmentManager();
-        if (!TF_VERIFY(fragmentManager)) {
+    if (!fragmentManager->hasFragment(fragmentName)) {
+        const MString registeredFragment
+            = fragmentManager->addShadeFragmentFromBuffer(fragment._fragmentSource.c_str(), false);
+        if (registeredFragment.length() == 0) {
+            TF_WARN("Failed to register shader fragment %s", fragmentName.asChar());
             return shaderInstance;
         }
+    }
 
-        MString fragmentName(ogsFragment.getFragmentName().c_str());
-
-        if (!fragmentManager->hasFragment(fragmentName)) {
-            std::string   fragSrc = ogsFragment.getFragmentSource();
-            const MString registeredFragment
-                = fragmentManager->addShadeFragmentFromBuffer(fragSrc.c_str(), false);
-            if (registeredFragment.length() == 0) {
-                TF_WARN("Failed to register shader fragment %s", fragmentName.asChar());
-                return shaderInstance;
-            }
-        }
-
-        const MHWRender::MShaderManager* const shaderMgr = renderer->getShaderManager();
-        if (!TF_VERIFY(shaderMgr)) {
-            return shaderInstance;
-        }
+    const MHWRender::MShaderManager* const shaderMgr = renderer->getShaderManager();
+    if (!TF_VERIFY(shaderMgr)) {
+        return shaderInstance;
+    }
 
-        shaderInstance = shaderMgr->getFragmentShader(fragmentName, "outColor", true);
-        shaderInstance->addInputFragment("NwFaceCameraIfNAN", "output", "Nw");
-
-        // Find named primvar readers:
-        MStringArray parameterList;
-        shaderInstance->parameterList(parameterList);
-        for (unsigned int i = 0; i < parameterList.length(); ++i) {
-            static const unsigned int u_geomprop_length
-                = static_cast<unsigned int>(_mtlxTokens->i_geomprop_.GetString().length());
-            if (parameterList[i].substring(0, u_geomprop_length - 1)
-                == _mtlxTokens->i_geomprop_.GetText()) {
-                MString varname
-                    = parameterList[i].substring(u_geomprop_length, parameterList[i].length());
-                shaderInstance->renameParameter(parameterList[i], varname);
-                _requiredPrimvars.push_back(TfToken(varname.asChar()));
-            }
-        }
+    shaderInstance = shaderMgr->getFragmentShader(fragmentName, "outColor", true);
+    if (!shaderInstance) {
+        return shaderInstance;
+    }
+    shaderInstance->addInputFragment("NwFaceCameraIfNAN", "output", "Nw");
 
-        // Remember inputs that were renamed because they conflicted with reserved keywords:
-        for (const auto& namePair : ogsFragment.getPathInputMap()) {
-            std::string path = namePair.first;
-            std::string input = namePair.second;
-            // Renaming adds digits at the end, so only compare the backs.
-            if (path.back() != input.back()) {
-                // If a digit was added, we should be able to find the last path element inside the
-                // input name:
-                size_t      lastSlash = path.rfind("/");
-                std::string originalName = path;
-                if (lastSlash != std::string::npos) {
-                    originalName = path.substr(lastSlash + 1);
-                }
-                size_t foundOriginal = input.find(originalName);
-                if (foundOriginal != std::string::npos) {
-                    MString uniqueName(input.c_str());
-                    input = input.substr(0, foundOriginal + originalName.size());
-                    _renamedParameters.emplace(input, uniqueName);
-                }
-            }
+    // Find named primvar readers:
+    MStringArray parameterList;
+    shaderInstance->parameterList(parameterList);
+    for (unsigned int i = 0; i < parameterList.length(); ++i) {
+        static const unsigned int u_geomprop_length
+            = static_cast<unsigned int>(_mtlxTokens->i_geomprop_.GetString().length());
+        if (parameterList[i].substring(0, u_geomprop_length - 1)
+            == _mtlxTokens->i_geomprop_.GetText()) {
+            MString varname
+                = parameterList[i].substring(u_geomprop_length, parameterList[i].length());
+            shaderInstance->renameParameter(parameterList[i], varname);
+            _requiredPrimvars.push_back(TfToken(varname.asChar()));
         }
-    } catch (mx::Exception& e) {
-        TF_RUNTIME_ERROR(
-            "Caught exception '%s' while processing '%s'", e.what(), materialId.GetText());
-        return nullptr;
     }
 
     if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
         std::cout << "BXDF material network for " << materialId << ":\n"
                   << _GenerateXMLString(surfaceNetwork) << "\n"
                   << "Topology-only network for " << materialId << ":\n"
-                  << shaderCacheID << "\n"
+                  << getNetworkDescription() << "\n"
                   << "Required primvars:\n";
 
         for (TfToken const& primvar : _requiredPrimvars) {
@@ -3871,12 +4753,17 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         gExitingCbId = MSceneMessage::addCallback(MSceneMessage::kMayaExiting, exitingCallback);
     }
 
+    // Textures are cached per level of detail so that changing the resolution limit back and
+    // forth reuses the already loaded textures.
+    const int         maxResolution = _renderDelegate->GetMaxTextureResolution();
+    const std::string key = _GetTextureCacheKey(path, maxResolution);
+
     // see if we already have the texture loaded.
-    const auto it = _globalTextureMap.find(path);
+    const auto it = _globalTextureMap.find(key);
     if (it != _globalTextureMap.end()) {
         HdVP2TextureInfoSharedPtr cacheEntry = it->second.lock();
         if (cacheEntry) {
-            _localTextureMap[path] = cacheEntry;
+            _localTextureMap[key] = cacheEntry;
             return *cacheEntry;
         } else {
             // if cacheEntry is nullptr then there is a stale entry in the _globalTextureMap. Erase
@@ -3898,16 +4785,16 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         bool        isSRGB = false;
         MFloatArray uvScaleOffset;
 
-        MHWRender::MTexture* texture
-            = _LoadTexture(path, hasFallbackColor, fallbackColor, isSRGB, uvScaleOffset);
+        MHWRender::MTexture* texture = _LoadTexture(
+            path, key, maxResolution, hasFallbackColor, fallbackColor, isSRGB, uvScaleOffset);
 
         HdVP2TextureInfoSharedPtr info = std::make_shared<HdVP2TextureInfo>();
-        // path should never already be in _localTextureMap because if it was
+        // key should never already be in _localTextureMap because if it was
         // we'd have found it in _globalTextureMap
-        _localTextureMap.emplace(path, info);
-        // path should never already be in _globalTextureMap because if it was present
+        _localTextureMap.emplace(key, info);
+        // key should never already be in _globalTextureMap because if it was present
         // and nullptr then we erased it.
-        _globalTextureMap.emplace(path, info);
+        _globalTextureMap.emplace(key, info);
         info->_texture.reset(texture);
         info->_isColorSpaceSRGB = isSRGB;
         if (uvScaleOffset.length() > 0) {
@@ -3921,8 +4808,9 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         return *info;
     }
 
-    auto* task = new TextureLoadingTask(this, sceneDelegate, path, hasFallbackColor, fallbackColor);
-    _textureLoadingTasks.emplace(path, task);
+    auto task = std::make_shared<TextureLoadingTask>(
+        this, sceneDelegate, path, key, maxResolution, hasFallbackColor, fallbackColor);
+    _textureLoadingTasks.emplace(key, task);
     return task->GetFallbackTextureInfo();
 }
 
@@ -3940,10 +4828,7 @@ void HdVP2Material::ClearPendingTasks()
     // Inform tasks that have not started or finished that this material object
     // is no longer valid
     for (auto& task : _textureLoadingTasks) {
-        if (task.second->Terminate()) {
-            // Delete the pointer: we can only do that outside of the object scope
-            delete task.second;
-        }
+        task.second->Terminate();
     }
 
     // Remove the reference of all the tasks
@@ -3969,10 +4854,8 @@ void HdVP2Material::_UpdateLoadedTexture(
         --_runningTasksCounter;
     }
 
-    // Pop the task object from the container, since this method is
-    // called directly from the task object method `loadOnIdle()`,
-    // we do not handle the deletion here, we will let the
-    // function on idle to delete the task object.
+    // Pop the task object from the container. This method is called from the
+    // task upload, during which the upload batch keeps the task alive.
     _textureLoadingTasks.erase(path);
 
     // Check the cache again. If the texture is not in the cache
@@ -4108,8 +4991,14 @@ void HdVP2Material::MaterialChanged(HdSceneDelegate* sceneDelegate)
     }
 }
 
+HdVP2TextureLoadingStats HdVP2Material::GetTextureLoadingStats()
+{
+    return _TextureLoadingPipeline::GetInstance().GetStats();
+}
+
 void HdVP2Material::OnMayaExit()
 {
+    _TextureLoadingPipeline::GetInstance().OnMayaExit();
     _TransientTexturePreserver::GetInstance().OnMayaExit();
     _globalTextureMap.clear();
     HdVP2RenderDelegate::OnMayaExit();
@@ -38,6 +38,7 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class HdRenderIndex;
 class HdSceneDelegate;
 class HdVP2RenderDelegate;
 
@@ -78,6 +79,27 @@ using HdVP2TextureInfoWeakPtr = std::weak_ptr<HdVP2TextureInfo>;
 using HdVP2LocalTextureMap = std::unordered_map<std::string, HdVP2TextureInfoSharedPtr>;
 using HdVP2GlobalTextureMap = std::unordered_map<std::string, HdVP2TextureInfoWeakPtr>;
 
+/*! \brief  Counters of the asynchronous texture loading pipeline.
+
+    Counts are reset each time the pipeline starts loading after having been idle, so that
+    TexturesPerSecond() reports the throughput of the latest loading burst.
+ */
+struct HdVP2TextureLoadingStats
+{
+    size_t _pending { 0 };          //!< Textures waiting for a worker thread
+    size_t _decoding { 0 };         //!< Textures being decoded on worker threads
+    size_t _decoded { 0 };          //!< Textures decoded since the pipeline became busy
+    size_t _uploaded { 0 };         //!< Textures uploaded to VP2 since the pipeline became busy
+    size_t _decodedBytes { 0 };     //!< Texel bytes produced since the pipeline became busy
+    size_t _inFlightBytes { 0 };    //!< Decoded texel bytes waiting to be uploaded
+    double _elapsedSeconds { 0.0 }; //!< Time spent loading since the pipeline became busy
+
+    double TexturesPerSecond() const
+    {
+        return _elapsedSeconds > 0.0 ? _uploaded / _elapsedSeconds : 0.0;
+    }
+};
+
 /*! \brief  A VP2-specific implementation for a Hydra material prim.
     \class  HdVP2Material
 
@@ -121,6 +143,14 @@ public:
     class TextureLoadingTask;
     friend class TextureLoadingTask;
 
+    //! Get the counters of the asynchronous texture loading pipeline.
+    static HdVP2TextureLoadingStats GetTextureLoadingStats();
+
+    //! Generate the MaterialX fragments of the dirty materials of \p renderIndex concurrently,
+    //! before the materials are synced one at a time.
+    static void
+    PrepareMaterialXFragments(HdRenderIndex& renderIndex, HdSceneDelegate* sceneDelegate);
+
     static void OnMayaExit();
 
 private:
@@ -174,10 +204,12 @@ private:
         MStatus SetShaderIsTransparent(bool isTransparent);
 
     private:
+        friend class HdVP2Material;
+
         HdVP2Material* _owner;
-        TfToken _surfaceNetworkToken;   //!< Generated token to uniquely identify a material network
-        SdfPath _surfaceShaderId;       //!< Path of the surface shader
-        bool    _transparent { false }; //!< Whether this network is transparent
+        HdVP2ShaderCacheKey _surfaceNetworkKey; //!< Key uniquely identifying a material network
+        SdfPath             _surfaceShaderId;   //!< Path of the surface shader
+        bool                _transparent { false }; //!< Whether this network is transparent
         HdVP2ShaderUniquePtr         _surfaceShader;    //!< VP2 surface shader instance
         mutable HdVP2ShaderUniquePtr _frontFaceShader;  //!< same as above + backface culling
         mutable HdVP2ShaderUniquePtr _pointShader;      //!< VP2 point shader instance, if needed
@@ -242,7 +274,7 @@ private:
     static HdVP2GlobalTextureMap _globalTextureMap; //!< Texture in use by all materials in MayaUSD
     HdVP2LocalTextureMap         _localTextureMap;  //!< Textures used by this material
 
-    std::unordered_map<std::string, TextureLoadingTask*> _textureLoadingTasks;
+    std::unordered_map<std::string, std::shared_ptr<TextureLoadingTask>> _textureLoadingTasks;
 
     //! Mutex protecting concurrent access to the Rprim set
     std::mutex _materialSubscriptionsMutex;
@@ -120,6 +120,13 @@ MayaUsdRPrim::~MayaUsdRPrim()
         ProxyRenderDelegate& drawScene = param->GetDrawScene();
         drawScene.UpdateInstancingMapEntry(_pathInPrototype, sVoidInstancePrototypePath, _hydraId);
     }
+
+    if (!_indexedRenderTag.IsEmpty()) {
+        // Clear my entry from the render tag index
+        auto* const          param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+        ProxyRenderDelegate& drawScene = param->GetDrawScene();
+        drawScene.UpdateRenderTagIndex(_indexedRenderTag, TfToken(), _hydraId);
+    }
 }
 
 void MayaUsdRPrim::_CommitMVertexBuffer(MHWRender::MVertexBuffer* const buffer, void* bufferData)
@@ -910,6 +917,18 @@ void MayaUsdRPrim::_SyncSharedData(
         _RenderTag() = renderTag;
     }
 #endif
+
+    if (_RenderTag() != _indexedRenderTag) {
+        // UpdateRenderTagIndex is not multithread-safe, so enqueue the call
+        const TfToken newRenderTag = _RenderTag();
+        _delegate->GetVP2ResourceRegistry().EnqueueCommit([this, id, newRenderTag]() {
+            auto* const param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+            auto&       drawScene = param->GetDrawScene();
+
+            drawScene.UpdateRenderTagIndex(_indexedRenderTag, newRenderTag, id);
+            _indexedRenderTag = newRenderTag;
+        });
+    }
 }
 
 bool MayaUsdRPrim::_SyncCommon(
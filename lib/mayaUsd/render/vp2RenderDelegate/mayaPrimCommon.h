@@ -27,6 +27,7 @@
 
 #include <tbb/concurrent_unordered_map.h>
 
+#include <utility>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -101,6 +102,10 @@ struct MayaUsdCommitState
     //! transforms
     std::shared_ptr<MMatrixArray> _instanceTransforms;
 
+    //! Ranges [first, last) of _instanceTransforms which changed since the previous commit.
+    //! Empty if every instance transform needs to be updated.
+    std::vector<std::pair<unsigned int, unsigned int>> _changedInstanceRanges;
+
     //! Color parameter that _instanceColors should be bound to
     MString _instanceColorParam;
 
@@ -413,6 +418,9 @@ protected:
 
     //! For instanced prim, holds the corresponding path in USD prototype
     InstancePrototypePath _pathInPrototype { SdfPath(), kNativeInstancing };
+
+    //! Render tag under which the Rprim is registered in the render tag index of the draw scene
+    TfToken _indexedRenderTag;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -50,6 +50,8 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <tbb/parallel_for.h>
+
 #include <numeric>
 #include <type_traits>
 
@@ -69,6 +71,9 @@ constexpr int sDrawModeSelectionHighlighting = MHWRender::MGeometry::kSelectionH
 constexpr int sDrawModeSelectionHighlighting = 0;
 #endif
 
+//! Number of instances per task when computing the instance transforms in parallel.
+constexpr unsigned int kInstanceGrainSize = 1024;
+
 //! Helper utility function to fill primvar data to vertex buffer.
 template <class DEST_TYPE, class SRC_TYPE>
 void _FillPrimvarData(
@@ -1882,7 +1887,6 @@ void HdVP2Mesh::_UpdateDrawItem(
         VtMatrix4dArray transforms
             = instancer ? instancer->GetInstanceTransforms(id) : VtMatrix4dArray();
 
-        MMatrix            instanceMatrix;
         const unsigned int instanceCount = transforms.size();
 
         if (0 == instanceCount) {
@@ -2034,6 +2038,11 @@ void HdVP2Mesh::_UpdateDrawItem(
             const int             modFlags = drawItem->GetModFlags();
             InstanceColorOverride colorOverride(useWireframeColors);
 
+            // USD ids of the instances drawn by this render item. Their transforms are computed
+            // in parallel once the instances have been filtered.
+            std::vector<unsigned int> drawnInstanceIds;
+            drawnInstanceIds.reserve(instanceCount);
+
             stateToCommit._instanceTransforms = std::make_shared<MMatrixArray>();
             stateToCommit._instanceColors = std::make_shared<MFloatArray>();
             for (unsigned int usdInstanceId = 0; usdInstanceId < instanceCount; usdInstanceId++) {
@@ -2057,8 +2066,7 @@ void HdVP2Mesh::_UpdateDrawItem(
                 stateToCommit._ufeIdentifiers.append(
                     drawScene.GetScenePrimPath(GetId(), usdInstanceId).GetString().c_str());
 #endif
-                transforms[usdInstanceId].Get(instanceMatrix.matrix);
-                stateToCommit._instanceTransforms->append(worldMatrix * instanceMatrix);
+                drawnInstanceIds.push_back(usdInstanceId);
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
                 mayaToUsd.push_back(usdInstanceId);
 #endif
@@ -2075,6 +2083,21 @@ void HdVP2Mesh::_UpdateDrawItem(
                     }
                 }
             }
+
+            const unsigned int drawnInstanceCount = drawnInstanceIds.size();
+            MMatrixArray&      instanceTransforms = *stateToCommit._instanceTransforms;
+            instanceTransforms.setLength(drawnInstanceCount);
+            const GfMatrix4d* transformData = transforms.cdata();
+            tbb::parallel_for(
+                tbb::blocked_range<unsigned int>(0, drawnInstanceCount, kInstanceGrainSize),
+                [&](const tbb::blocked_range<unsigned int>& range) {
+                    MMatrix instanceMatrix;
+                    for (unsigned int i = range.begin(); i < range.end(); ++i) {
+                        transformData[drawnInstanceIds[i]].Get(instanceMatrix.matrix);
+                        instanceTransforms[i] = worldMatrix * instanceMatrix;
+                    }
+                });
+
 #ifdef MAYA_UPDATE_UFE_IDENTIFIER_SUPPORT
             InstanceIdMap& cachedMayaToUsd = MayaUsdCustomData::Get(*renderItem);
             bool           mayaToUsdChanged = cachedMayaToUsd.size() != mayaToUsd.size();
@@ -2112,21 +2135,31 @@ void HdVP2Mesh::_UpdateDrawItem(
             ? !static_cast<bool>(drawItemData._instanceTransforms)
             : static_cast<bool>(drawItemData._instanceTransforms);
         if (stateToCommit._instanceTransforms && drawItemData._instanceTransforms) {
-            instanceTransformsChanged
-                = (stateToCommit._instanceTransforms->length()
-                   != drawItemData._instanceTransforms->length());
-            for (unsigned int index = 0;
-                 index < stateToCommit._instanceTransforms->length() && !instanceTransformsChanged;
-                 index++) {
-                instanceTransformsChanged
-                    = ((*stateToCommit._instanceTransforms)[index]
-                       != (*drawItemData._instanceTransforms)[index]);
+            const MMatrixArray& newTransforms = *stateToCommit._instanceTransforms;
+            const MMatrixArray& oldTransforms = *drawItemData._instanceTransforms;
+            instanceTransformsChanged = (newTransforms.length() != oldTransforms.length());
+            if (!instanceTransformsChanged) {
+                // Record the ranges of instances which changed, so that only those get updated
+                // when the instance count stays the same.
+                auto& changedRanges = stateToCommit._changedInstanceRanges;
+                for (unsigned int index = 0; index < newTransforms.length(); index++) {
+                    if (newTransforms[index] == oldTransforms[index]) {
+                        continue;
+                    }
+                    if (!changedRanges.empty() && changedRanges.back().second == index) {
+                        changedRanges.back().second = index + 1;
+                    } else {
+                        changedRanges.emplace_back(index, index + 1);
+                    }
+                }
+                instanceTransformsChanged = !changedRanges.empty();
             }
         }
         // if the values are the same then there is nothing to do. Don't update
         // the instance transforms and keep on drawing with the current transforms
         if (!instanceTransformsChanged) {
             stateToCommit._instanceTransforms.reset();
+            stateToCommit._changedInstanceRanges.clear();
         } else {
             drawItemData._instanceTransforms = stateToCommit._instanceTransforms;
         }
@@ -2358,14 +2391,23 @@ void HdVP2Mesh::_UpdateDrawItem(
             if (stateToCommit._renderItemData._usingInstancedDraw) {
                 if (stateToCommit._instanceTransforms) {
                     if (oldInstanceCount == newInstanceCount) {
-                        for (unsigned int i = 0; i < newInstanceCount; i++) {
-                            // VP2 defines instance ID of the first instance to be 1.
-                            result = drawScene.updateInstanceTransform(
-                                *renderItem, i + 1, (*stateToCommit._instanceTransforms)[i]);
-                            if (result != MStatus::kSuccess) {
-                                TF_WARN(
-                                    "Could not update the instance transform for [%s].",
-                                    renderItem->name().asChar());
+                        auto updateInstanceTransforms = [&](unsigned int first, unsigned int last) {
+                            for (unsigned int i = first; i < last; i++) {
+                                // VP2 defines instance ID of the first instance to be 1.
+                                result = drawScene.updateInstanceTransform(
+                                    *renderItem, i + 1, (*stateToCommit._instanceTransforms)[i]);
+                                if (result != MStatus::kSuccess) {
+                                    TF_WARN(
+                                        "Could not update the instance transform for [%s].",
+                                        renderItem->name().asChar());
+                                }
+                            }
+                        };
+                        if (stateToCommit._changedInstanceRanges.empty()) {
+                            updateInstanceTransforms(0, newInstanceCount);
+                        } else {
+                            for (const auto& range : stateToCommit._changedInstanceRanges) {
+                                updateInstanceTransforms(range.first, range.second);
                             }
                         }
                     } else {
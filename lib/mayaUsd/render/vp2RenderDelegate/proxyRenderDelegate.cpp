@@ -40,7 +40,6 @@
 #include <pxr/imaging/hd/material.h>
 #include <pxr/imaging/hd/mesh.h>
 #include <pxr/imaging/hd/points.h>
-#include <pxr/imaging/hd/primGather.h>
 #include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/rprimCollection.h>
 #include <pxr/imaging/hd/sceneDelegate.h>
@@ -92,6 +91,10 @@
 #include <ufe/sceneNotification.h>
 #include <ufe/selectionNotification.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/concurrent_vector.h>
+#include <tbb/parallel_for.h>
+
 #if defined(BUILD_HDMAYA)
 #include <mayaUsd/render/mayaToHydra/utils.h>
 #endif
@@ -103,6 +106,28 @@ namespace {
 //! Representation selector for point snapping
 const HdReprSelector kPointsReprSelector(TfToken(), TfToken(), HdReprTokens->points);
 
+//! \brief  Returns true if newSelector requires a repr which oldSelector did not.
+bool HasNewRepr(const HdReprSelector& oldSelector, const HdReprSelector& newSelector)
+{
+    for (size_t i = 0; i < HdReprSelector::MAX_TOPOLOGY_REPRS; ++i) {
+        const TfToken& reprToken = newSelector[i];
+        if (!reprToken.IsEmpty() && !oldSelector.Contains(reprToken)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! \brief  Returns true if the named model panel still exists and is visible.
+bool IsModelPanelVisible(const std::string& modelPanel)
+{
+    M3dView view;
+    if (!M3dView::getM3dViewFromModelPanel(MString(modelPanel.c_str()), view)) {
+        return false;
+    }
+    return view.isVisible();
+}
+
 //! \brief  Query the global selection list adjustment.
 MGlobal::ListAdjustment GetListAdjustment()
 {
@@ -182,6 +207,18 @@ UsdPointInstancesPickMode GetPointInstancesPickMode()
     return pickMode;
 }
 
+//! \brief  Query the maximum resolution of textures drawn in the viewport.
+//! \return The maximum texture width or height, or 0 when the resolution is not limited.
+int GetMaxTextureResolution()
+{
+    static const MString kOptionVarName(MayaUsdOptionVars->MaxTextureResolution.GetText());
+
+    if (MGlobal::optionVarExists(kOptionVarName)) {
+        return std::max(0, MGlobal::optionVarIntValue(kOptionVarName));
+    }
+    return 0;
+}
+
 //! \brief  Returns the prim or an ancestor of it that is of the given kind.
 //
 // If neither the prim itself nor any of its ancestors above it in the
@@ -444,105 +481,11 @@ void colorManagementRefreshCB(void* clientData)
     }
 }
 
-// Copied from renderIndex.cpp, the code that does HdRenderIndex::GetDrawItems. But I just want the
-// rprimIds, I don't want to go all the way to draw items.
-#if defined(HD_API_VERSION) && HD_API_VERSION >= 42
-struct _FilterParam
-{
-    const TfTokenVector& renderTags;
-    const HdRenderIndex* renderIndex;
-};
-
-bool _DrawItemFilterPredicate(const SdfPath& rprimID, const void* predicateParam)
-{
-    const _FilterParam* filterParam = static_cast<const _FilterParam*>(predicateParam);
-
-    const TfTokenVector& renderTags = filterParam->renderTags;
-    const HdRenderIndex* renderIndex = filterParam->renderIndex;
-
-    //
-    // Render Tag Filter
-    //
-    if (renderTags.empty()) {
-        // An empty render tag set means everything passes the filter
-        // Primary user is tests, but some single task render delegates
-        // that don't support render tags yet also use it.
-        return true;
-    } else {
-        // As the number of tags is expected to be low (<10)
-        // use a simple linear search.
-        TfToken primRenderTag = renderIndex->GetRenderTag(rprimID);
-        size_t  numRenderTags = renderTags.size();
-        size_t  tagNum = 0;
-        while (tagNum < numRenderTags) {
-            if (renderTags[tagNum] == primRenderTag) {
-                return true;
-            }
-            ++tagNum;
-        }
-    }
-    return false;
-}
-#else
-struct _FilterParam
-{
-    const HdRprimCollection& collection;
-    const TfTokenVector&     renderTags;
-    const HdRenderIndex*     renderIndex;
-};
-
-bool _DrawItemFilterPredicate(const SdfPath& rprimID, const void* predicateParam)
-{
-    const _FilterParam* filterParam = static_cast<const _FilterParam*>(predicateParam);
-
-    const HdRprimCollection& collection = filterParam->collection;
-    const TfTokenVector&     renderTags = filterParam->renderTags;
-    const HdRenderIndex*     renderIndex = filterParam->renderIndex;
-
-    //
-    // Render Tag Filter
-    //
-    bool passedRenderTagFilter = false;
-    if (renderTags.empty()) {
-        // An empty render tag set means everything passes the filter
-        // Primary user is tests, but some single task render delegates
-        // that don't support render tags yet also use it.
-        passedRenderTagFilter = true;
-    } else {
-        // As the number of tags is expected to be low (<10)
-        // use a simple linear search.
-        TfToken primRenderTag = renderIndex->GetRenderTag(rprimID);
-        size_t  numRenderTags = renderTags.size();
-        size_t  tagNum = 0;
-        while (!passedRenderTagFilter && tagNum < numRenderTags) {
-            if (renderTags[tagNum] == primRenderTag) {
-                passedRenderTagFilter = true;
-            }
-            ++tagNum;
-        }
-    }
-
-    //
-    // Material Tag Filter
-    //
-    bool passedMaterialTagFilter = false;
-
-    // Filter out rprims that do not match the collection's materialTag.
-    // E.g. We may want to gather only opaque or translucent prims.
-    // An empty materialTag on collection means: ignore material-tags.
-    // This is important for tasks such as the selection-task which wants
-    // to ignore materialTags and receive all prims in its collection.
-    TfToken const& collectionMatTag = collection.GetMaterialTag();
-    if (collectionMatTag.IsEmpty() || renderIndex->GetMaterialTag(rprimID) == collectionMatTag) {
-        passedMaterialTagFilter = true;
-    }
-
-    return (passedRenderTagFilter && passedMaterialTagFilter);
-}
-#endif
-
 bool _longDurationRendering = false;
 
+//! Number of rprims whose dirty bits are read by one task when looking for render tag changes.
+constexpr size_t kRenderTagScanGrainSize = 1024;
+
 } // namespace
 
 //! \brief  Draw classification used during plugin load to register in VP2
@@ -936,6 +879,29 @@ void ProxyRenderDelegate::UpdateInstancingMapEntry(
     }
 }
 
+void ProxyRenderDelegate::UpdateRenderTagIndex(
+    const TfToken& oldRenderTag,
+    const TfToken& newRenderTag,
+    const SdfPath& rprimId)
+{
+    if (oldRenderTag == newRenderTag) {
+        return;
+    }
+
+    // remove the old entry from the index
+    if (!oldRenderTag.IsEmpty()) {
+        auto it = _rprimsByRenderTag.find(oldRenderTag);
+        if (it != _rprimsByRenderTag.end()) {
+            it->second.erase(rprimId);
+        }
+    }
+
+    // add new entry to the index
+    if (!newRenderTag.IsEmpty()) {
+        _rprimsByRenderTag[newRenderTag].insert(rprimId);
+    }
+}
+
 #ifdef MAYA_HAS_DISPLAY_LAYER_API
 void ProxyRenderDelegate::_DirtyUsdSubtree(const UsdPrim& prim)
 {
@@ -1030,36 +996,58 @@ bool ProxyRenderDelegate::_DirtyUfeSubtree(const MString& rootStr)
 }
 #endif
 
-void ProxyRenderDelegate::ComputeCombinedDisplayStyles(const unsigned int newDisplayStyle)
+void ProxyRenderDelegate::ComputeCombinedDisplayStyles(const MFrameContext& frameContext)
 {
-    // Add new display styles to the map
+    const unsigned int newDisplayStyle = frameContext.getDisplayStyle();
+
+    // Compute the display styles of the view being drawn
+    TfTokenVector viewStyles;
     if (newDisplayStyle & MHWRender::MFrameContext::kBoundingBox) {
-        _combinedDisplayStyles[HdVP2ReprTokens->bbox] = _frameCounter;
+        viewStyles.push_back(HdVP2ReprTokens->bbox);
     } else {
         if (newDisplayStyle & MHWRender::MFrameContext::kWireFrame) {
-            _combinedDisplayStyles[HdReprTokens->wire] = _frameCounter;
+            viewStyles.push_back(HdReprTokens->wire);
         }
 
         if (newDisplayStyle & MHWRender::MFrameContext::kGouraudShaded) {
 #ifdef HAS_DEFAULT_MATERIAL_SUPPORT_API
             if (newDisplayStyle & MHWRender::MFrameContext::kDefaultMaterial) {
-                _combinedDisplayStyles[HdVP2ReprTokens->defaultMaterial] = _frameCounter;
+                viewStyles.push_back(HdVP2ReprTokens->defaultMaterial);
             } else
 #endif
                 if (newDisplayStyle & MHWRender::MFrameContext::kTextured) {
-                _combinedDisplayStyles[HdReprTokens->smoothHull] = _frameCounter;
+                viewStyles.push_back(HdReprTokens->smoothHull);
             } else {
-                _combinedDisplayStyles[HdVP2ReprTokens->smoothHullUntextured] = _frameCounter;
+                viewStyles.push_back(HdVP2ReprTokens->smoothHullUntextured);
             }
         }
     }
 
-    // Erase aged styles
-    for (auto it = _combinedDisplayStyles.begin(); it != _combinedDisplayStyles.end();) {
+    // Track the display styles per view, so that a view which is not refreshed as often as the
+    // others, for example an orthographic view while tumbling the perspective one, keeps its
+    // reprs alive instead of having them aged out and resynced on its next refresh.
+    MString viewName;
+    frameContext.renderingDestination(viewName);
+    auto& viewDisplayStyles = _viewDisplayStyles[viewName.asChar()];
+    viewDisplayStyles._styles = std::move(viewStyles);
+    viewDisplayStyles._lastFrame = _frameCounter;
+
+    // Erase aged views, unless they are model panels which are still visible
+    for (auto it = _viewDisplayStyles.begin(); it != _viewDisplayStyles.end();) {
         auto          curIt = it++;
         constexpr int numFramesToAge = 8;
-        if (curIt->second + numFramesToAge < _frameCounter) {
-            _combinedDisplayStyles.erase(curIt);
+        if (curIt->second._lastFrame + numFramesToAge < _frameCounter
+            && !IsModelPanelVisible(curIt->first)) {
+            _viewDisplayStyles.erase(curIt);
+        }
+    }
+
+    // Combine the display styles of all the views
+    _combinedDisplayStyles.clear();
+    for (const auto& view : _viewDisplayStyles) {
+        for (const TfToken& style : view.second._styles) {
+            uint64_t& lastFrame = _combinedDisplayStyles[style];
+            lastFrame = std::max(lastFrame, view.second._lastFrame);
         }
     }
 
@@ -1140,7 +1128,7 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
         }
 #endif
     } else {
-        ComputeCombinedDisplayStyles(frameContext.getDisplayStyle());
+        ComputeCombinedDisplayStyles(frameContext);
 
         // Update repr selector based on combined display styles
         TfToken reprNames[HdReprSelector::MAX_TOPOLOGY_REPRS];
@@ -1160,9 +1148,13 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
 
         // check to see if representation mode changed
         if (_defaultCollection->GetReprSelector() != reprSelector) {
+            // Only a newly required repr needs the rprims to be synced. The render items of the
+            // reprs which are no longer required are kept, so dropping a repr costs nothing.
+            if (HasNewRepr(_defaultCollection->GetReprSelector(), reprSelector)) {
+                dirtyBits |= MayaUsdRPrim::DirtyDisplayMode;
+            }
             _defaultCollection->SetReprSelector(reprSelector);
             _taskController->SetCollection(*_defaultCollection);
-            dirtyBits |= MayaUsdRPrim::DirtyDisplayMode;
         }
 
         if (_colorPrefsChanged) {
@@ -1195,16 +1187,34 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
             }
         }
 
+        // if the texture resolution limit changed, materials need to acquire their textures again
+        const VtValue maxTextureResolution(GetMaxTextureResolution());
+        if (_renderDelegate->GetRenderSetting(HdVP2Tokens->maxTextureResolution)
+            != maxTextureResolution) {
+            _renderDelegate->SetRenderSetting(
+                HdVP2Tokens->maxTextureResolution, maxTextureResolution);
+
+            auto materials = _renderIndex->GetSprimSubtree(
+                HdPrimTypeTokens->material, SdfPath::AbsoluteRootPath());
+            for (auto material : materials) {
+                changeTracker.MarkSprimDirty(material, HdMaterial::DirtyParams);
+            }
+        }
+
         if (dirtyBits != HdChangeTracker::Clean) {
-            // Mark everything "dirty" so that sync is called on everything
-            // If there are multiple views up with different viewport modes then
-            // this is slow.
+            // Mark everything "dirty" so that sync is called on everything.
+            // Views are tracked individually, so this only happens when a view
+            // switches to a display style which none of the other views use.
             auto& rprims = _renderIndex->GetRprimIds();
             for (auto path : rprims) {
                 changeTracker.MarkRprimDirty(path, dirtyBits);
             }
         }
 
+        // Generate the fragments of the new MaterialX materials concurrently, before they are
+        // synced one at a time.
+        HdVP2Material::PrepareMaterialXFragments(*_renderIndex, _sceneDelegate.get());
+
         _engine.Execute(_renderIndex.get(), &_dummyTasks);
     }
 }
@@ -1900,12 +1910,26 @@ void ProxyRenderDelegate::_UpdateRenderTags()
     // to an individual rprim or not.
     bool rprimRenderTagChanged = !_changeVersions.renderTagValid(changeTracker);
     if (rprimRenderTagChanged) {
-        for (auto path : _renderIndex->GetRprimIds()) {
-            if (changeTracker.GetRprimDirtyBits(path) & HdChangeTracker::DirtyRenderTag) {
-                // Since USD 23.02, DirtyRenderTag is not enough to provoke a sync,
-                // so we add an extra dirty flag - DirtyVisibility
-                changeTracker.MarkRprimDirty(path, HdChangeTracker::DirtyVisibility);
-            }
+        // The change tracker doesn't keep a list of the rprims with a given dirty bit, so the
+        // dirty bits are read in parallel (read-only access to the change tracker is safe) and
+        // the matching rprims are marked dirty afterwards, on this thread.
+        const SdfPathVector&            rprimIds = _renderIndex->GetRprimIds();
+        tbb::concurrent_vector<SdfPath> renderTagDirtyIds;
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, rprimIds.size(), kRenderTagScanGrainSize),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    if (changeTracker.GetRprimDirtyBits(rprimIds[i])
+                        & HdChangeTracker::DirtyRenderTag) {
+                        renderTagDirtyIds.push_back(rprimIds[i]);
+                    }
+                }
+            });
+
+        for (const SdfPath& path : renderTagDirtyIds) {
+            // Since USD 23.02, DirtyRenderTag is not enough to provoke a sync,
+            // so we add an extra dirty flag - DirtyVisibility
+            changeTracker.MarkRprimDirty(path, HdChangeTracker::DirtyVisibility);
         }
     }
 
@@ -1933,17 +1957,24 @@ void ProxyRenderDelegate::_UpdateRenderTags()
             changedRenderTags.push_back(HdRenderTagTokens->guide);
         }
 
-        // Mark all the rprims which have a render tag which changed dirty
-        SdfPathVector rprimsToDirty = _GetFilteredRprims(*_defaultCollection, changedRenderTags);
+        // Mark all the rprims which have a render tag which changed dirty. The render tag
+        // index only holds the rprims of the changed tags, so there is no need to filter
+        // every rprim of the render index.
+        for (const TfToken& renderTag : changedRenderTags) {
+            auto it = _rprimsByRenderTag.find(renderTag);
+            if (it == _rprimsByRenderTag.end()) {
+                continue;
+            }
 
-        for (auto& id : rprimsToDirty) {
-            // this call to MarkRprimDirty will increment the change tracker render
-            // tag version. We don't want this to cause rprimRenderTagChanged to be
-            // true when a tag hasn't actually changed.
-            // Since USD 23.02, DirtyRenderTag is not enough to provoke a sync,
-            // so we add an extra dirty flag - DirtyVisibility
-            changeTracker.MarkRprimDirty(
-                id, HdChangeTracker::DirtyRenderTag | HdChangeTracker::DirtyVisibility);
+            for (const SdfPath& id : it->second) {
+                // this call to MarkRprimDirty will increment the change tracker render
+                // tag version. We don't want this to cause rprimRenderTagChanged to be
+                // true when a tag hasn't actually changed.
+                // Since USD 23.02, DirtyRenderTag is not enough to provoke a sync,
+                // so we add an extra dirty flag - DirtyVisibility
+                changeTracker.MarkRprimDirty(
+                    id, HdChangeTracker::DirtyRenderTag | HdChangeTracker::DirtyVisibility);
+            }
         }
     }
 
@@ -1978,27 +2009,6 @@ void ProxyRenderDelegate::_UpdateRenderTags()
     // the future.
 }
 
-//! \brief  List the rprims in collection that match renderTags
-SdfPathVector ProxyRenderDelegate::_GetFilteredRprims(
-    HdRprimCollection const& collection,
-    TfTokenVector const&     renderTags)
-{
-    SdfPathVector        rprimIds;
-    const SdfPathVector& paths = _renderIndex->GetRprimIds();
-    const SdfPathVector& includePaths = collection.GetRootPaths();
-    const SdfPathVector& excludePaths = collection.GetExcludePaths();
-#if defined(HD_API_VERSION) && HD_API_VERSION >= 42
-    _FilterParam filterParam = { renderTags, _renderIndex.get() };
-#else
-    _FilterParam filterParam = { collection, renderTags, _renderIndex.get() };
-#endif
-    HdPrimGather gather;
-    gather.PredicatedFilter(
-        paths, includePaths, excludePaths, _DrawItemFilterPredicate, &filterParam, &rprimIds);
-
-    return rprimIds;
-}
-
 //! \brief  Query the selection state of a given prim from the lead selection.
 const HdSelection::PrimSelectionState*
 ProxyRenderDelegate::GetLeadSelectionState(const SdfPath& path) const
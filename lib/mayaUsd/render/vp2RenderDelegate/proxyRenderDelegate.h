@@ -19,6 +19,7 @@
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/utils/util.h>
 
+#include <pxr/base/tf/token.h>
 #include <pxr/imaging/hd/engine.h>
 #include <pxr/imaging/hd/selection.h>
 #include <pxr/imaging/hd/task.h>
@@ -39,7 +40,11 @@
 #include <ufe/observer.h>
 #include <ufe/path.h>
 
+#include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 // Use the latest MPxSubSceneOverride API
 #ifndef OPENMAYA_MPXSUBSCENEOVERRIDE_LATEST_NAMESPACE
@@ -251,6 +256,12 @@ public:
         const InstancePrototypePath& newPathInPrototype,
         const SdfPath&               rprimId);
 
+    MAYAUSD_CORE_PUBLIC
+    void UpdateRenderTagIndex(
+        const TfToken& oldRenderTag,
+        const TfToken& newRenderTag,
+        const SdfPath& rprimId);
+
 #ifdef MAYA_NEW_POINT_SNAPPING_SUPPORT
     MAYAUSD_CORE_PUBLIC
     bool SnapToSelectedObjects() const;
@@ -292,10 +303,8 @@ private:
     void _DirtyUsdSubtree(const UsdPrim& prim);
 #endif
     void _RequestRefresh();
-    SdfPathVector
-    _GetFilteredRprims(HdRprimCollection const& collection, TfTokenVector const& renderTags);
 
-    void ComputeCombinedDisplayStyles(const unsigned int newDisplayStyle);
+    void ComputeCombinedDisplayStyles(const MHWRender::MFrameContext& frameContext);
 
     /*! \brief  Hold all data related to the proxy shape.
 
@@ -357,11 +366,24 @@ private:
     std::unique_ptr<UsdImagingDelegate> _sceneDelegate; //!< USD scene delegate
     const MHWRender::MFrameContext*     _currentFrameContext = nullptr;
     std::map<TfToken, uint64_t>         _combinedDisplayStyles;
+
+    //! Display styles of a view, and the frame at which the view was last drawn.
+    struct ViewDisplayStyles
+    {
+        TfTokenVector _styles;
+        uint64_t      _lastFrame { 0 };
+    };
+    std::map<std::string, ViewDisplayStyles> _viewDisplayStyles;
     bool                                _needTexturedMaterials = false;
 
     // maps from a path in USD prototype to the corresponding rprim paths
     std::multimap<InstancePrototypePath, SdfPath> _instancingMap;
 
+    // maps from a render tag to the rprims which currently have that render tag, so that a
+    // purpose toggle only dirties the affected rprims instead of filtering the whole index.
+    using RprimIdSet = std::unordered_set<SdfPath, SdfPath::Hash>;
+    std::unordered_map<TfToken, RprimIdSet, TfToken::HashFunctor> _rprimsByRenderTag;
+
     bool _isPopulated {
         false
     }; //!< If false, scene delegate wasn't populated yet within render index
@@ -436,7 +436,7 @@ public:
         return shader;
     }
 
-    MHWRender::MShaderInstance* GetShaderFromCache(const TfToken& id)
+    MHWRender::MShaderInstance* GetShaderFromCache(const HdVP2ShaderCacheKey& id)
     {
         tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
 
@@ -447,9 +447,17 @@ public:
         return (shader ? shader->clone() : nullptr);
     }
 
+    bool HasShaderInCache(const HdVP2ShaderCacheKey& id)
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
+
+        return _userCache._map.find(id) != _userCache._map.cend();
+    }
+
     /*! \brief  Adds a clone of the shader to the cache with the specified id if it doesn't exist.
      */
-    bool AddShaderToCache(const TfToken& id, const MHWRender::MShaderInstance& shader)
+    bool
+    AddShaderToCache(const HdVP2ShaderCacheKey& id, const MHWRender::MShaderInstance& shader)
     {
         tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
 
@@ -467,7 +475,7 @@ public:
     /*! \brief  Returns the cached primvars associated with a shader entry.
                 Will return nullptr if there are no primvars associated with the shader id.
      */
-    const TfTokenVector* GetPrimvarsFromCache(const TfToken& id)
+    const TfTokenVector* GetPrimvarsFromCache(const HdVP2ShaderCacheKey& id)
     {
         tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
 
@@ -478,7 +486,7 @@ public:
 
     /*! \brief  Adds the primvars associated with a shader id to the cache.
      */
-    bool AddPrimvarsToCache(const TfToken& id, const TfTokenVector& primvars)
+    bool AddPrimvarsToCache(const HdVP2ShaderCacheKey& id, const TfTokenVector& primvars)
     {
         tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
 
@@ -496,7 +504,8 @@ public:
                 Will return nullptr if there are no renamed parameters associated with the shader
        id.
     */
-    const HdVP2ShaderCache::StringMap* GetRenamedParametersFromCache(const TfToken& id)
+    const HdVP2ShaderCache::StringMap*
+    GetRenamedParametersFromCache(const HdVP2ShaderCacheKey& id)
     {
         tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
 
@@ -508,7 +517,7 @@ public:
     /*! \brief  Adds the renamed parameters associated with a shader id to the cache.
      */
     bool AddRenamedParametersToCache(
-        const TfToken&                     id,
+        const HdVP2ShaderCacheKey&         id,
         const HdVP2ShaderCache::StringMap& renamedParameters)
     {
         tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, false /*write*/);
@@ -524,6 +533,24 @@ public:
     }
 #endif
 
+#if !defined(NDEBUG)
+    /*! \brief  Records the description a key was built from and reports a coding error if the
+                same key was previously built from a different description.
+     */
+    void VerifyShaderCacheKey(const HdVP2ShaderCacheKey& id, const std::string& description)
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_userCache._mutex, true /*write*/);
+
+        const auto result = _userCache._descriptions.emplace(id, description);
+        if (!result.second && result.first->second != description) {
+            TF_CODING_ERROR(
+                "Shader cache key collision between:\n%s\nand:\n%s",
+                result.first->second.c_str(),
+                description.c_str());
+        }
+    }
+#endif
+
     void OnMayaExit()
     {
         if (_isInitialized) {
@@ -666,6 +693,8 @@ HdVP2RenderDelegate::HdVP2RenderDelegate(ProxyRenderDelegate& drawScene)
 
     // The shader cache should be initialized after registration of shader fragments.
     sShaderCache.Initialize();
+
+    _PopulateDefaultSettings(GetRenderSettingDescriptors());
 }
 
 /*! \brief  Destructor.
@@ -1032,15 +1061,23 @@ MString HdVP2RenderDelegate::GetLocalNodeName(const MString& name) const
 
 /*! \brief  Returns a clone of the shader entry stored in the cache with the specified id.
  */
-MHWRender::MShaderInstance* HdVP2RenderDelegate::GetShaderFromCache(const TfToken& id)
+MHWRender::MShaderInstance*
+HdVP2RenderDelegate::GetShaderFromCache(const HdVP2ShaderCacheKey& id)
 {
     return sShaderCache.GetShaderFromCache(id);
 }
 
+/*! \brief  Returns true if a shader is stored in the cache with the specified id.
+ */
+bool HdVP2RenderDelegate::HasShaderInCache(const HdVP2ShaderCacheKey& id)
+{
+    return sShaderCache.HasShaderInCache(id);
+}
+
 /*! \brief  Adds a clone of the shader to the cache with the specified id if it doesn't exist.
  */
 bool HdVP2RenderDelegate::AddShaderToCache(
-    const TfToken&                    id,
+    const HdVP2ShaderCacheKey&        id,
     const MHWRender::MShaderInstance& shader)
 {
     return sShaderCache.AddShaderToCache(id, shader);
@@ -1050,14 +1087,16 @@ bool HdVP2RenderDelegate::AddShaderToCache(
 /*! \brief  Returns the cached primvars associated with a shader entry.
             Will return nullptr if there are no primvars associated with the shader id.
  */
-const TfTokenVector* HdVP2RenderDelegate::GetPrimvarsFromCache(const TfToken& id)
+const TfTokenVector* HdVP2RenderDelegate::GetPrimvarsFromCache(const HdVP2ShaderCacheKey& id)
 {
     return sShaderCache.GetPrimvarsFromCache(id);
 }
 
 /*! \brief  Adds the primvars associated with a shader id to the cache.
  */
-bool HdVP2RenderDelegate::AddPrimvarsToCache(const TfToken& id, const TfTokenVector& primvars)
+bool HdVP2RenderDelegate::AddPrimvarsToCache(
+    const HdVP2ShaderCacheKey& id,
+    const TfTokenVector&       primvars)
 {
     return sShaderCache.AddPrimvarsToCache(id, primvars);
 }
@@ -1066,7 +1105,7 @@ bool HdVP2RenderDelegate::AddPrimvarsToCache(const TfToken& id, const TfTokenVec
             Will return nullptr if there are no renamed parameters associated with the shader id.
  */
 const HdVP2ShaderCache::StringMap*
-HdVP2RenderDelegate::GetRenamedParametersFromCache(const TfToken& id)
+HdVP2RenderDelegate::GetRenamedParametersFromCache(const HdVP2ShaderCacheKey& id)
 {
     return sShaderCache.GetRenamedParametersFromCache(id);
 }
@@ -1074,7 +1113,7 @@ HdVP2RenderDelegate::GetRenamedParametersFromCache(const TfToken& id)
 /*! \brief  Adds the renamed parameters associated with a shader id to the cache.
  */
 bool HdVP2RenderDelegate::AddRenamedParametersToCache(
-    const TfToken&                     id,
+    const HdVP2ShaderCacheKey&         id,
     const HdVP2ShaderCache::StringMap& renamedParameters)
 {
     return sShaderCache.AddRenamedParametersToCache(id, renamedParameters);
@@ -1082,6 +1121,17 @@ bool HdVP2RenderDelegate::AddRenamedParametersToCache(
 
 #endif
 
+#if !defined(NDEBUG)
+/*! \brief  Reports a coding error if the key was previously built from a different description.
+ */
+void HdVP2RenderDelegate::VerifyShaderCacheKey(
+    const HdVP2ShaderCacheKey& id,
+    const std::string&         description)
+{
+    sShaderCache.VerifyShaderCacheKey(id, description);
+}
+#endif
+
 /*! \brief  Returns a fallback shader instance when no material is bound.
 
     This method is keeping registry of all fallback shaders generated, allowing only
@@ -1222,6 +1272,19 @@ HdVP2RenderDelegate::GetSamplerState(const MHWRender::MSamplerStateDesc& desc) c
  */
 const HdVP2BBoxGeom& HdVP2RenderDelegate::GetSharedBBoxGeom() const { return *sSharedBBoxGeom; }
 
+HdRenderSettingDescriptorList HdVP2RenderDelegate::GetRenderSettingDescriptors() const
+{
+    static const HdRenderSettingDescriptorList descriptors {
+        { "Max Texture Resolution", HdVP2Tokens->maxTextureResolution, VtValue(0) }
+    };
+    return descriptors;
+}
+
+int HdVP2RenderDelegate::GetMaxTextureResolution() const
+{
+    return GetRenderSetting<int>(HdVP2Tokens->maxTextureResolution, 0);
+}
+
 void HdVP2RenderDelegate::CleanupMaterials()
 {
     for (const auto& sprim : _materialSprims) {
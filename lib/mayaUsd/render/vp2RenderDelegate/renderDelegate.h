@@ -127,6 +127,11 @@ public:
 
     bool IsPrimvarFilteringNeeded() const override { return true; }
 
+    HdRenderSettingDescriptorList GetRenderSettingDescriptors() const override;
+
+    //! Maximum texture width or height used in the viewport, 0 when unlimited.
+    int GetMaxTextureResolution() const;
+
     MString GetLocalNodeName(const MString& name) const;
 
     MHWRender::MShaderInstance* GetFallbackShader(const MColor& color) const;
@@ -148,16 +153,21 @@ public:
     MHWRender::MShaderInstance*
     GetBasisCurvesCPVShader(const TfToken& curveType, const TfToken& curveBasis) const;
 
-    MHWRender::MShaderInstance* GetShaderFromCache(const TfToken& id);
-    bool AddShaderToCache(const TfToken& id, const MHWRender::MShaderInstance& shader);
+    MHWRender::MShaderInstance* GetShaderFromCache(const HdVP2ShaderCacheKey& id);
+    bool                        HasShaderInCache(const HdVP2ShaderCacheKey& id);
+    bool AddShaderToCache(const HdVP2ShaderCacheKey& id, const MHWRender::MShaderInstance& shader);
 #ifdef WANT_MATERIALX_BUILD
-    const TfTokenVector* GetPrimvarsFromCache(const TfToken& id);
-    bool                 AddPrimvarsToCache(const TfToken& id, const TfTokenVector& primvars);
-    const HdVP2ShaderCache::StringMap* GetRenamedParametersFromCache(const TfToken& id);
+    const TfTokenVector* GetPrimvarsFromCache(const HdVP2ShaderCacheKey& id);
+    bool AddPrimvarsToCache(const HdVP2ShaderCacheKey& id, const TfTokenVector& primvars);
+    const HdVP2ShaderCache::StringMap*
+         GetRenamedParametersFromCache(const HdVP2ShaderCacheKey& id);
     bool                               AddRenamedParametersToCache(
-                                      const TfToken&                     id,
+                                      const HdVP2ShaderCacheKey&         id,
                                       const HdVP2ShaderCache::StringMap& renamedParameters);
 #endif
+#if !defined(NDEBUG)
+    void VerifyShaderCacheKey(const HdVP2ShaderCacheKey& id, const std::string& description);
+#endif
 
     const MHWRender::MSamplerState* GetSamplerState(const MHWRender::MSamplerStateDesc& desc) const;
 
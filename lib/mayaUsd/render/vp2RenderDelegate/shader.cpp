@@ -15,10 +15,17 @@
 //
 #include "shader.h"
 
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec4f.h>
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/vt/types.h>
 
 #include <maya/MGlobal.h>
 
+#include <cstring>
 #include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -33,6 +40,28 @@ DeadShaders& getDeadShaders()
     return dead;
 }
 
+//! MurmurHash3 64-bit finalizer.
+uint64_t mixLow(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+//! SplitMix64 finalizer, independent from the one above.
+uint64_t mixHigh(uint64_t h)
+{
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
 void addDeadShader(MHWRender::MShaderInstance* shader)
 {
     if (!shader)
@@ -162,4 +191,80 @@ void HdVP2ShaderUniquePtr::clear()
     _data = nullptr;
 }
 
+void HdVP2ShaderCacheKey::Append(uint64_t value)
+{
+    _low = mixLow(_low ^ (value + 0x9e3779b97f4a7c15ULL));
+    _high = mixHigh((_high + 0xc2b2ae3d27d4eb4fULL) ^ ((value << 29) | (value >> 35)));
+}
+
+void HdVP2ShaderCacheKey::Append(const void* data, size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + offset, sizeof(word));
+        Append(word);
+    }
+
+    if (offset < size) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + offset, size - offset);
+        Append(word);
+    }
+
+    // The size delimits consecutive strings, so that "ab" + "c" differs from "a" + "bc".
+    Append(static_cast<uint64_t>(size));
+}
+
+namespace {
+
+//! Appends the bytes of the value if it holds a T, which must have no padding.
+template <typename T> bool appendValueBytes(HdVP2ShaderCacheKey& key, const VtValue& value)
+{
+    if (!value.IsHolding<T>())
+        return false;
+
+    const T& heldValue = value.UncheckedGet<T>();
+    key.Append(&heldValue, sizeof(T));
+    return true;
+}
+
+//! Appends the bytes of the elements of the value if it holds a VtArray<T>.
+template <typename T> bool appendArrayBytes(HdVP2ShaderCacheKey& key, const VtValue& value)
+{
+    if (!value.IsHolding<VtArray<T>>())
+        return false;
+
+    const VtArray<T>& array = value.UncheckedGet<VtArray<T>>();
+    key.Append(array.cdata(), array.size() * sizeof(T));
+    return true;
+}
+
+} // namespace
+
+void HdVP2ShaderCacheKey::Append(const VtValue& value)
+{
+    // The whole value is fed to both halves of the key: its hash would only give 64 bits.
+    // The common parameter types are appended as bytes, the others by their text form.
+    Append(value.GetTypeName());
+    if (appendValueBytes<float>(*this, value) || appendValueBytes<int>(*this, value)
+        || appendValueBytes<bool>(*this, value) || appendValueBytes<double>(*this, value)
+        || appendValueBytes<GfVec2f>(*this, value) || appendValueBytes<GfVec3f>(*this, value)
+        || appendValueBytes<GfVec4f>(*this, value) || appendValueBytes<GfMatrix4d>(*this, value)
+        || appendArrayBytes<float>(*this, value) || appendArrayBytes<GfVec2f>(*this, value)
+        || appendArrayBytes<GfVec3f>(*this, value)) {
+        return;
+    }
+
+    if (value.IsHolding<TfToken>()) {
+        Append(value.UncheckedGet<TfToken>());
+    } else if (value.IsHolding<std::string>()) {
+        Append(value.UncheckedGet<std::string>());
+    } else {
+        Append(TfStringify(value));
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -17,13 +17,17 @@
 #define HD_VP2_SHADER
 
 #include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
 #include <pxr/pxr.h>
 
 #include <maya/MShaderManager.h>
 
 #include <tbb/spin_rw_mutex.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -59,21 +63,63 @@ private:
     Data* _data { nullptr };
 };
 
+/*! \brief  128-bit key identifying a shader in the shader cache.
+
+    The key is accumulated from the structure of a material network (nodes, connections and
+    parameter values) instead of interning a serialized description of the network as a token.
+    Both halves are fed the same data through independent mixing functions. Strings are hashed
+    by content, so keys remain valid after the tokens and paths they were built from expire.
+    Parameter values are hashed by content as well, rather than through their 64-bit hash.
+ */
+struct HdVP2ShaderCacheKey
+{
+    uint64_t _low { 0x243f6a8885a308d3ULL };  //!< First half of the key
+    uint64_t _high { 0x13198a2e03707344ULL }; //!< Second half of the key
+
+    void Append(uint64_t value);
+    void Append(const void* data, size_t size);
+    void Append(const std::string& value) { Append(value.data(), value.size()); }
+    void Append(const TfToken& value) { Append(value.GetString()); }
+    void Append(const VtValue& value);
+
+    bool operator==(const HdVP2ShaderCacheKey& other) const
+    {
+        return _low == other._low && _high == other._high;
+    }
+    bool operator!=(const HdVP2ShaderCacheKey& other) const { return !(*this == other); }
+
+    struct HashFunctor
+    {
+        size_t operator()(const HdVP2ShaderCacheKey& key) const
+        {
+            return static_cast<size_t>(key._low ^ (key._high * 0x9e3779b97f4a7c15ULL));
+        }
+    };
+};
+
 /*! \brief  Thread-safe cache of named shaders.
  */
 struct HdVP2ShaderCache
 {
+    template <typename T>
+    using KeyMap = std::unordered_map<HdVP2ShaderCacheKey, T, HdVP2ShaderCacheKey::HashFunctor>;
+
     //! Shader registry
-    std::unordered_map<TfToken, HdVP2ShaderUniquePtr, TfToken::HashFunctor> _map;
+    KeyMap<HdVP2ShaderUniquePtr> _map;
 
 #ifdef WANT_MATERIALX_BUILD
     //! Primvars registry
-    std::unordered_map<TfToken, TfTokenVector, TfToken::HashFunctor> _primvars;
+    KeyMap<TfTokenVector> _primvars;
 
     //! Map of renamed parameters. Happens if the parameter name is a forbidden keyword in the
     //! shading language.
     using StringMap = std::unordered_map<std::string, MString>;
-    std::unordered_map<TfToken, StringMap, TfToken::HashFunctor> _renamedParameters;
+    KeyMap<StringMap> _renamedParameters;
+#endif
+
+#if !defined(NDEBUG)
+    //! Full description of the network each key was built from, used to detect key collisions.
+    KeyMap<std::string> _descriptions;
 #endif
 
     //! Synchronization used to protect concurrent read from serial writes
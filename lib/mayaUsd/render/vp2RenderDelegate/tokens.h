@@ -33,6 +33,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 #define HDVP2_TOKENS \
     (displayColorAndOpacity) \
     (glslfx) \
+    (maxTextureResolution) \
     (mtlx)
 
 // clang-format on
@@ -144,6 +144,9 @@ void MayaStagesSubject::clearListeners()
         });
     _stageListeners.clear();
 
+    // The stages may be closed, their PointInstancer values can no longer be diffed.
+    clearPointInstancerBaselines();
+
     // Set up our stage to proxy shape UFE path (and reverse)
     // mapping.  We do this with the following steps:
     // - get all proxyShape nodes in the scene.
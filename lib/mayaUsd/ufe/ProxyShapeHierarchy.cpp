@@ -132,22 +132,25 @@ Ufe::SceneItem::Ptr ProxyShapeHierarchy::sceneItem() const { return _item; }
 
 bool ProxyShapeHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !children().empty();
+    // Use the same logic as children(), which remaps and filters the prims in
+    // createUFEChildList, but stop at the first child.
+    const UsdPrim& rootPrim = getUsdRootPrim();
+    if (!rootPrim.IsValid())
+        return false;
+
+    return !createUFEChildList(getUSDFilteredChildren(rootPrim), true /*filterInactive*/, 0, 1)
+                .empty();
 }
 
 bool ProxyShapeHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !filteredChildren(childFilter).empty();
+    // Same as hasChildren(): stop at the first child.
+    const UsdPrim& rootPrim = getUsdRootPrim();
+    if (!rootPrim.IsValid())
+        return false;
+
+    Usd_PrimFlagsPredicate flags = UsdUfe::getUsdPredicate(childFilter);
+    return !createUFEChildList(getUSDFilteredChildren(rootPrim, flags), false, 0, 1).empty();
 }
 
 #else
@@ -159,12 +162,10 @@ bool ProxyShapeHierarchy::hasChildren() const
     if (!rootPrim.IsValid())
         return false;
 
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !createUFEChildList(getUSDFilteredChildren(rootPrim), false /*filterInactive*/).empty();
+    // Use the same logic as children(), which remaps and filters the prims in
+    // createUFEChildList, but stop at the first child.
+    return !createUFEChildList(getUSDFilteredChildren(rootPrim), false /*filterInactive*/, 0, 1)
+                .empty();
 }
 
 #endif
@@ -190,9 +191,35 @@ Ufe::SceneItemList ProxyShapeHierarchy::filteredChildren(const ChildFilter& chil
     return createUFEChildList(getUSDFilteredChildren(rootPrim, flags), false);
 }
 
+Ufe::SceneItemList ProxyShapeHierarchy::childrenPage(size_t first, size_t count) const
+{
+    const UsdPrim& rootPrim = getUsdRootPrim();
+    if (!rootPrim.IsValid())
+        return Ufe::SceneItemList();
+
+    return createUFEChildList(
+        getUSDFilteredChildren(rootPrim), true /*filterInactive*/, first, count);
+}
+
+Ufe::SceneItemList ProxyShapeHierarchy::filteredChildrenPage(
+    const ChildFilter& childFilter,
+    size_t             first,
+    size_t             count) const
+{
+    const UsdPrim& rootPrim = getUsdRootPrim();
+    if (!rootPrim.IsValid())
+        return Ufe::SceneItemList();
+
+    Usd_PrimFlagsPredicate flags = UsdUfe::getUsdPredicate(childFilter);
+    return createUFEChildList(getUSDFilteredChildren(rootPrim, flags), false, first, count);
+}
+
 // Return UFE child list from input USD child list.
-Ufe::SceneItemList
-ProxyShapeHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool filterInactive) const
+Ufe::SceneItemList ProxyShapeHierarchy::createUFEChildList(
+    const UsdPrimSiblingRange& range,
+    bool                       filterInactive,
+    size_t                     first,
+    size_t                     count) const
 {
     // We must create selection items for our children.  These will have as
     // path the path of the proxy shape, with a single path segment of a
@@ -208,7 +235,13 @@ ProxyShapeHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool f
         return children;
     }
 
+    // Children before first are only counted: no scene item is created for them.
+    size_t skipped = 0;
     for (const auto& child : range) {
+        if (children.size() >= count) {
+            break;
+        }
+
         const SdfPath& childPath = child.GetPath();
         const bool     isAncestorOrDescendant
             = childPath.HasPrefix(primPath) || primPath.HasPrefix(childPath);
@@ -221,12 +254,20 @@ ProxyShapeHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool f
             // if we mapped to a valid object, insert it. it's possible that we got stale object
             // so in this case simply fallback to the usual processing of items
             if (item) {
-                children.emplace_back(item);
+                if (skipped < first) {
+                    ++skipped;
+                } else {
+                    children.emplace_back(item);
+                }
                 continue;
             }
         }
 #endif
         if (!filterInactive || child.IsActive()) {
+            if (skipped < first) {
+                ++skipped;
+                continue;
+            }
             children.emplace_back(UsdUfe::UsdSceneItem::create(
                 parentPath
                     + Ufe::PathSegment(
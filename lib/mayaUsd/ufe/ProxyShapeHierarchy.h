@@ -18,6 +18,7 @@
 
 #include <mayaUsd/base/api.h>
 
+#include <usdUfe/ufe/PagedHierarchy.h>
 #include <usdUfe/ufe/UfeVersionCompat.h>
 #include <usdUfe/ufe/UsdSceneItem.h>
 
@@ -25,6 +26,8 @@
 #include <ufe/hierarchyHandler.h>
 #include <ufe/selection.h>
 
+#include <limits>
+
 namespace MAYAUSD_NS_DEF {
 namespace ufe {
 
@@ -34,7 +37,9 @@ namespace ufe {
     the USD gateway node.  This node is special in that its parent is a Maya
     node, but its children are children of the USD root prim.
  */
-class MAYAUSD_CORE_PUBLIC ProxyShapeHierarchy : public Ufe::Hierarchy
+class MAYAUSD_CORE_PUBLIC ProxyShapeHierarchy
+    : public Ufe::Hierarchy
+    , public UsdUfe::PagedHierarchy
 {
 public:
     typedef std::shared_ptr<ProxyShapeHierarchy> Ptr;
@@ -81,10 +86,21 @@ public:
     Ufe::UndoableCommand::Ptr ungroupCmd() const override;
 #endif
 
+    // UsdUfe::PagedHierarchy overrides
+    Ufe::SceneItemList childrenPage(size_t first, size_t count) const override;
+    Ufe::SceneItemList
+    filteredChildrenPage(const ChildFilter& childFilter, size_t first, size_t count) const override;
+
 private:
     const PXR_NS::UsdPrim& getUsdRootPrim() const;
-    Ufe::SceneItemList
-    createUFEChildList(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
+
+    //! Return the children in range, skipping the first ones and stopping once
+    //! count children were found.
+    Ufe::SceneItemList createUFEChildList(
+        const PXR_NS::UsdPrimSiblingRange& range,
+        bool                               filterInactive,
+        size_t                             first = 0,
+        size_t                             count = std::numeric_limits<size_t>::max()) const;
 
 private:
     Ufe::SceneItem::Ptr        _item;
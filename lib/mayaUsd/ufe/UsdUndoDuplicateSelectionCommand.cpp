@@ -17,6 +17,7 @@
 
 #include <mayaUsd/ufe/Utils.h>
 
+#include <usdUfe/ufe/ChildNameIndex.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
 #include <usdUfe/utils/usdUtils.h>
 
@@ -83,7 +84,8 @@ UsdUndoDuplicateSelectionCommand::Ptr UsdUndoDuplicateSelectionCommand::create(
 
 void UsdUndoDuplicateSelectionCommand::execute()
 {
-    UsdUfe::UsdUndoBlock undoBlock(&_undoableItem);
+    UsdUfe::UsdUndoBlock          undoBlock(&_undoableItem);
+    UsdUfe::ChildNameIndex::Batch nameBatch;
 
     for (auto&& usdItem : _sourceItems) {
         // Need to create and execute. If we create all before executing any, then the collision
@@ -25,6 +25,7 @@
 #include <mayaUsd/fileio/primUpdaterManager.h>
 #endif
 
+#include <usdUfe/ufe/ChildNameIndex.h>
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/utils/layers.h>
 #include <usdUfe/utils/usdUtils.h>
@@ -143,6 +144,19 @@ std::string uniqueChildNameMayaStandard(
     if (!usdParent.IsValid())
         return std::string();
 
+    // During a batch, use the indexed children names rather than gathering them again.
+    // Same rules as below: see the comments there.
+    if (excludeName == nullptr) {
+        if (UsdUfe::ChildNameIndex::Names* names = UsdUfe::ChildNameIndex::find(usdParent)) {
+            std::string baseName, suffix;
+            UsdUfe::splitNumericalSuffix(name, baseName, suffix);
+            if (names->contains(name) || names->hasSuffixedBase(baseName)) {
+                return names->uniqueNameMaxSuffix(name);
+            }
+            return name;
+        }
+    }
+
     // See uniqueChildNameDefault() in lib\usdUfe\ufe\Utils.cpp for details.
     // Note: removed 'UsdPrimIsAbstract' from the predicate since the Maya
     //       Outliner can show class prims now.
@@ -1890,6 +1890,10 @@ VtDictionary UsdMayaUtil::GetDictionaryFromArgDatabase(
             double val = 0.0;
             argData.getFlagArgument(key.c_str(), 0, val);
             args[key] = val;
+        } else if (guideValue.IsHolding<int>()) {
+            int val = 0;
+            argData.getFlagArgument(key.c_str(), 0, val);
+            args[key] = val;
         } else if (guideValue.IsHolding<std::vector<VtValue>>()) {
             unsigned int count = argData.numberOfFlagUses(entry.first.c_str());
             if (!TF_VERIFY(count > 0)) {
@@ -66,6 +66,19 @@ double extractDouble(const VtDictionary& userArgs, const TfToken& key, double de
     return defaultValue;
 }
 
+/// Extracts an int at \p key from \p userArgs, or defaultValue if it can't extract.
+int extractInt(const VtDictionary& userArgs, const TfToken& key, int defaultValue)
+{
+    if (VtDictionaryIsHolding<int>(userArgs, key))
+        return VtDictionaryGet<int>(userArgs, key);
+
+    TF_CODING_ERROR(
+        "Dictionary is missing required key '%s' or key is "
+        "not int type",
+        key.GetText());
+    return defaultValue;
+}
+
 /// Extracts a string at \p key from \p userArgs, or "" if it can't extract.
 std::string extractString(const VtDictionary& userArgs, const TfToken& key)
 {
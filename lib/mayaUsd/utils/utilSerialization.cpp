@@ -24,6 +24,9 @@
 #include <mayaUsd/utils/util.h>
 #include <mayaUsd/utils/utilFileSystem.h>
 
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/fastCompression.h>
+#include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/usd/sdf/layerUtils.h>
 #include <pxr/usd/usd/stageCacheContext.h>
@@ -45,7 +48,13 @@
 
 #include <ghc/filesystem.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <string>
+#include <vector>
 
 namespace {
 
@@ -65,6 +74,154 @@ public:
     std::vector<std::string> _paths;
 };
 
+// Header of the layers serialized as usdc crate bytes encoded in base64.
+constexpr char kCrateHeader[] = "#mayaUsd usdc\n";
+
+// Header of the layers serialized as compressed usdc crate bytes encoded in base64.
+// It is followed by the size of the uncompressed bytes and a new line.
+constexpr char kCompressedCrateHeader[] = "#mayaUsd usdc-lz4 ";
+
+constexpr char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void appendBase64(const char* data, size_t size, std::string& out)
+{
+    out.reserve(out.size() + (size + 2) / 3 * 4);
+
+    size_t i = 0;
+    for (; i + 2 < size; i += 3) {
+        const uint32_t n = (uint32_t(uint8_t(data[i])) << 16)
+            | (uint32_t(uint8_t(data[i + 1])) << 8) | uint32_t(uint8_t(data[i + 2]));
+        out += kBase64Chars[(n >> 18) & 63];
+        out += kBase64Chars[(n >> 12) & 63];
+        out += kBase64Chars[(n >> 6) & 63];
+        out += kBase64Chars[n & 63];
+    }
+
+    if (i < size) {
+        const bool hasTwoBytes = (i + 1 < size);
+        uint32_t   n = uint32_t(uint8_t(data[i])) << 16;
+        if (hasTwoBytes)
+            n |= uint32_t(uint8_t(data[i + 1])) << 8;
+        out += kBase64Chars[(n >> 18) & 63];
+        out += kBase64Chars[(n >> 12) & 63];
+        out += hasTwoBytes ? kBase64Chars[(n >> 6) & 63] : '=';
+        out += '=';
+    }
+}
+
+bool decodeBase64(const char* data, size_t size, std::vector<char>& out)
+{
+    static const std::array<int8_t, 256> kValues = []() {
+        std::array<int8_t, 256> values;
+        values.fill(-1);
+        for (int8_t i = 0; i < 64; ++i)
+            values[uint8_t(kBase64Chars[i])] = i;
+        return values;
+    }();
+
+    out.clear();
+    out.reserve(size / 4 * 3);
+
+    uint32_t bits = 0;
+    int      nbBits = 0;
+    for (size_t i = 0; i < size && data[i] != '='; ++i) {
+        const int8_t value = kValues[uint8_t(data[i])];
+        if (value < 0)
+            return false;
+
+        bits = (bits << 6) | uint32_t(value);
+        nbBits += 6;
+        if (nbBits >= 8) {
+            nbBits -= 8;
+            out.push_back(char((bits >> nbBits) & 0xFF));
+        }
+    }
+    return true;
+}
+
+// The usdc crate format is only written to and read from files, so the bytes go through
+// a temporary file. The file is created in a new directory only accessible to the user,
+// so that no other file or link can take its place, and the directory is removed when
+// the crate file goes out of scope, whatever the outcome. Nothing read from the file may
+// still refer to it at that point.
+class TmpCrateFile
+{
+public:
+    TmpCrateFile()
+        : _dir(ArchMakeTmpSubdir(ArchGetTmpDir(), "mayaUsdLayer"))
+    {
+        if (!_dir.empty())
+            _path = TfStringCatPaths(_dir, "layer.usdc");
+    }
+
+    ~TmpCrateFile()
+    {
+        if (_dir.empty())
+            return;
+
+        TfRmTree(_dir, [](const std::string& path, const std::string& error) {
+            TF_WARN("Failed to remove temporary file %s: %s", path.c_str(), error.c_str());
+        });
+    }
+
+    TmpCrateFile(const TmpCrateFile&) = delete;
+    TmpCrateFile& operator=(const TmpCrateFile&) = delete;
+
+    //! Returns the path of the crate file, empty if the directory could not be created.
+    const std::string& path() const { return _path; }
+
+private:
+    std::string _dir;
+    std::string _path;
+};
+
+bool exportLayerToCrate(const SdfLayer& layer, std::string& bytes)
+{
+    const TmpCrateFile tmpFile;
+    if (tmpFile.path().empty() || !layer.Export(tmpFile.path()))
+        return false;
+
+    std::ifstream file(tmpFile.path(), std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+bool importLayerFromCrate(const SdfLayerRefPtr& layer, const std::vector<char>& bytes)
+{
+    const TmpCrateFile tmpFile;
+    if (tmpFile.path().empty())
+        return false;
+
+    {
+        std::ofstream file(tmpFile.path(), std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), bytes.size());
+        if (!file.good())
+            return false;
+    }
+
+    // By default, the arrays of a usdc layer are views into the memory-mapped file. Read
+    // the layer detached instead, so its data is copied into memory and the layer content
+    // no longer depends on the file, which is deleted on return.
+#if PXR_VERSION < 2211
+    // Detached layers are not available, so copy the content through text.
+    SdfLayerRefPtr crateLayer = SdfLayer::OpenAsAnonymous(tmpFile.path());
+    std::string    text;
+    return crateLayer && crateLayer->ExportToString(&text) && layer->ImportFromString(text);
+#else
+#if PXR_VERSION < 2508
+    const SdfFileFormatConstPtr format = SdfFileFormat::FindById(UsdUsdcFileFormatTokens->Id);
+#else
+    const SdfFileFormatConstPtr format = SdfFileFormat::FindById(SdfUsdcFileFormatTokens->Id);
+#endif
+    SdfLayerRefPtr crateLayer = SdfLayer::CreateAnonymous("crate", format);
+    if (!crateLayer || !format->ReadDetached(get_pointer(crateLayer), tmpFile.path(), false))
+        return false;
+
+    layer->TransferContent(crateLayer);
+    return true;
+#endif
+}
+
 void populateChildren(
     const std::string&           proxyPath,
     const UsdStageRefPtr&        stage,
@@ -272,6 +429,98 @@ std::string usdFormatArgOption()
 #endif
 }
 
+USDSerializedEditsFormat serializedUsdEditsFormatOption()
+{
+    static const MString kSerializedUsdEditsFormat(
+        MayaUsdOptionVars->SerializedUsdEditsFormat.GetText());
+
+    bool optVarExists = true;
+    int  formatOption = MGlobal::optionVarIntValue(kSerializedUsdEditsFormat, &optVarExists);
+
+    // Default is to save as text, set it to that if the optionVar doesn't exist yet.
+    if (!optVarExists
+        || (formatOption < kSerializeAsText || formatOption > kSerializeAsCompressedBinary)) {
+        formatOption = kSerializeAsText;
+        MGlobal::setOptionVarValue(kSerializedUsdEditsFormat, formatOption);
+    }
+
+    return static_cast<USDSerializedEditsFormat>(formatOption);
+}
+
+bool exportLayerToString(
+    const SdfLayer&          layer,
+    USDSerializedEditsFormat format,
+    std::string*             result)
+{
+    if (!result)
+        return false;
+
+    if (format != kSerializeAsText) {
+        std::string bytes;
+        if (exportLayerToCrate(layer, bytes)) {
+            if (format == kSerializeAsCompressedBinary
+                && bytes.size() <= TfFastCompression::GetMaxInputSize()) {
+                std::string compressed(
+                    TfFastCompression::GetCompressedBufferSize(bytes.size()), '\0');
+                compressed.resize(TfFastCompression::CompressToBuffer(
+                    bytes.data(), &compressed[0], bytes.size()));
+
+                *result = kCompressedCrateHeader + std::to_string(bytes.size()) + "\n";
+                appendBase64(compressed.data(), compressed.size(), *result);
+            } else {
+                *result = kCrateHeader;
+                appendBase64(bytes.data(), bytes.size(), *result);
+            }
+            return true;
+        }
+        // Layers that cannot be written as crate are still saved, as text.
+    }
+
+    return layer.ExportToString(result);
+}
+
+bool importLayerFromString(const SdfLayerRefPtr& layer, const std::string& serialized)
+{
+    if (!layer)
+        return false;
+
+    if (TfStringStartsWith(serialized, kCrateHeader)) {
+        const size_t      offset = sizeof(kCrateHeader) - 1;
+        std::vector<char> bytes;
+        if (!decodeBase64(serialized.data() + offset, serialized.size() - offset, bytes))
+            return false;
+        return importLayerFromCrate(layer, bytes);
+    }
+
+    if (TfStringStartsWith(serialized, kCompressedCrateHeader)) {
+        const size_t offset = sizeof(kCompressedCrateHeader) - 1;
+        const size_t endOfLine = serialized.find('\n', offset);
+        if (endOfLine == std::string::npos)
+            return false;
+
+        std::vector<char> compressed;
+        if (!decodeBase64(
+                serialized.data() + endOfLine + 1,
+                serialized.size() - endOfLine - 1,
+                compressed))
+            return false;
+
+        char*        sizeEnd = nullptr;
+        const size_t size = std::strtoull(serialized.c_str() + offset, &sizeEnd, 10);
+        if (sizeEnd != serialized.c_str() + endOfLine)
+            return false;
+
+        std::vector<char> bytes(size);
+        if (TfFastCompression::DecompressFromBuffer(
+                compressed.data(), bytes.data(), compressed.size(), size)
+            != size)
+            return false;
+        return importLayerFromCrate(layer, bytes);
+    }
+
+    return layer->ImportFromString(serialized);
+}
+
 /* static */
 USDUnsavedEditsOption serializeUsdEditsLocationOption()
 {
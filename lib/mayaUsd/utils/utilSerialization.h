@@ -64,6 +64,33 @@ enum USDUnsavedEditsOption
 MAYAUSD_CORE_PUBLIC
 USDUnsavedEditsOption serializeUsdEditsLocationOption();
 
+enum USDSerializedEditsFormat
+{
+    kSerializeAsText = 1,
+    kSerializeAsBinary,
+    kSerializeAsCompressedBinary
+};
+/*! \brief Queries the Maya optionVar that decides the format of the Usd edits
+    saved in the Maya scene file.
+ */
+MAYAUSD_CORE_PUBLIC
+USDSerializedEditsFormat serializedUsdEditsFormatOption();
+
+/*! \brief Serialize the layer to a string that can be stored in a Maya string attribute.
+    The binary formats are written as usdc crate bytes encoded in base64. This does not
+    call into Maya, so different layers can be serialized from multiple threads.
+ */
+MAYAUSD_CORE_PUBLIC
+bool exportLayerToString(
+    const SdfLayer&          layer,
+    USDSerializedEditsFormat format,
+    std::string*             result);
+
+/*! \brief Replace the layer content with a string from exportLayerToString(), in any format.
+ */
+MAYAUSD_CORE_PUBLIC
+bool importLayerFromString(const SdfLayerRefPtr& layer, const std::string& serialized);
+
 /*! \brief Return if the relative-path plug is set to true on the proxy shape.
  */
 MAYAUSD_CORE_PUBLIC
@@ -310,17 +310,32 @@ bool PxrUsdTranslators_MeshWriter::writeAnimatedMeshExtents(
     // will be written at the SkelRoot level later on.
     TF_VERIFY(!deformedMesh.isNull());
     TF_VERIFY(deformedMesh.hasFn(MFn::kMesh));
-    MStatus stat;
-    MFnMesh fnMesh(deformedMesh, &stat);
-    CHECK_MSTATUS_AND_RETURN(stat, false);
-    unsigned int numVertices = fnMesh.numVertices();
-    const float* meshPts = fnMesh.getRawPoints(&stat);
-    CHECK_MSTATUS_AND_RETURN(stat, false);
-
-    const GfVec3f* pVtMeshPts = reinterpret_cast<const GfVec3f*>(meshPts);
-    VtVec3fArray   vtMeshPts(pVtMeshPts, pVtMeshPts + numVertices);
-    VtVec3fArray   meshBBox(2);
-    UsdGeomPointBased::ComputeExtent(vtMeshPts, &meshBBox);
+    VtVec3fArray meshBBox(2);
+    if (isFrameStaged(usdTime)) {
+        meshBBox = _stagedFrame.extent;
+    } else {
+        MStatus stat;
+        MFnMesh fnMesh(deformedMesh, &stat);
+        CHECK_MSTATUS_AND_RETURN(stat, false);
+        if (_GetExportArgs().contextEvaluation) {
+            // The mesh node holds its points at the current time. Skinned and non-animated
+            // meshes are not staged, so their points are pulled at the sample time through the
+            // outMesh plug, which honors the evaluation context.
+            MPlug outMeshPlug = fnMesh.findPlug("outMesh", true, &stat);
+            CHECK_MSTATUS_AND_RETURN(stat, false);
+            const MObject meshData = outMeshPlug.asMObject(&stat);
+            CHECK_MSTATUS_AND_RETURN(stat, false);
+            stat = fnMesh.setObject(meshData);
+            CHECK_MSTATUS_AND_RETURN(stat, false);
+        }
+        unsigned int numVertices = fnMesh.numVertices();
+        const float* meshPts = fnMesh.getRawPoints(&stat);
+        CHECK_MSTATUS_AND_RETURN(stat, false);
+
+        const GfVec3f* pVtMeshPts = reinterpret_cast<const GfVec3f*>(meshPts);
+        VtVec3fArray   vtMeshPts(pVtMeshPts, pVtMeshPts + numVertices);
+        UsdGeomPointBased::ComputeExtent(vtMeshPts, &meshBBox);
+    }
     meshBBox = meshBBox * _metersPerUnitScalingFactor;
     bool bStat = true;
     if (meshBBox != this->_prevMeshExtentsSample) {
@@ -338,6 +353,95 @@ void PxrUsdTranslators_MeshWriter::Write(const UsdTimeCode& usdTime)
 
     UsdGeomMesh primSchema(_usdPrim);
     writeMeshAttrs(usdTime, primSchema);
+
+    // The staged geometry is only valid for a single frame.
+    _stagedFrame = _StagedFrame();
+}
+
+bool PxrUsdTranslators_MeshWriter::SupportsParallelWrite() const
+{
+    // Skinned meshes and blend shapes need to walk the Maya deformer chain
+    // while writing, so only the plain animated meshes are staged.
+    return isMeshAnimated() && !_GetExportArgs().exportBlendShapes;
+}
+
+bool PxrUsdTranslators_MeshWriter::SupportsContextEvaluation() const
+{
+    // The animated meshes read their geometry, UVs and color sets from the staged outMesh data.
+    // The static and skinned ones only write their visibility and extents at the time samples,
+    // and their extents are computed from the outMesh data pulled at the sample time.
+    if (_GetExportArgs().exportBlendShapes) {
+        return false;
+    }
+    return SupportsParallelWrite() || !isMeshAnimated();
+}
+
+void PxrUsdTranslators_MeshWriter::FetchFrameData(const UsdTimeCode& usdTime)
+{
+    _stagedFrame = _StagedFrame();
+
+    MStatus status;
+    MFnMesh finalMesh(GetDagPath(), &status);
+    if (!status) {
+        return;
+    }
+
+    // Pulling the output mesh data evaluates the mesh once, on the main
+    // thread. The data object can then be read from a worker thread.
+    MPlug outMeshPlug = finalMesh.findPlug("outMesh", true, &status);
+    if (!status) {
+        return;
+    }
+    _stagedFrame.meshData = outMeshPlug.asMObject(&status);
+    if (!status) {
+        _stagedFrame.meshData = MObject();
+        return;
+    }
+
+    // Normals are only written for polygonal meshes, see writeMeshAttrs().
+    TfToken sdScheme = UsdMayaMeshWriteUtils::getSubdivScheme(finalMesh);
+    if (sdScheme.IsEmpty()) {
+        sdScheme = _GetExportArgs().defaultMeshScheme;
+    }
+    if (sdScheme == UsdGeomTokens->none) {
+        bool emitNormals = true;
+        UsdMayaMeshReadUtils::getEmitNormalsTag(finalMesh, &emitNormals);
+        _stagedFrame.withNormals = emitNormals;
+    }
+    _stagedFrame.time = usdTime;
+}
+
+void PxrUsdTranslators_MeshWriter::StageFrameData(const UsdTimeCode& usdTime)
+{
+    if (_stagedFrame.meshData.isNull() || _stagedFrame.time != usdTime) {
+        return;
+    }
+
+    MStatus status;
+    MFnMesh meshFn(_stagedFrame.meshData, &status);
+    if (!status
+        || !UsdMayaMeshWriteUtils::getPointsData(
+            meshFn, &_stagedFrame.points, &_stagedFrame.extent)) {
+        // Write() falls back to reading the mesh on the main thread.
+        return;
+    }
+
+    UsdMayaMeshWriteUtils::getFaceVertexIndicesData(
+        meshFn, &_stagedFrame.faceVertexCounts, &_stagedFrame.faceVertexIndices);
+
+    if (_stagedFrame.withNormals
+        && !UsdMayaMeshWriteUtils::getMeshNormals(
+            meshFn, &_stagedFrame.normals, &_stagedFrame.normalsInterpolation)) {
+        _stagedFrame.normals.clear();
+        _stagedFrame.normalsInterpolation = TfToken();
+    }
+
+    _stagedFrame.staged = true;
+}
+
+bool PxrUsdTranslators_MeshWriter::isFrameStaged(const UsdTimeCode& usdTime) const
+{
+    return _stagedFrame.staged && _stagedFrame.time == usdTime;
 }
 
 bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
@@ -407,6 +511,14 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
         return false;
     }
 
+    // When the frame was staged, its mesh data was pulled from the outMesh plug at the sample
+    // time, which may differ from the current time under context evaluation. The time-varying
+    // sidecar data (UVs and color sets) is then read from it instead of from the DAG path.
+    MFnMesh    stagedMesh;
+    const bool useStagedMesh = isFrameStaged(usdTime) && !_stagedFrame.meshData.isNull()
+        && stagedMesh.setObject(_stagedFrame.meshData) == MS::kSuccess;
+    MFnMesh&   frameMesh = useStagedMesh ? stagedMesh : finalMesh;
+
     // NOTE: (yliangsiew) We decide early-on if the mesh needs to have blendshapes exported, or not.
     // Since a user usually exports multiple meshes at the same time, it is inevitable that some
     // meshes will have blendshape export requested even though they do not have any blendshape
@@ -592,6 +704,19 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
             UsdMayaMeshWriteUtils::writePointsData(
                 fnMesh, primSchema, usdTime, _metersPerUnitScalingFactor, _GetSparseValueWriter());
         }
+    } else if (isFrameStaged(usdTime)) {
+        UsdMayaWriteUtil::SetScaledAttribute(
+            primSchema.GetPointsAttr(),
+            &_stagedFrame.points,
+            _metersPerUnitScalingFactor,
+            usdTime,
+            _GetSparseValueWriter());
+        UsdMayaWriteUtil::SetScaledAttribute(
+            primSchema.CreateExtentAttr(),
+            &_stagedFrame.extent,
+            _metersPerUnitScalingFactor,
+            usdTime,
+            _GetSparseValueWriter());
     } else {
         // TODO: (yliangsiew) Any other deformers that get implemented in the future will have to
         // make sure that they don't just enter this scope; otherwise, their deformed point
@@ -601,8 +726,26 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
     }
 
     // Write faceVertexIndices
-    UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
-        geomMesh, primSchema, usdTime, _GetSparseValueWriter());
+    if (isFrameStaged(usdTime)) {
+        UsdMayaWriteUtil::SetAttribute(
+            primSchema.GetFaceVertexCountsAttr(),
+            &_stagedFrame.faceVertexCounts,
+            usdTime,
+            _GetSparseValueWriter());
+        UsdMayaWriteUtil::SetAttribute(
+            primSchema.GetFaceVertexIndicesAttr(),
+            &_stagedFrame.faceVertexIndices,
+            usdTime,
+            _GetSparseValueWriter());
+
+        bool isLeftHanded = false;
+        UsdMayaUtil::getPlugValue(geomMesh, "opposite", &isLeftHanded);
+        primSchema.CreateOrientationAttr(
+            VtValue(isLeftHanded ? UsdGeomTokens->leftHanded : UsdGeomTokens->rightHanded), true);
+    } else {
+        UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(
+            geomMesh, primSchema, usdTime, _GetSparseValueWriter());
+    }
 
     // Read subdiv scheme tagging. If not set, we default to defaultMeshScheme
     // flag (this is specified by the job args but defaults to catmullClark).
@@ -616,7 +759,16 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
         // Polygonal mesh - export normals.
         bool emitNormals = true; // Write mesh normals if USD_EmitNormals is not present
         UsdMayaMeshReadUtils::getEmitNormalsTag(finalMesh, &emitNormals);
-        if (emitNormals) {
+        if (emitNormals && isFrameStaged(usdTime) && _stagedFrame.withNormals) {
+            if (!_stagedFrame.normals.empty()) {
+                UsdMayaWriteUtil::SetAttribute(
+                    primSchema.GetNormalsAttr(),
+                    &_stagedFrame.normals,
+                    usdTime,
+                    _GetSparseValueWriter());
+                primSchema.SetNormalsInterpolation(_stagedFrame.normalsInterpolation);
+            }
+        } else if (emitNormals) {
             UsdMayaMeshWriteUtils::writeNormalsData(
                 geomMesh, primSchema, usdTime, _GetSparseValueWriter());
         }
@@ -638,7 +790,7 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
     // == Write UVSets as Vec2f Primvars
     if (exportArgs.exportMeshUVs) {
         UsdMayaMeshWriteUtils::writeUVSetsAsVec2fPrimvars(
-            finalMesh,
+            frameMesh,
             primSchema,
             usdTime,
             _GetSparseValueWriter(),
@@ -650,7 +802,7 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
     std::vector<std::string> colorSetNames;
     if (exportArgs.exportColorSets) {
         MStringArray mayaColorSetNames;
-        status = finalMesh.getColorSetNames(mayaColorSetNames);
+        status = frameMesh.getColorSetNames(mayaColorSetNames);
         colorSetNames.reserve(mayaColorSetNames.length());
         for (unsigned int i = 0; i < mayaColorSetNames.length(); i++) {
             colorSetNames.emplace_back(mayaColorSetNames[i].asChar());
@@ -714,7 +866,7 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
         bool                          clamped = false;
 
         if (!UsdMayaMeshWriteUtils::getMeshColorSetData(
-                finalMesh,
+                frameMesh,
                 MString(colorSetName.c_str()),
                 isDisplayColor,
                 shadersRGBData,
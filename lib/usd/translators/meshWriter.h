@@ -56,6 +56,10 @@ public:
 
     void Write(const UsdTimeCode& usdTime) override;
     bool ExportsGprims() const override;
+    bool SupportsParallelWrite() const override;
+    bool SupportsContextEvaluation() const override;
+    void FetchFrameData(const UsdTimeCode& usdTime) override;
+    void StageFrameData(const UsdTimeCode& usdTime) override;
     void PostExport() override;
 
 private:
@@ -91,6 +95,25 @@ private:
 
     UsdSkelAnimation _skelAnim;
 
+    /// Geometry of the current frame, retrieved by FetchFrameData() and
+    /// converted by StageFrameData() when frames are exported in parallel.
+    struct _StagedFrame
+    {
+        UsdTimeCode  time;
+        MObject      meshData;
+        bool         staged = false;
+        bool         withNormals = false;
+        VtVec3fArray points;
+        VtVec3fArray extent;
+        VtIntArray   faceVertexCounts;
+        VtIntArray   faceVertexIndices;
+        VtVec3fArray normals;
+        TfToken      normalsInterpolation;
+    };
+    _StagedFrame _stagedFrame;
+
+    bool isFrameStaged(const UsdTimeCode& usdTime) const;
+
     /// Set of color sets that should be excluded.
     /// Intermediate processes may alter this set prior to writeMeshAttrs().
     std::set<std::string> _excludeColorSets;
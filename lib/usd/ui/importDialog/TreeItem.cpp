@@ -36,6 +36,7 @@ TreeItem::TreeItem(const UsdPrim& prim, bool isDefaultPrim, Column column) noexc
     , _column(column)
     , _checkState(CheckState::kChecked_Disabled)
     , _variantSelectionModified(false)
+    , _childrenFetched(false)
 {
     initializeItem(isDefaultPrim);
 }
@@ -97,6 +98,13 @@ void TreeItem::setVariantSelectionModified()
         _variantSelectionModified = true;
 }
 
+void TreeItem::setChildrenFetched()
+{
+    assert(_column == kColumnLoad);
+    if (_column == kColumnLoad)
+        _childrenFetched = true;
+}
+
 void TreeItem::initializeItem(bool isDefaultPrim)
 {
     switch (_column) {
@@ -112,16 +120,24 @@ void TreeItem::initializeItem(bool isDefaultPrim)
         }
         break;
     case kColumnType: setText(QString::fromStdString(_prim.GetTypeName().GetString())); break;
-    case kColumnVariants: {
-        if (_prim.HasVariantSets()) {
-            // We set a special role flag when this prim has variant sets.
-            // So we know when to create the label and combo box(es) for the variant
-            // sets and to override the drawing in the styled item delegate.
-            setData(ItemDelegate::kVariants, ItemDelegate::kTypeRole);
-        }
-    } break;
+    case kColumnVariants: refreshVariantSets(); break;
     default: break;
     }
 }
 
+void TreeItem::refreshVariantSets()
+{
+    if (_column != kColumnVariants)
+        return;
+
+    if (_prim.HasVariantSets()) {
+        // We set a special role flag when this prim has variant sets.
+        // So we know when to create the label and combo box(es) for the variant
+        // sets and to override the drawing in the styled item delegate.
+        setData(ItemDelegate::kVariants, ItemDelegate::kTypeRole);
+    } else {
+        setData(QVariant(), ItemDelegate::kTypeRole);
+    }
+}
+
 } // namespace MAYAUSD_NS_DEF
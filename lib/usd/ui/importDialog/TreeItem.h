@@ -102,6 +102,19 @@ public:
     //! Only valid for kVariants type.
     void resetVariantSelectionModified() { _variantSelectionModified = false; }
 
+    //! Returns true if the rows of the children of the prim were created.
+    //! Only valid for kLoad type, which is the column holding the children.
+    bool childrenFetched() const { return _childrenFetched; }
+
+    //! Special flag set once the rows of the children of the prim are created.
+    //! Only valid for kLoad type.
+    void setChildrenFetched();
+
+    //! Updates the role flag telling whether the prim has variant sets, which can change
+    //! once the payload of the prim is loaded.
+    //! Only valid for kVariants type.
+    void refreshVariantSets();
+
 private:
     void           initializeItem(bool isDefaultPrim);
     const QPixmap* createPixmap(const char* pixmapURL) const;
@@ -119,6 +132,9 @@ protected:
     // Special flag set when the variant selection was modified.
     bool _variantSelectionModified;
 
+    // For the LOAD column, set when the children rows were created.
+    bool _childrenFetched;
+
     static const QPixmap* checkBoxOn;
     static const QPixmap* checkBoxOnDisabled;
     static const QPixmap* checkBoxOff;
@@ -20,7 +20,9 @@
 #include <mayaUsdUI/ui/IMayaMQtUtil.h>
 #include <mayaUsdUI/ui/ItemDelegate.h>
 #include <mayaUsdUI/ui/TreeItem.h>
+#include <mayaUsdUI/ui/TreeModelFactory.h>
 
+#include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usd/variantSets.h>
 
 #include <QtCore/QSortFilterProxyModel>
@@ -55,6 +57,39 @@ TreeItem* findTreeItem(
     return nullptr;
 }
 
+// The children rows created after the check state was set inherit it, the same way
+// setting the check state of an item sets it on its descendants.
+TreeItem::CheckState inheritedCheckState(TreeItem::CheckState parentState)
+{
+    switch (parentState) {
+    case TreeItem::CheckState::kChecked:
+    case TreeItem::CheckState::kChecked_Disabled: return TreeItem::CheckState::kChecked_Disabled;
+    default: return parentState;
+    }
+}
+
+bool mayHaveChildren(const UsdPrim& prim)
+{
+    // The children of an unloaded payload are only known once it is loaded on expansion.
+    return !prim.GetAllChildren().empty() || (prim.HasAuthoredPayloads() && !prim.IsLoaded());
+}
+
+// Calls fn on the variant selections of the import data for the descendants of the given
+// path. The editors of these prims were not created, so they did not restore them.
+template <typename Fn>
+void forEachImportedDescendantSelection(const ImportData* importData, const SdfPath& path, Fn fn)
+{
+    if (importData == nullptr)
+        return;
+
+    const ImportData::PrimVariantSelections& primVarSel = importData->primVariantSelections();
+    for (auto it = primVarSel.upper_bound(path); it != primVarSel.end(); ++it) {
+        if (!it->first.HasPrefix(path))
+            break;
+        fn(it->first, it->second);
+    }
+}
+
 void resetVariantToPrimSelection(TreeItem* variantItem)
 {
     assert(variantItem);
@@ -141,6 +176,70 @@ Qt::ItemFlags TreeModel::flags(const QModelIndex& index) const
     return flags;
 }
 
+TreeItem* TreeModel::unfetchedItem(const QModelIndex& parent) const
+{
+    // Note: only the load column (0) has children.
+    if (!parent.isValid() || parent.column() != TreeItem::kColumnLoad)
+        return nullptr;
+
+    TreeItem* item = static_cast<TreeItem*>(itemFromIndex(parent));
+    if (item == nullptr || item->childrenFetched())
+        return nullptr;
+    return item;
+}
+
+bool TreeModel::hasChildren(const QModelIndex& parent /*= QModelIndex()*/) const
+{
+    if (TreeItem* item = unfetchedItem(parent))
+        return mayHaveChildren(item->prim());
+    return ParentClass::hasChildren(parent);
+}
+
+bool TreeModel::canFetchMore(const QModelIndex& parent) const
+{
+    return unfetchedItem(parent) != nullptr;
+}
+
+void TreeModel::fetchMore(const QModelIndex& parent)
+{
+    TreeItem* item = unfetchedItem(parent);
+    if (item == nullptr)
+        return;
+
+    item->setChildrenFetched();
+
+    // Only the payload of the expanded prim is loaded, the payloads of its descendants
+    // are loaded when they are expanded in turn.
+    UsdPrim    prim = item->prim();
+    const bool loadPayload = prim.HasAuthoredPayloads() && !prim.IsLoaded();
+    if (loadPayload) {
+        prim.Load(UsdLoadWithoutDescendants);
+        _descendantCounts.clear();
+    }
+
+    USDImportDialogOptions options;
+    options.showVariants = _showVariants;
+    options.showRoot = _showRoot;
+    TreeModelFactory::buildTreeChildren(prim, prim.GetStage()->GetDefaultPrim(), item, options);
+
+    setChildCheckState(parent, inheritedCheckState(item->checkState()));
+    Q_EMIT childrenFetched(parent);
+
+    // The loaded payload may have added variant sets to the prim, so its variant editor
+    // must be rebuilt.
+    if (loadPayload && _showVariants) {
+        QModelIndex variantsIndex = index(parent.row(), TreeItem::kColumnVariants, parent.parent());
+        if (TreeItem* variantsItem = static_cast<TreeItem*>(itemFromIndex(variantsIndex))) {
+            variantsItem->refreshVariantSets();
+            Q_EMIT variantSetsChanged(variantsIndex);
+        }
+    }
+
+    // The loaded payload may have added prims in scope.
+    if (loadPayload)
+        updateCheckedItemCount();
+}
+
 void TreeModel::setParentsCheckState(const QModelIndex& child, TreeItem::CheckState state)
 {
     QModelIndex parentIndex = this->parent(child);
@@ -179,6 +278,9 @@ void TreeModel::setChildCheckState(const QModelIndex& parent, TreeItem::CheckSta
                 setChildCheckState(childIndex, state);
         }
     }
+    if (rMin == -1)
+        return;
+
     QModelIndex  rMinIndex = this->index(rMin, TreeItem::kColumnLoad, parent);
     QModelIndex  rMaxIndex = this->index(rMax, TreeItem::kColumnLoad, parent);
     QVector<int> roles;
@@ -228,6 +330,18 @@ void TreeModel::fillPrimVariantSelections(
         return;
 
     for (int r = 0; r < rowCount(parent); ++r) {
+        // Note: only the load column (0) has children, so we use it when looking for children.
+        QModelIndex childIndex = this->index(r, TreeItem::kColumnLoad, parent);
+        TreeItem*   childItem = static_cast<TreeItem*>(itemFromIndex(childIndex));
+        if (!childItem->childrenFetched()) {
+            forEachImportedDescendantSelection(
+                _importData,
+                childItem->prim().GetPath(),
+                [&primVariantSelections](const SdfPath& path, const SdfVariantSelectionMap& sel) {
+                    primVariantSelections[path] = sel;
+                });
+        }
+
         QModelIndex variantIndex = this->index(r, TreeItem::kColumnVariants, parent);
         TreeItem*   item = static_cast<TreeItem*>(itemFromIndex(variantIndex));
         if (item->variantSelectionModified()) {
@@ -250,8 +364,6 @@ void TreeModel::fillPrimVariantSelections(
             }
         }
 
-        // Note: only the load column (0) has children, so we use it when looking for children.
-        QModelIndex childIndex = this->index(r, TreeItem::kColumnLoad, parent);
         if (hasChildren(childIndex)) {
             fillPrimVariantSelections(primVariantSelections, childIndex);
         }
@@ -283,13 +395,7 @@ void TreeModel::setRootPrimPath(const std::string& path)
 {
     // Find the prim matching the root prim path from the import data and
     // check-enable it.
-    SdfPath rootPrimPath(path);
-    auto    fnFindRoot = [rootPrimPath](TreeItem* item) -> bool {
-        if (item->prim().GetPath() == rootPrimPath)
-            return true;
-        return false;
-    };
-    TreeItem* item = findTreeItem(this, QModelIndex(), fnFindRoot);
+    TreeItem* item = fetchPathItem(SdfPath(path));
     if (item != nullptr) {
         checkEnableItem(item);
     }
@@ -336,6 +442,41 @@ TreeItem* TreeModel::findPathItem(const PXR_NS::SdfPath& path) const
     return findTreeItem(this, QModelIndex(), fnFindRoot);
 }
 
+TreeItem* TreeModel::fetchPathItem(const PXR_NS::SdfPath& path)
+{
+    if (!path.IsAbsolutePath() || !path.IsAbsoluteRootOrPrimPath())
+        return nullptr;
+
+    auto findChildItem = [this](const QModelIndex& parent, const SdfPath& childPath) {
+        for (int r = 0; r < rowCount(parent); ++r) {
+            QModelIndex childIndex = index(r, TreeItem::kColumnLoad, parent);
+            TreeItem*   item = static_cast<TreeItem*>(itemFromIndex(childIndex));
+            if (item->prim().GetPath() == childPath)
+                return item;
+        }
+        return static_cast<TreeItem*>(nullptr);
+    };
+
+    // The pseudo-root only has a row when it is shown.
+    TreeItem* item = nullptr;
+    if (_showRoot) {
+        item = findChildItem(QModelIndex(), SdfPath::AbsoluteRootPath());
+        if (item == nullptr || path.IsAbsoluteRootPath())
+            return item;
+    }
+
+    // Create the children rows of each ancestor, from the top, until the item is found.
+    for (const SdfPath& prefix : path.GetPrefixes()) {
+        const QModelIndex parentIndex = item ? indexFromItem(item) : QModelIndex();
+        if (canFetchMore(parentIndex))
+            fetchMore(parentIndex);
+        item = findChildItem(parentIndex, prefix);
+        if (item == nullptr)
+            break;
+    }
+    return item;
+}
+
 TreeItem* TreeModel::findPrimItem(const UsdPrim& prim) const
 {
     return findPathItem(prim.GetPath());
@@ -349,19 +490,22 @@ TreeItem* TreeModel::getFirstItem() const
 
 void TreeModel::updateCheckedItemCount() const
 {
-    int nbChecked = 0, nbVariantsModified = 0;
-    countCheckedItems(QModelIndex(), nbChecked, nbVariantsModified);
+    int  nbChecked = 0, nbVariantsModified = 0;
+    bool hasUnloadedPayloads = false;
+    countCheckedItems(QModelIndex(), nbChecked, nbVariantsModified, hasUnloadedPayloads);
 
     // When the checked items change we will count, and emit signals for, the number of
     // checked items as well as the number of in-scope modified variants.
     Q_EMIT checkedStateChanged(nbChecked);
+    Q_EMIT unloadedPayloadsInScopeChanged(hasUnloadedPayloads);
     Q_EMIT modifiedVariantCountChanged(nbVariantsModified);
 }
 
 void TreeModel::countCheckedItems(
     const QModelIndex& parent,
     int&               nbChecked,
-    int&               nbVariantsModified) const
+    int&               nbVariantsModified,
+    bool&              hasUnloadedPayloads) const
 {
     for (int r = 0; r < rowCount(parent); ++r) {
         TreeItem* item;
@@ -374,6 +518,21 @@ void TreeModel::countCheckedItems(
             || TreeItem::CheckState::kChecked_Disabled == state) {
             nbChecked++;
 
+            // The descendants without rows share the check state of the item.
+            if (!item->childrenFetched()) {
+                const DescendantCount& descendants = countDescendants(item->prim());
+                nbChecked += descendants.count;
+                hasUnloadedPayloads |= descendants.hasUnloadedPayloads;
+                if (_showVariants) {
+                    forEachImportedDescendantSelection(
+                        _importData,
+                        item->prim().GetPath(),
+                        [&nbVariantsModified](const SdfPath&, const SdfVariantSelectionMap&) {
+                            nbVariantsModified++;
+                        });
+                }
+            }
+
             if (_showVariants) {
                 // We are only counting modified variants of in-scope prims
                 QModelIndex variantChildIndex = this->index(r, TreeItem::kColumnVariants, parent);
@@ -386,14 +545,36 @@ void TreeModel::countCheckedItems(
         }
 
         if (hasChildren(checkedChildIndex))
-            countCheckedItems(checkedChildIndex, nbChecked, nbVariantsModified);
+            countCheckedItems(
+                checkedChildIndex, nbChecked, nbVariantsModified, hasUnloadedPayloads);
     }
 }
 
+const TreeModel::DescendantCount& TreeModel::countDescendants(const UsdPrim& prim) const
+{
+    auto it = _descendantCounts.find(prim.GetPath());
+    if (it != _descendantCounts.end())
+        return it->second;
+
+    // The range includes the prim itself. The prims inside the payloads that are not
+    // loaded are not part of the range, they are counted once their parent is expanded.
+    DescendantCount    descendants;
+    const UsdPrimRange range(prim, UsdPrimAllPrimsPredicate);
+    for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
+        if (primIt->HasAuthoredPayloads() && !primIt->IsLoaded())
+            descendants.hasUnloadedPayloads = true;
+        if (*primIt != prim)
+            ++descendants.count;
+    }
+
+    return _descendantCounts[prim.GetPath()] = descendants;
+}
+
 void TreeModel::updateModifiedVariantCount() const
 {
-    int nbChecked = 0, nbVariantsModified = 0;
-    countCheckedItems(QModelIndex(), nbChecked, nbVariantsModified);
+    int  nbChecked = 0, nbVariantsModified = 0;
+    bool hasUnloadedPayloads = false;
+    countCheckedItems(QModelIndex(), nbChecked, nbVariantsModified, hasUnloadedPayloads);
 
     Q_EMIT modifiedVariantCountChanged(nbVariantsModified);
 }
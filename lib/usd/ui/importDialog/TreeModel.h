@@ -27,6 +27,8 @@
 
 #include <QtGui/QStandardItemModel>
 
+#include <unordered_map>
+
 class QTreeView;
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -62,6 +64,12 @@ public:
     QVariant      data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
     Qt::ItemFlags flags(const QModelIndex& index) const override;
 
+    // The rows of the children of a prim are only created when its item is expanded,
+    // so that opening the dialog on a large stage does not create a row for every prim.
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
     void setRootPrimPath(const std::string& path);
     void getRootPrimPath(std::string&, const QModelIndex& parent);
     void fillStagePopulationMask(UsdStagePopulationMask& popMask, const QModelIndex& parent);
@@ -82,21 +90,42 @@ public:
 
     TreeItem* findPrimItem(const PXR_NS::UsdPrim& prim) const;
     TreeItem* findPathItem(const PXR_NS::SdfPath& path) const;
+
+    //! Returns the item of the prim at the given path, creating the rows of its ancestors
+    //! if they were not expanded yet.
+    TreeItem* fetchPathItem(const PXR_NS::SdfPath& path);
     TreeItem* getFirstItem() const;
 
     static const QPixmap* getDefaultPrimPixmap();
 
 private:
     void updateCheckedItemCount() const;
-    void
-    countCheckedItems(const QModelIndex& parent, int& nbChecked, int& nbVariantsModified) const;
+    void countCheckedItems(
+        const QModelIndex& parent,
+        int&               nbChecked,
+        int&               nbVariantsModified,
+        bool&              hasUnloadedPayloads) const;
+
+    // Number of descendants of a prim, and whether some of them have payloads that are not
+    // loaded yet, in which case the prims inside those payloads are not counted.
+    struct DescendantCount
+    {
+        int  count = 0;
+        bool hasUnloadedPayloads = false;
+    };
+
+    TreeItem*              unfetchedItem(const QModelIndex& parent) const;
+    const DescendantCount& countDescendants(const PXR_NS::UsdPrim& prim) const;
 
     void setParentsCheckState(const QModelIndex& child, TreeItem::CheckState state);
     void setChildCheckState(const QModelIndex& parent, TreeItem::CheckState state);
 
 Q_SIGNALS:
     void checkedStateChanged(int nbChecked) const;
+    void unloadedPayloadsInScopeChanged(bool hasUnloadedPayloads) const;
     void modifiedVariantCountChanged(int nbModified) const;
+    void childrenFetched(const QModelIndex& parent);
+    void variantSetsChanged(const QModelIndex& variantsIndex);
 
 public Q_SLOTS:
     void updateModifiedVariantCount() const;
@@ -111,6 +140,11 @@ private:
     bool _showVariants;
     bool _showRoot;
 
+    // Number of descendants of the prims whose children rows were not created yet,
+    // so the checked items can be counted without creating their rows.
+    mutable std::unordered_map<PXR_NS::SdfPath, DescendantCount, PXR_NS::SdfPath::Hash>
+        _descendantCounts;
+
     // Need to be in the tree model becasue we need to create it before
     // the tree item have their model set.
     static const QPixmap* defaultPrimImage;
@@ -80,7 +80,7 @@ std::unique_ptr<TreeModel> TreeModelFactory::createFromStage(
     if (nbItems != nullptr)
         *nbItems = cnt;
 
-    TreeItem* item = treeModel->findPrimItem(defPrim);
+    TreeItem* item = defPrim ? treeModel->fetchPathItem(defPrim.GetPath()) : nullptr;
     if (!item)
         item = treeModel->getFirstItem();
     if (item)
@@ -116,9 +116,8 @@ int TreeModelFactory::buildTreeHierarchy(
     QStandardItem*                parentItem,
     const USDImportDialogOptions& options)
 {
-    QList<QStandardItem*> primDataCells = createPrimRow(prim, defaultPrim, options);
-    parentItem->appendRow(primDataCells);
-    return 1 + buildTreeChildren(prim, defaultPrim, primDataCells.front(), options);
+    parentItem->appendRow(createPrimRow(prim, defaultPrim, options));
+    return 1;
 }
 
 /*static*/
@@ -151,6 +150,9 @@ int TreeModelFactory::buildTreeHierarchy(
         parentItem->appendRow(primDataCells);
         ++cnt;
 
+        // The filtered tree only holds the included prims, so it must not be expanded lazily.
+        static_cast<TreeItem*>(primDataCells.front())->setChildrenFetched();
+
         // Only continue processing additional USD Prims if all expected results have not already
         // been found:
         if (--insertionsRemaining > 0) {
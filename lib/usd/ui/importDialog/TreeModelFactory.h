@@ -52,6 +52,9 @@ private:
      */
     TreeModelFactory() = delete;
 
+    // The TreeModel creates the rows of the children of an item when it is expanded.
+    friend class TreeModel;
+
 public:
     /**
      * \brief Create an empty TreeModel.
@@ -66,6 +69,8 @@ public:
 
     /**
      * \brief Create a TreeModel from the given USD Stage.
+     * \remarks Only the rows of the top-level prims and of the ancestors of the default prim are
+     * created, the rows of the other prims are created when their parent is expanded.
      * \param stage A reference to the USD Stage from which to create a TreeModel.
      * \param parent A reference to the parent of the TreeModel.
      * \param nbItems Number of items added to the TreeModel.
@@ -95,6 +100,8 @@ protected:
 
     /**
      * \brief Build the tree hierarchy starting at the given USD Prim.
+     * \remarks Only the row of the given USD Prim is created, the rows of its children are
+     * created when it is expanded.
      * \param prim The USD Prim from which to start building the tree hierarchy.
      * \param parentItem The parent into which to attach the tree hierarchy.
      * \return The number of items added.
@@ -106,7 +113,8 @@ protected:
         const USDImportDialogOptions& options);
 
     /**
-     * \brief Build the tree hierarchy for teh chidlren of the given USD Prim.
+     * \brief Build the rows for the children of the given USD Prim.
+     * \remarks The rows of the grand-children are created when the children are expanded.
      * \param prim The USD Prim from which to extract the children.
      * \param parentItem The parent into which to attach the tree hierarchy.
      * \return The number of items added.
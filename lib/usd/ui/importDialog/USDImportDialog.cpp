@@ -39,7 +39,7 @@ USDImportDialog::USDImportDialog(
     : QDialog { parent }
     , _options(options)
     , _uiView { new Ui::ImportDialog() }
-    , _stage { UsdStage::Open(filename, UsdStage::InitialLoadSet::LoadAll) }
+    , _stage { UsdStage::Open(filename, UsdStage::InitialLoadSet::LoadNone) }
     , _filename { filename }
     , _rootPrimPath("/")
 {
@@ -79,6 +79,11 @@ USDImportDialog::USDImportDialog(
     _proxyModel = std::unique_ptr<QSortFilterProxyModel>(new QSortFilterProxyModel(this));
     QObject::connect(
         _treeModel.get(), SIGNAL(checkedStateChanged(int)), this, SLOT(onCheckedStateChanged(int)));
+    QObject::connect(
+        _treeModel.get(),
+        SIGNAL(unloadedPayloadsInScopeChanged(bool)),
+        this,
+        SLOT(onUnloadedPayloadsInScopeChanged(bool)));
     QObject::connect(
         _treeModel.get(),
         SIGNAL(modifiedVariantCountChanged(int)),
@@ -131,6 +136,18 @@ USDImportDialog::USDImportDialog(
     // Must be done AFTER we set our item delegate
     _treeModel->openPersistentEditors(_uiView->treeView, QModelIndex());
 
+    // The rows of the children are created when their parent is expanded.
+    QObject::connect(
+        _treeModel.get(),
+        SIGNAL(childrenFetched(const QModelIndex&)),
+        this,
+        SLOT(onChildrenFetched(const QModelIndex&)));
+    QObject::connect(
+        _treeModel.get(),
+        SIGNAL(variantSetsChanged(const QModelIndex&)),
+        this,
+        SLOT(onVariantSetsChanged(const QModelIndex&)));
+
     // This request to expand the tree to a default depth of 3 should come after the creation
     // of the editors since it can trigger calls to things like sizeHint before we've put any of
     // the variant set UI in place.
@@ -235,6 +252,20 @@ void USDImportDialog::onItemClicked(const QModelIndex& index)
     }
 }
 
+void USDImportDialog::onChildrenFetched(const QModelIndex& parent)
+{
+    _treeModel->openPersistentEditors(_uiView->treeView, parent);
+}
+
+void USDImportDialog::onVariantSetsChanged(const QModelIndex& variantsIndex)
+{
+    // The editor was built from the variant sets of the prim before its payload was loaded.
+    const QModelIndex proxyIndex = _proxyModel->mapFromSource(variantsIndex);
+    _uiView->treeView->closePersistentEditor(proxyIndex);
+    if (variantsIndex.data(ItemDelegate::kTypeRole).toInt() == ItemDelegate::kVariants)
+        _uiView->treeView->openPersistentEditor(proxyIndex);
+}
+
 void USDImportDialog::onResetFileTriggered()
 {
     if (nullptr != _treeModel) {
@@ -253,9 +284,30 @@ void USDImportDialog::onHierarchyViewHelpTriggered()
 
 void USDImportDialog::onCheckedStateChanged(int nbChecked)
 {
+    _nbPrimsInScope = nbChecked;
+    updatePrimsInScopeLabel();
+}
+
+void USDImportDialog::onUnloadedPayloadsInScopeChanged(bool hasUnloadedPayloads)
+{
+    _hasUnloadedPayloadsInScope = hasUnloadedPayloads;
+    updatePrimsInScopeLabel();
+}
+
+void USDImportDialog::updatePrimsInScopeLabel()
+{
+    // The payloads are only loaded when their prim is expanded, so the prims inside the
+    // payloads that are not loaded yet are not counted. A "+" tells the count is partial.
     QString nbLabel;
-    nbLabel.setNum(nbChecked);
+    nbLabel.setNum(_nbPrimsInScope);
+    QString toolTip;
+    if (_hasUnloadedPayloadsInScope) {
+        nbLabel += QLatin1Char('+');
+        toolTip = tr("Prims inside payloads that are not loaded yet are not counted. "
+                     "Expand a prim to load its payload.");
+    }
     _uiView->nbPrimsInScopeLabel->setText(nbLabel);
+    _uiView->nbPrimsInScopeLabel->setToolTip(toolTip);
 }
 
 void USDImportDialog::onModifiedVariantsChanged(int nbModified)
@@ -267,7 +319,7 @@ void USDImportDialog::onModifiedVariantsChanged(int nbModified)
 
 int USDImportDialog::primsInScopeCount() const
 {
-    return _uiView->nbPrimsInScopeLabel->text().toInt();
+    return _nbPrimsInScope;
 }
 
 int USDImportDialog::switchedVariantCount() const
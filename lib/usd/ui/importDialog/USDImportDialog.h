@@ -91,13 +91,17 @@ public:
 
 private Q_SLOTS:
     void onItemClicked(const QModelIndex&);
+    void onChildrenFetched(const QModelIndex&);
+    void onVariantSetsChanged(const QModelIndex&);
     void onResetFileTriggered();
     void onHierarchyViewHelpTriggered();
     void onCheckedStateChanged(int);
+    void onUnloadedPayloadsInScopeChanged(bool);
     void onModifiedVariantsChanged(int);
 
 protected:
     void applyOptions();
+    void updatePrimsInScopeLabel();
 
     // The options for the dialog.
     USDImportDialogOptions _options;
@@ -120,6 +124,11 @@ protected:
 
     // The root prim path.
     mutable std::string _rootPrimPath;
+
+    // The number of prims in the selected scope. The prims inside the payloads that are
+    // not loaded yet are not counted.
+    int  _nbPrimsInScope = 0;
+    bool _hasUnloadedPayloadsInScope = false;
 };
 
 } // namespace MAYAUSD_NS_DEF
@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 
+#include <usdUfe/ufe/PagedHierarchy.h>
 #include <usdUfe/ufe/UsdSceneItem.h>
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/utils/Utils.h>
@@ -25,12 +26,14 @@
 #include <pxr/usdImaging/usdImaging/delegate.h>
 #include <pxr_python.h>
 
+#include <ufe/hierarchy.h>
 #include <ufe/path.h>
 #include <ufe/pathSegment.h>
 #include <ufe/pathString.h>
 #include <ufe/rtid.h>
 #include <ufe/runTimeMgr.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -101,6 +104,12 @@ bool _isAttributeEditAllowed(const PXR_NS::UsdAttribute& attr)
     return UsdUfe::isAttributeEditAllowed(attr);
 }
 
+bool _areAttributeEditsAllowed(const std::vector<PXR_NS::UsdAttribute>& attrs)
+{
+    return UsdUfe::areAttributeEditsAllowed(
+        std::vector<PXR_NS::UsdProperty>(attrs.begin(), attrs.end()));
+}
+
 static tuple _isRelationshipEditAllowed(
     const PXR_NS::UsdRelationship& relationship,
     list&                          targetsToAdd,
@@ -210,6 +219,51 @@ static std::string _uniqueChildName(const PXR_NS::UsdPrim& usdParent, const std:
     return UsdUfe::uniqueChildName(usdParent, name);
 }
 
+static list _childrenPageToList(const Ufe::SceneItemList& children)
+{
+    list childPaths;
+    for (const auto& child : children)
+        childPaths.append(Ufe::PathString::string(child->path()));
+    return childPaths;
+}
+
+static std::shared_ptr<UsdUfe::PagedHierarchy> _pagedHierarchy(const std::string& ufePathString)
+{
+    const auto item = Ufe::Hierarchy::createItem(Ufe::PathString::path(ufePathString));
+    if (!item)
+        return nullptr;
+    return std::dynamic_pointer_cast<UsdUfe::PagedHierarchy>(Ufe::Hierarchy::hierarchy(item));
+}
+
+static list _childrenPage(const std::string& ufePathString, size_t first, size_t count)
+{
+    const auto paged = _pagedHierarchy(ufePathString);
+    if (!paged)
+        return list();
+    return _childrenPageToList(paged->childrenPage(first, count));
+}
+
+static list _filteredChildrenPage(
+    const std::string& ufePathString,
+    const dict&        filterFlags,
+    size_t             first,
+    size_t             count)
+{
+    const auto paged = _pagedHierarchy(ufePathString);
+    if (!paged)
+        return list();
+
+    // The filter flags are given by name, e.g. {"InactivePrims": True}.
+    Ufe::Hierarchy::ChildFilter childFilter;
+    const list                  flagItems = filterFlags.items();
+    for (long i = 0, n = len(flagItems); i < n; ++i) {
+        const std::string name = extract<std::string>(flagItems[i][0]);
+        const bool        value = extract<bool>(flagItems[i][1]);
+        childFilter.emplace_back(name, name, value);
+    }
+    return _childrenPageToList(paged->filteredChildrenPage(childFilter, first, count));
+}
+
 void wrapUtils()
 {
     // Because UsdUfe and UFE have incompatible Python bindings that do not
@@ -225,6 +279,8 @@ void wrapUtils()
         (arg("usdPath"), arg("instanceIndex") = PXR_NS::UsdImagingDelegate::ALL_INSTANCES));
     def("uniqueName", _uniqueName);
     def("uniqueChildName", _uniqueChildName);
+    def("childrenPage", _childrenPage);
+    def("filteredChildrenPage", _filteredChildrenPage);
     def("stripInstanceIndexFromUfePath", _stripInstanceIndexFromUfePath, (arg("ufePathString")));
     def("ufePathToPrim", _ufePathToPrim);
     def("ufePathToInstanceIndex", _ufePathToInstanceIndex);
@@ -233,6 +289,7 @@ void wrapUtils()
     def("getTime", _getTime);
     def("prettifyName", &UsdUfe::prettifyName);
     def("isAttributeEditAllowed", _isAttributeEditAllowed);
+    def("areAttributeEditsAllowed", _areAttributeEditsAllowed);
     def("isRelationshipEditAllowed", _isRelationshipEditAllowed);
     def("getKnownApplicableSchemas", _getKnownApplicableSchemas);
     def("applySchemaToPrim", _applySchemaToPrim);
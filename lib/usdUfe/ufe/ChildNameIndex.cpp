@@ -0,0 +1,247 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "ChildNameIndex.h"
+
+#include <usdUfe/ufe/Utils.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <algorithm>
+#include <map>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+int gBatchDepth = 0;
+
+// Same formatting as UsdUfe::uniqueName(): pad the suffix with 0's up to lenSuffix digits.
+std::string formatSuffix(int suffix, size_t lenSuffix)
+{
+    std::string suffixStr = std::to_string(suffix);
+    return std::string(lenSuffix - std::min(lenSuffix, suffixStr.length()), '0') + suffixStr;
+}
+
+// Splits a name in its base and numerical suffix, see UsdUfe::parseNumericalSuffix().
+bool splitSuffix(const std::string& name, std::string& base, std::string& suffixStr, int* suffix)
+{
+    if (!splitNumericalSuffix(name, base, suffixStr)) {
+        return false;
+    }
+    if (!parseNumericalSuffix(suffixStr, *suffix)) {
+        base = name;
+        suffixStr.clear();
+        return false;
+    }
+    return true;
+}
+
+class Index : public TfWeakBase
+{
+public:
+    UsdUfe::ChildNameIndex::Names* find(const UsdPrim& parent)
+    {
+        UsdStagePtr stage = parent.GetStage();
+        auto        stageIt = _stages.find(get_pointer(stage));
+        if (stageIt == _stages.end()) {
+            stageIt = _stages.emplace(get_pointer(stage), StageNames()).first;
+            stageIt->second.key = TfNotice::Register(
+                TfCreateWeakPtr(this), &Index::_stageChanged, UsdStageWeakPtr(stage));
+        }
+
+        auto& parents = stageIt->second.parents;
+        auto  parentIt = parents.find(parent.GetPath());
+        if (parentIt == parents.end()) {
+            parentIt = parents.emplace(parent.GetPath(), UsdUfe::ChildNameIndex::Names()).first;
+
+            // Same children as uniqueChildNameDefault().
+            for (const auto& child :
+                 parent.GetFilteredChildren(UsdTraverseInstanceProxies(UsdPrimIsDefined))) {
+                parentIt->second.add(child.GetName());
+            }
+        }
+        return &parentIt->second;
+    }
+
+    void clear()
+    {
+        for (auto& stageNames : _stages) {
+            TfNotice::Revoke(stageNames.second.key);
+        }
+        _stages.clear();
+    }
+
+private:
+    void _stageChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender)
+    {
+        auto stageIt = _stages.find(get_pointer(sender));
+        if (stageIt == _stages.end()) {
+            return;
+        }
+
+        auto& parents = stageIt->second.parents;
+        for (const SdfPath& path : notice.GetResyncedPaths()) {
+            // Property resyncs don't change the children names.
+            if (!path.IsPrimPath() && !path.IsAbsoluteRootPath()) {
+                continue;
+            }
+
+            // The children of the resynced prim and of its descendants may have changed.
+            auto it = parents.lower_bound(path);
+            while (it != parents.end() && it->first.HasPrefix(path)) {
+                it = parents.erase(it);
+            }
+
+            if (path.IsAbsoluteRootPath()) {
+                continue;
+            }
+
+            // A new child only adds its name, but a removed child may have held the
+            // largest suffix of its base, so the parent names are gathered again.
+            auto parentIt = parents.find(path.GetParentPath());
+            if (parentIt == parents.end()) {
+                continue;
+            }
+            UsdPrim prim = sender->GetPrimAtPath(path);
+            if (prim && prim.IsDefined()) {
+                parentIt->second.add(path.GetNameToken());
+            } else {
+                parents.erase(parentIt);
+            }
+        }
+    }
+
+    struct StageNames
+    {
+        TfNotice::Key                                      key;
+        std::map<SdfPath, UsdUfe::ChildNameIndex::Names> parents;
+    };
+
+    std::unordered_map<const UsdStage*, StageNames> _stages;
+};
+
+Index& getIndex()
+{
+    static Index index;
+    return index;
+}
+
+} // namespace
+
+namespace USDUFE_NS_DEF {
+
+ChildNameIndex::Batch::Batch() { ++gBatchDepth; }
+
+ChildNameIndex::Batch::~Batch()
+{
+    if (--gBatchDepth == 0) {
+        getIndex().clear();
+    }
+}
+
+bool ChildNameIndex::isActive() { return gBatchDepth > 0; }
+
+ChildNameIndex::Names* ChildNameIndex::find(const UsdPrim& parent)
+{
+    if (!isActive() || !parent.IsValid())
+        return nullptr;
+
+    return getIndex().find(parent);
+}
+
+bool ChildNameIndex::Names::contains(const std::string& name) const
+{
+    return _names.count(TfToken(name)) > 0;
+}
+
+bool ChildNameIndex::Names::hasSuffixedBase(const std::string& base) const
+{
+    return _suffixes.count(base) > 0;
+}
+
+std::string ChildNameIndex::Names::uniqueName(const std::string& srcName)
+{
+    std::string base, suffixStr;
+    int         suffix { 0 };
+    size_t      lenSuffix { 1 };
+    if (splitSuffix(srcName, base, suffixStr, &suffix)) {
+        lenSuffix = suffixStr.length();
+    }
+    ++suffix;
+
+    // All the suffixes below the one found by the previous request for this source name
+    // were taken. Children are only added while the names are indexed, so they still are.
+    auto probeIt = _nextProbe.find(srcName);
+    if (probeIt != _nextProbe.end()) {
+        suffix = std::max(suffix, probeIt->second);
+    }
+
+    std::string dstName = base + formatSuffix(suffix, lenSuffix);
+    while (_names.count(TfToken(dstName)) > 0) {
+        dstName = base + formatSuffix(++suffix, lenSuffix);
+    }
+    _nextProbe[srcName] = suffix;
+    return dstName;
+}
+
+std::string ChildNameIndex::Names::uniqueNameMaxSuffix(const std::string& srcName) const
+{
+    std::string base, suffixStr;
+    int         suffix { 0 };
+    size_t      lenSuffix { 1 };
+    if (splitSuffix(srcName, base, suffixStr, &suffix)) {
+        lenSuffix = suffixStr.length();
+    }
+
+    int  maxSuffix = 0;
+    auto it = _suffixes.find(base);
+    if (it != _suffixes.end()) {
+        if (it->second.maxSuffix > 0) {
+            maxSuffix = it->second.maxSuffix;
+            lenSuffix = it->second.lenSuffix;
+        } else {
+            lenSuffix = std::min(lenSuffix, it->second.lenSuffix);
+        }
+    }
+
+    return base + formatSuffix(++maxSuffix, lenSuffix);
+}
+
+void ChildNameIndex::Names::add(const TfToken& name)
+{
+    if (!_names.insert(name).second)
+        return;
+
+    std::string base, suffixStr;
+    int         value { 0 };
+    if (!splitSuffix(name.GetString(), base, suffixStr, &value))
+        return;
+
+    // Padding width is from the name with the max value, or on a tie, the less padded width.
+    SuffixInfo& info = _suffixes[base];
+    if (value > info.maxSuffix) {
+        info.maxSuffix = value;
+        info.lenSuffix = suffixStr.length();
+    } else if (value == info.maxSuffix) {
+        info.lenSuffix = std::min(info.lenSuffix, suffixStr.length());
+    }
+}
+
+} // namespace USDUFE_NS_DEF
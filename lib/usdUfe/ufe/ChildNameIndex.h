@@ -0,0 +1,100 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef USDUFE_CHILDNAMEINDEX_H
+#define USDUFE_CHILDNAMEINDEX_H
+
+#include <usdUfe/base/api.h>
+
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/usd/prim.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace USDUFE_NS_DEF {
+
+//! \brief Index of the names of the children of USD prims, used to generate many unique child
+//!        names under the same parents without scanning all the siblings for each name.
+//
+// The index is only active while a ChildNameIndex::Batch is alive, for example during the
+// execution of a duplicate, paste or group command. The names of the children of a parent are
+// gathered the first time a unique name is requested under that parent, then kept up-to-date
+// from the stage ObjectsChanged notices: a resynced child is added to the names of its parent,
+// while a removed child discards the names of its parent, which are gathered again on the next
+// request. The whole index is cleared when the outermost batch ends.
+
+class USDUFE_PUBLIC ChildNameIndex
+{
+public:
+    //! \brief Helper class to scope a batch of unique name generation.
+    //
+    // This simple guard class can be nested; the index is cleared when the
+    // outermost guard exits.
+    class USDUFE_PUBLIC Batch
+    {
+    public:
+        Batch();
+        ~Batch();
+
+        USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(Batch);
+    };
+
+    //! \brief The names of the children of a single parent prim.
+    class USDUFE_PUBLIC Names
+    {
+    public:
+        //! Returns true if a child is named \p name.
+        bool contains(const std::string& name) const;
+
+        //! Returns true if a child name has a numerical suffix preceded by \p base.
+        bool hasSuffixedBase(const std::string& base) const;
+
+        //! Same result as UsdUfe::uniqueName() on the children names. Consecutive requests
+        //! for the same source name resume probing where the previous request stopped.
+        std::string uniqueName(const std::string& srcName);
+
+        //! Same result as UsdUfe::uniqueNameMaxSuffix() on the children names, without
+        //! scanning them.
+        std::string uniqueNameMaxSuffix(const std::string& srcName) const;
+
+        //! Adds the name of a new child.
+        void add(const PXR_NS::TfToken& name);
+
+    private:
+        // Largest numerical suffix of the names sharing a base, and the narrowest width
+        // with which that suffix is written.
+        struct SuffixInfo
+        {
+            int    maxSuffix { -1 };
+            size_t lenSuffix { 0 };
+        };
+
+        PXR_NS::TfToken::HashSet                    _names;
+        std::unordered_map<std::string, SuffixInfo> _suffixes;
+        std::unordered_map<std::string, int>        _nextProbe;
+    };
+
+    //! Returns true if a batch is in progress.
+    static bool isActive();
+
+    //! Returns the names of the children of \p parent, or null if no batch is in progress.
+    //! The children are the ones considered by uniqueChildNameDefault().
+    static Names* find(const PXR_NS::UsdPrim& parent);
+};
+
+} // namespace USDUFE_NS_DEF
+
+#endif // USDUFE_CHILDNAMEINDEX_H
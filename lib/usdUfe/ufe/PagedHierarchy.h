@@ -0,0 +1,56 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef USDUFE_PAGEDHIERARCHY_H
+#define USDUFE_PAGEDHIERARCHY_H
+
+#include <usdUfe/base/api.h>
+
+#include <ufe/hierarchy.h>
+
+#include <cstddef>
+
+namespace USDUFE_NS_DEF {
+
+//! \brief Hierarchy interface returning a range of children.
+/*!
+    Ufe::Hierarchy only returns the whole list of children. The USD hierarchies
+    also implement this interface, so that clients showing parents with a very
+    large number of children can get one page of children at a time:
+
+        auto paged = std::dynamic_pointer_cast<UsdUfe::PagedHierarchy>(
+            Ufe::Hierarchy::hierarchy(item));
+*/
+class USDUFE_PUBLIC PagedHierarchy
+{
+public:
+    virtual ~PagedHierarchy() = default;
+
+    //! Return at most count children, starting at the child at index first of
+    //! the children() list, without creating scene items for the other children.
+    virtual Ufe::SceneItemList childrenPage(size_t first, size_t count) const = 0;
+
+    //! Return at most count children, starting at the child at index first of
+    //! the filteredChildren() list, without creating scene items for the other children.
+    virtual Ufe::SceneItemList filteredChildrenPage(
+        const Ufe::Hierarchy::ChildFilter& childFilter,
+        size_t                             first,
+        size_t                             count) const
+        = 0;
+};
+
+} // namespace USDUFE_NS_DEF
+
+#endif // USDUFE_PAGEDHIERARCHY_H
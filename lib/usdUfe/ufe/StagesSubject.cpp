@@ -23,6 +23,11 @@
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/undo/UsdUndoManager.h>
 
+#include <pxr/base/arch/hash.h>
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/tokens.h>
@@ -39,7 +44,14 @@
 #include <ufe/sceneNotification.h>
 #include <ufe/transform3d.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
 #include <regex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace {
@@ -61,6 +73,175 @@ void notifyWithoutExceptions(const NOTIFICATION& notif)
     }
 }
 
+// Caches the conversion of USD prim paths to UFE paths while processing a single notice,
+// as a notice usually holds many property paths of the same prims.
+class UfePathCache
+{
+public:
+    UfePathCache(const Ufe::Path& stagePath)
+        : _stagePath(stagePath)
+    {
+    }
+
+    const Ufe::Path& stagePath() const { return _stagePath; }
+
+    const Ufe::Path& get(const SdfPath& primPath)
+    {
+        auto found = _ufePaths.find(primPath);
+        if (found == _ufePaths.end()) {
+            found = _ufePaths
+                        .emplace(
+                            primPath,
+                            _stagePath
+                                + Ufe::PathSegment(
+                                    primPath.GetString(), UsdUfe::getUsdRunTimeId(), '/'))
+                        .first;
+        }
+        return found->second;
+    }
+
+private:
+    const Ufe::Path                                       _stagePath;
+    std::unordered_map<SdfPath, Ufe::Path, SdfPath::Hash> _ufePaths;
+};
+
+// Collects the Transform3d notifications of a single notice, so that a prim whose xformOpOrder
+// and xform ops all changed is only notified once.
+class Transform3dNotifications
+{
+public:
+    void add(const Ufe::Path& ufePath)
+    {
+        if (_notified.insert(ufePath).second) {
+            _ufePaths.push_back(ufePath);
+        }
+    }
+
+    void send()
+    {
+        for (const auto& ufePath : _ufePaths) {
+            notifyWithoutExceptions<Ufe::Transform3d>(ufePath);
+        }
+        _ufePaths.clear();
+        _notified.clear();
+    }
+
+private:
+    std::vector<Ufe::Path>        _ufePaths;
+    std::unordered_set<Ufe::Path> _notified;
+};
+
+// Number of consecutive instances hashed together in a PointInstancer baseline.
+constexpr size_t kPointInstancerBlockSize = 1024;
+
+// Hashes of a PointInstancer attribute value at the time of its last change notification, used
+// to find out which instances a later change actually affected. Only one hash is kept per block
+// of instances, so the baseline stays small whatever the number of instances, and a change
+// notifies all the instances of the blocks it modified.
+struct PointInstancerBaseline
+{
+    UsdStageWeakPtr       stage;
+    UsdTimeCode           time;
+    const std::type_info* type { nullptr };
+    size_t                size { 0 };
+    std::vector<uint64_t> blockHashes;
+};
+
+// The baselines are keyed by stage and attribute path. The stage address only tells the stages
+// apart: the weak pointer kept in the baseline tells whether that stage is still the same one.
+using PointInstancerBaselineKey = std::pair<const UsdStage*, SdfPath>;
+std::map<PointInstancerBaselineKey, PointInstancerBaseline> pointInstancerBaselines;
+
+// Forgets the baselines of the attributes at or below the given path of the given stage.
+void erasePointInstancerBaselines(const UsdStageWeakPtr& stage, const SdfPath& path)
+{
+    const UsdStage* stagePtr = get_pointer(stage);
+    auto            it = pointInstancerBaselines.lower_bound({ stagePtr, path });
+    while (it != pointInstancerBaselines.end() && it->first.first == stagePtr
+           && it->first.second.HasPrefix(path)) {
+        it = pointInstancerBaselines.erase(it);
+    }
+}
+
+template <class T> bool hashBlocks(const VtValue& value, PointInstancerBaseline* baseline)
+{
+    if (!value.IsHolding<VtArray<T>>()) {
+        return false;
+    }
+
+    const VtArray<T>& array = value.UncheckedGet<VtArray<T>>();
+    const char*       data = reinterpret_cast<const char*>(array.cdata());
+    const size_t      size = array.size();
+
+    baseline->type = &typeid(T);
+    baseline->size = size;
+    baseline->blockHashes.resize((size + kPointInstancerBlockSize - 1) / kPointInstancerBlockSize);
+    for (size_t block = 0; block < baseline->blockHashes.size(); ++block) {
+        const size_t begin = block * kPointInstancerBlockSize;
+        const size_t end = std::min(begin + kPointInstancerBlockSize, size);
+        baseline->blockHashes[block]
+            = ArchHash64(data + begin * sizeof(T), (end - begin) * sizeof(T));
+    }
+    return true;
+}
+
+// Computes the baseline of the value of a PointInstancer attribute. Returns false if the
+// attribute has no value or is not of a type authored by point instance manipulation.
+bool computePointInstancerBaseline(
+    const UsdStageWeakPtr&  stage,
+    const UsdAttribute&     attr,
+    UsdTimeCode             time,
+    PointInstancerBaseline* baseline)
+{
+    VtValue value;
+    if (!attr || !attr.Get(&value, time)) {
+        return false;
+    }
+
+    baseline->stage = stage;
+    baseline->time = time;
+    return hashBlocks<GfVec3f>(value, baseline) || hashBlocks<GfQuath>(value, baseline)
+        || hashBlocks<GfQuatf>(value, baseline);
+}
+
+// Compares the value of a PointInstancer attribute with the one it had when it last changed,
+// and returns the indices of the instances of the blocks that differ. Returns false when the
+// change cannot be diffed (unknown previous value, different time or array size), in which
+// case all the instances must be considered changed.
+bool diffPointInstancerAttribute(
+    const UsdStageWeakPtr& stage,
+    const UsdAttribute&    attr,
+    UsdTimeCode            time,
+    std::vector<int>*      changedIndices)
+{
+    PointInstancerBaseline current;
+    if (!computePointInstancerBaseline(stage, attr, time, &current)
+        || current.size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        erasePointInstancerBaselines(stage, attr.GetPath());
+        return false;
+    }
+
+    PointInstancerBaseline& baseline
+        = pointInstancerBaselines[{ get_pointer(stage), attr.GetPath() }];
+    const bool canDiff = baseline.stage && baseline.stage == stage && baseline.time == time
+        && baseline.type == current.type && baseline.size == current.size;
+    if (canDiff) {
+        for (size_t block = 0; block < current.blockHashes.size(); ++block) {
+            if (baseline.blockHashes[block] == current.blockHashes[block]) {
+                continue;
+            }
+            const size_t begin = block * kPointInstancerBlockSize;
+            const size_t end = std::min(begin + kPointInstancerBlockSize, current.size);
+            for (size_t i = begin; i < end; ++i) {
+                changedIndices->push_back(static_cast<int>(i));
+            }
+        }
+    }
+
+    baseline = std::move(current);
+    return canDiff;
+}
+
 // The attribute change notification guard is not meant to be nested, but
 // use a counter nonetheless to provide consistent behavior in such cases.
 std::atomic_int attributeChangedNotificationGuardCount { 0 };
@@ -411,6 +592,34 @@ StagesSubject::~StagesSubject() { }
 /*static*/
 StagesSubject::RefPtr StagesSubject::create() { return TfCreateRefPtr(new StagesSubject); }
 
+void StagesSubject::clearPointInstancerBaselines() { pointInstancerBaselines.clear(); }
+
+/*static*/
+void StagesSubject::trackPointInstancer(const UsdPrim& prim, UsdTimeCode time)
+{
+    const UsdGeomPointInstancer pointInstancer(prim);
+    if (!pointInstancer) {
+        return;
+    }
+
+    const UsdStageWeakPtr stage = prim.GetStage();
+    for (const UsdAttribute& attr : { pointInstancer.GetPositionsAttr(),
+                                      pointInstancer.GetOrientationsAttr(),
+                                      pointInstancer.GetScalesAttr() }) {
+        const PointInstancerBaselineKey key { get_pointer(stage), attr.GetPath() };
+        const auto                      found = pointInstancerBaselines.find(key);
+        if (found != pointInstancerBaselines.end() && found->second.stage == stage
+            && found->second.time == time) {
+            continue;
+        }
+
+        PointInstancerBaseline baseline;
+        if (computePointInstancerBaseline(stage, attr, time, &baseline)) {
+            pointInstancerBaselines[key] = std::move(baseline);
+        }
+    }
+}
+
 PXR_NS::TfNotice::Key StagesSubject::registerStage(const PXR_NS::UsdStageRefPtr& stage)
 {
     auto me = PXR_NS::TfCreateWeakPtr(this);
@@ -422,9 +631,12 @@ void StagesSubject::stageChanged(
     UsdStageWeakPtr const&           sender)
 {
     // If the stage path has not been initialized yet, do nothing
-    if (stagePath(sender).empty())
+    UfePathCache ufePaths(stagePath(sender));
+    if (ufePaths.stagePath().empty())
         return;
 
+    Transform3dNotifications transform3dNotifications;
+
     auto stage = notice.GetStage();
     auto resyncPaths = notice.GetResyncedPaths();
     for (auto it = resyncPaths.begin(), end = resyncPaths.end(); it != end; ++it) {
@@ -433,18 +645,19 @@ void StagesSubject::stageChanged(
             // Special case to detect when an xformop is added or removed from a prim.
             // We need to send some notifications so DCC can update (such as on undo
             // to move the transform manipulator back to original position).
-            const TfToken& nameToken = changedPath.GetNameToken();
-            auto           usdPrimPathStr = changedPath.GetPrimPath().GetString();
-            auto           ufePath
-                = stagePath(sender) + Ufe::PathSegment(usdPrimPathStr, getUsdRunTimeId(), '/');
+            const TfToken&   nameToken = changedPath.GetNameToken();
+            const Ufe::Path& ufePath = ufePaths.get(changedPath.GetPrimPath());
             if (isTransformChange(nameToken)) {
                 if (!UsdUfe::InTransform3dChange::inTransform3dChange()) {
-                    notifyWithoutExceptions<Ufe::Transform3d>(ufePath);
+                    transform3dNotifications.add(ufePath);
                 }
             }
 
             processAttributeChanges(ufePath, changedPath, it.base()->second);
 
+            // The attribute was added or removed, it can no longer be diffed.
+            erasePointInstancerBaselines(sender, changedPath);
+
             // No further processing for this prim property path is required.
             continue;
         }
@@ -454,6 +667,10 @@ void StagesSubject::stageChanged(
         if (changedPath.IsPropertyPath())
             continue;
 
+        // The attributes of the resynced prims may have changed entirely, so they can no longer
+        // be diffed.
+        erasePointInstancerBaselines(sender, changedPath);
+
         // Assume proxy shapes (and thus stages) cannot be instanced.  We can
         // therefore map the stage to a single UFE path.  Lifting this
         // restriction would mean sending one add or delete notification for
@@ -461,12 +678,10 @@ void StagesSubject::stageChanged(
         Ufe::Path ufePath;
         UsdPrim   prim;
         if (changedPath == SdfPath::AbsoluteRootPath()) {
-            ufePath = stagePath(sender);
+            ufePath = ufePaths.stagePath();
             prim = stage->GetPseudoRoot();
         } else {
-            const std::string usdPrimPathStr = changedPath.GetPrimPath().GetString();
-            ufePath = stagePath(sender)
-                + Ufe::PathSegment(usdPrimPathStr, UsdUfe::getUsdRunTimeId(), '/');
+            ufePath = ufePaths.get(changedPath.GetPrimPath());
             prim = stage->GetPrimAtPath(changedPath);
         }
 
@@ -553,12 +768,10 @@ void StagesSubject::stageChanged(
                 // removed, we need to cleanup the selection list in order to
                 // prevent stale items from being kept in the global selection set.
                 if (!InAddOrDeleteOperation::inAddOrDeleteOperation()) {
-                    auto       parentPath = changedPath.GetParentPath();
-                    const auto parentUfePath = parentPath == SdfPath::AbsoluteRootPath()
-                        ? stagePath(sender)
-                        : stagePath(sender)
-                            + Ufe::PathSegment(
-                                parentPath.GetString(), UsdUfe::getUsdRunTimeId(), '/');
+                    auto             parentPath = changedPath.GetParentPath();
+                    const Ufe::Path& parentUfePath = parentPath == SdfPath::AbsoluteRootPath()
+                        ? ufePaths.stagePath()
+                        : ufePaths.get(parentPath);
 
                     // Filter the global selection, removing items below our parent prim.
                     auto globalSn = Ufe::GlobalSelection::get();
@@ -580,10 +793,8 @@ void StagesSubject::stageChanged(
     auto changedInfoOnlyPaths = notice.GetChangedInfoOnlyPaths();
     for (auto it = changedInfoOnlyPaths.begin(), end = changedInfoOnlyPaths.end(); it != end;
          ++it) {
-        const auto& changedPath = *it;
-        auto        usdPrimPathStr = changedPath.GetPrimPath().GetString();
-        auto        ufePath
-            = stagePath(sender) + Ufe::PathSegment(usdPrimPathStr, UsdUfe::getUsdRunTimeId(), '/');
+        const auto&      changedPath = *it;
+        const Ufe::Path& ufePath = ufePaths.get(changedPath.GetPrimPath());
 
         bool sendValueChangedFallback = true;
 
@@ -602,12 +813,15 @@ void StagesSubject::stageChanged(
             sendValueChangedFallback = false;
         }
 
-        if (!UsdUfe::InTransform3dChange::inTransform3dChange()) {
+        if (UsdUfe::InTransform3dChange::inTransform3dChange()) {
+            // The change is not notified, so it must not be diffed against later on.
+            erasePointInstancerBaselines(sender, changedPath);
+        } else {
             // Is the change a Transform3d change?
             const UsdPrim prim = stage->GetPrimAtPath(changedPath.GetPrimPath());
             const TfToken nameToken = changedPath.GetNameToken();
             if (isTransformChange(nameToken)) {
-                notifyWithoutExceptions<Ufe::Transform3d>(ufePath);
+                transform3dNotifications.add(ufePath);
                 sendValueChangedFallback = false;
             } else if (prim && prim.IsA<UsdGeomPointInstancer>()) {
                 // If the prim at the changed path is a PointInstancer, check
@@ -618,9 +832,10 @@ void StagesSubject::stageChanged(
                     || nameToken == UsdGeomTokens->scales) {
                     // This USD change represents a Transform3d change to a
                     // PointInstancer prim.
-                    // Unfortunately though, there is no way for us to know
-                    // which point instance indices were actually affected by
-                    // this change. As a result, we must assume that they *all*
+                    // The notice does not tell which point instance indices
+                    // were actually affected by this change, so the new value
+                    // is diffed against the one of the previous change. When
+                    // that is not possible, we must assume that they *all*
                     // may have been affected, so we construct UFE paths for
                     // every instance and issue a notification for each one.
                     const UsdGeomPointInstancer pointInstancer(prim);
@@ -638,10 +853,27 @@ void StagesSubject::stageChanged(
                         ? static_cast<int>(numInstances)
                         : std::numeric_limits<int>::max();
 
-                    for (int instanceIndex = 0; instanceIndex < numIndices; ++instanceIndex) {
-                        const Ufe::Path instanceUfePath = stagePath(sender)
+                    const auto notifyInstance = [&](int instanceIndex) {
+                        const Ufe::Path instanceUfePath = ufePaths.stagePath()
                             + usdPathToUfePathSegment(changedPath.GetPrimPath(), instanceIndex);
                         notifyWithoutExceptions<Ufe::Transform3d>(instanceUfePath);
+                    };
+
+                    std::vector<int> changedIndices;
+                    if (diffPointInstancerAttribute(
+                            sender,
+                            prim.GetAttribute(nameToken),
+                            getTime(ufePath),
+                            &changedIndices)) {
+                        for (const int instanceIndex : changedIndices) {
+                            if (instanceIndex < numIndices) {
+                                notifyInstance(instanceIndex);
+                            }
+                        }
+                    } else {
+                        for (int instanceIndex = 0; instanceIndex < numIndices; ++instanceIndex) {
+                            notifyInstance(instanceIndex);
+                        }
                     }
                     sendValueChangedFallback = false;
                 }
@@ -665,9 +897,11 @@ void StagesSubject::stageChanged(
         }
     }
 
+    transform3dNotifications.send();
+
     // Special case when we are notified, but no paths given.
     if (resyncPaths.empty() && changedInfoOnlyPaths.empty()) {
-        auto                       ufePath = stagePath(sender);
+        auto                       ufePath = ufePaths.stagePath();
         Ufe::AttributeValueChanged vc(ufePath, "/");
         notifyWithoutExceptions<Ufe::Attributes>(vc);
     }
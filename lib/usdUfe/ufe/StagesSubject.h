@@ -21,7 +21,9 @@
 #include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
 
 #include <ufe/path.h>
 #include <ufe/sceneItem.h>
@@ -73,7 +75,15 @@ public:
     void sendObjectDestroyed(const Ufe::Path& ufePath) const;
     void sendSubtreeInvalidate(const Ufe::SceneItem::Ptr& sceneItem) const;
 
+    //! Record the current positions, orientations and scales of the PointInstancer, unless they
+    //! are already known, so that their next change only notifies the instances it affected.
+    static void trackPointInstancer(const PXR_NS::UsdPrim& prim, PXR_NS::UsdTimeCode time);
+
 protected:
+    //! Forget the PointInstancer attribute values kept to find out which instances their
+    //! changes affect. Must be called when the observed stages are closed or replaced.
+    static void clearPointInstancerBaselines();
+
     //! Call the stageChanged() methods on stage observers.
     virtual void stageChanged(
         PXR_NS::UsdNotice::ObjectsChanged const& notice,
@@ -16,6 +16,7 @@
 
 #include "UsdClipboardCommands.h"
 
+#include <usdUfe/ufe/ChildNameIndex.h>
 #include <usdUfe/ufe/Global.h>
 #include <usdUfe/ufe/UsdUndoAddNewPrimCommand.h>
 #include <usdUfe/ufe/UsdUndoDuplicateSelectionCommand.h>
@@ -379,7 +380,8 @@ UsdPasteClipboardCommand::Ptr UsdPasteClipboardCommand::create(
 
 void UsdPasteClipboardCommand::execute()
 {
-    UsdUndoBlock undoBlock(&_undoableItem);
+    UsdUndoBlock          undoBlock(&_undoableItem);
+    ChildNameIndex::Batch nameBatch;
 
     // Get the Clipboard stage.
     auto clipboardData = _clipboard->getClipboardData();
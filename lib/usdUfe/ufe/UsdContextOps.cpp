@@ -655,7 +655,9 @@ Ufe::UndoableCommand::Ptr UsdContextOps::doBulkOpCmd(const ItemPath& itemPath)
                 cmdList.emplace_back(cmd);
             }
         }
-        return compositeCmdReturn(_bulkItems);
+        DEBUG_OUTPUT(_bulkItems);
+        return !cmdList.empty() ? std::make_shared<UsdUndoLoadUnloadPayloadsCommand>(cmdList)
+                                : nullptr;
     }
 
     // Load With Descendants:
@@ -670,7 +672,9 @@ Ufe::UndoableCommand::Ptr UsdContextOps::doBulkOpCmd(const ItemPath& itemPath)
                 cmdList.emplace_back(cmd);
             }
         }
-        return compositeCmdReturn(_bulkItems);
+        DEBUG_OUTPUT(_bulkItems);
+        return !cmdList.empty() ? std::make_shared<UsdUndoLoadUnloadPayloadsCommand>(cmdList)
+                                : nullptr;
     }
 
     // Prim Visibility:
@@ -35,7 +35,9 @@
 #include <ufe/scene.h>
 #include <ufe/sceneNotification.h>
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 
@@ -149,35 +151,28 @@ Ufe::SceneItem::Ptr UsdHierarchy::sceneItem() const { return _item; }
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !children().empty();
+    // Use the same logic as children(), which remaps and filters the prims in
+    // createUFEChildList, but stop at the first child: the Outliner calls this
+    // for every visible row, and parents can have a very large number of children.
+    return !createUFEChildList(getUSDFilteredChildren(_item), true /*filterInactive*/, 0, 1)
+                .empty();
 }
 
 bool UsdHierarchy::hasFilteredChildren(const ChildFilter& childFilter) const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
-    return !filteredChildren(childFilter).empty();
+    // Same as hasChildren(): stop at the first child.
+    Usd_PrimFlagsPredicate flags = UsdUfe::getUsdPredicate(childFilter);
+    return !createUFEChildList(getUSDFilteredChildren(_item, flags), false, 0, 1).empty();
 }
 
 #else
 
 bool UsdHierarchy::hasChildren() const
 {
-    // We have an extra logic in createUFEChildList to remap and filter
-    // prims. Going this direction is more costly, but easier to maintain.
-    //
-    // I don't have data that proves we need to worry about performance in here,
-    // so going after maintainability.
+    // Use the same logic as children(), which remaps and filters the prims in
+    // createUFEChildList, but stop at the first child.
     const bool isFilteringInactive = false;
-    return !createUFEChildList(getUSDFilteredChildren(_item), isFilteringInactive).empty();
+    return !createUFEChildList(getUSDFilteredChildren(_item), isFilteringInactive, 0, 1).empty();
 }
 
 #endif
@@ -193,6 +188,18 @@ Ufe::SceneItemList UsdHierarchy::filteredChildren(const ChildFilter& childFilter
     return createUFEChildList(getUSDFilteredChildren(_item, flags), false);
 }
 
+Ufe::SceneItemList UsdHierarchy::childrenPage(size_t first, size_t count) const
+{
+    return createUFEChildList(getUSDFilteredChildren(_item), true /*filterInactive*/, first, count);
+}
+
+Ufe::SceneItemList
+UsdHierarchy::filteredChildrenPage(const ChildFilter& childFilter, size_t first, size_t count) const
+{
+    Usd_PrimFlagsPredicate flags = UsdUfe::getUsdPredicate(childFilter);
+    return createUFEChildList(getUSDFilteredChildren(_item, flags), false, first, count);
+}
+
 bool UsdHierarchy::childrenHook(
     const PXR_NS::UsdPrim& child,
     Ufe::SceneItemList&    children,
@@ -202,24 +209,51 @@ bool UsdHierarchy::childrenHook(
 }
 
 // Return UFE child list from input USD child list.
-Ufe::SceneItemList
-UsdHierarchy::createUFEChildList(const UsdPrimSiblingRange& range, bool filterInactive) const
+Ufe::SceneItemList UsdHierarchy::createUFEChildList(
+    const UsdPrimSiblingRange& range,
+    bool                       filterInactive,
+    size_t                     first,
+    size_t                     count) const
 {
     // Note that the calls to this function are given a range from
     // getUSDFilteredChildren() above, which ensures that when fItem is a
     // point instance of a PointInstancer, it will be child-less. As a result,
     // we expect to receive an empty range in that case, and will return an
     // empty scene item list as a result.
+    //
+    // Children before first are only counted: no scene item is created for
+    // them, unless a derived class creates it in childrenHook().
     Ufe::SceneItemList children;
+    size_t             skipped = 0;
     for (const auto& child : range) {
-        // Give derived classes a chance to process this child.
-        if (childrenHook(child, children, filterInactive))
+        if (children.size() >= count)
+            break;
+
+        // Give derived classes a chance to process this child. The items it adds for a child
+        // in the skipped region are removed from the front, as they come first in the list.
+        const size_t nbChildren = children.size();
+        if (childrenHook(child, children, filterInactive)) {
+            const size_t nbAdded = children.size() - nbChildren;
+            const size_t nbSkipped = std::min(first - skipped, nbAdded);
+            const auto   skippedBegin = std::next(children.begin(), nbChildren);
+            children.erase(skippedBegin, std::next(skippedBegin, nbSkipped));
+            skipped += nbSkipped;
             continue;
+        }
 
         if (!filterInactive || child.IsActive()) {
+            if (skipped < first) {
+                ++skipped;
+                continue;
+            }
             children.emplace_back(UsdSceneItem::create(_item->path() + child.GetName(), child));
         }
     }
+
+    // A derived class may have added more than one item for the last child.
+    if (children.size() > count)
+        children.erase(std::next(children.begin(), count), children.end());
+
     return children;
 }
 
@@ -17,6 +17,7 @@
 #define USDUFE_USDHIERARCHY_H
 
 #include <usdUfe/base/api.h>
+#include <usdUfe/ufe/PagedHierarchy.h>
 #include <usdUfe/ufe/UfeVersionCompat.h>
 #include <usdUfe/ufe/UsdSceneItem.h>
 
@@ -24,6 +25,8 @@
 #include <ufe/path.h>
 #include <ufe/selection.h>
 
+#include <limits>
+
 namespace USDUFE_NS_DEF {
 
 //! \brief USD run-time hierarchy interface
@@ -31,7 +34,9 @@ namespace USDUFE_NS_DEF {
     This class implements the hierarchy interface for normal USD prims, using
     standard USD calls to obtain a prim's parent and children.
 */
-class USDUFE_PUBLIC UsdHierarchy : public Ufe::Hierarchy
+class USDUFE_PUBLIC UsdHierarchy
+    : public Ufe::Hierarchy
+    , public PagedHierarchy
 {
 public:
     typedef std::shared_ptr<UsdHierarchy> Ptr;
@@ -87,6 +92,11 @@ public:
     Ufe::UndoableCommand::Ptr ungroupCmd() const override;
 #endif
 
+    // PagedHierarchy overrides
+    Ufe::SceneItemList childrenPage(size_t first, size_t count) const override;
+    Ufe::SceneItemList
+    filteredChildrenPage(const ChildFilter& childFilter, size_t first, size_t count) const override;
+
 protected:
     //! Called from createUFEChildList() to allow a derived class to process the
     //! child prim and modify the children list for that child.
@@ -97,8 +107,13 @@ protected:
         bool                   filterInactive) const;
 
 private:
-    Ufe::SceneItemList
-    createUFEChildList(const PXR_NS::UsdPrimSiblingRange& range, bool filterInactive) const;
+    //! Return the children in range, skipping the first ones and stopping once
+    //! count children were found.
+    Ufe::SceneItemList createUFEChildList(
+        const PXR_NS::UsdPrimSiblingRange& range,
+        bool                               filterInactive,
+        size_t                             first = 0,
+        size_t                             count = std::numeric_limits<size_t>::max()) const;
 
 private:
     UsdSceneItem::Ptr _item;
@@ -15,6 +15,7 @@
 //
 #include "UsdUndoCreateGroupCommand.h"
 
+#include <usdUfe/ufe/ChildNameIndex.h>
 #include <usdUfe/ufe/UsdUndoAddNewPrimCommand.h>
 #include <usdUfe/ufe/UsdUndoSetKindCommand.h>
 #include <usdUfe/ufe/Utils.h>
@@ -73,6 +74,8 @@ Ufe::SceneItem::Ptr UsdUndoCreateGroupCommand::insertedChild() const { return _g
 
 void UsdUndoCreateGroupCommand::execute()
 {
+    ChildNameIndex::Batch nameBatch;
+
     std::string newPrimName
         = UsdUfe::relativelyUniqueName(_parentItem->prim(), _name.string() + '1');
     auto addPrimCmd = UsdUndoAddNewPrimCommand::create(_parentItem, newPrimName, "Xform");
@@ -16,6 +16,7 @@
 
 #include "UsdUndoDuplicateSelectionCommand.h"
 
+#include <usdUfe/ufe/ChildNameIndex.h>
 #include <usdUfe/ufe/UsdUndoDuplicateCommand.h>
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
@@ -62,7 +63,8 @@ UsdUndoDuplicateSelectionCommand::Ptr UsdUndoDuplicateSelectionCommand::create(
 
 void UsdUndoDuplicateSelectionCommand::execute()
 {
-    UsdUndoBlock undoBlock(&_undoableItem);
+    UsdUndoBlock          undoBlock(&_undoableItem);
+    ChildNameIndex::Batch nameBatch;
 
     for (auto&& usdItem : _sourceItems) {
         auto duplicateCmd = UsdUndoDuplicateCommand::create(usdItem, _dstParentItem);
@@ -16,6 +16,10 @@
 #include "UsdUndoPayloadCommand.h"
 
 #include <usdUfe/ufe/Utils.h>
+#include <usdUfe/utils/loadRules.h>
+
+#include <algorithm>
+#include <memory>
 
 namespace USDUFE_NS_DEF {
 
@@ -55,16 +59,19 @@ void UsdUndoLoadUnloadBaseCommand::doCommand(UsdUndoLoadUnloadBaseCommand::comma
     if (!_stage)
         return;
     if (!undo)
-        _undoRules = _stage->GetLoadRules();
+        _undoRules = getLoadRules(*_stage);
     fn(this);
     if (undo)
-        _stage->SetLoadRules(_undoRules);
-    saveModifiedLoadRules();
+        setLoadRules(*_stage, _undoRules);
+
+    // Within a transaction, the load rules are saved once the transaction ends.
+    if (!LoadRulesTransaction::isActive(*_stage))
+        saveModifiedLoadRules();
 }
 
-void UsdUndoLoadUnloadBaseCommand::doLoad() const { _stage->Load(_primPath, _policy); }
+void UsdUndoLoadUnloadBaseCommand::doLoad() const { loadPayload(*_stage, _primPath, _policy); }
 
-void UsdUndoLoadUnloadBaseCommand::doUnload() const { _stage->Unload(_primPath); }
+void UsdUndoLoadUnloadBaseCommand::doUnload() const { unloadPayload(*_stage, _primPath); }
 
 void UsdUndoLoadUnloadBaseCommand::saveModifiedLoadRules() const
 {
@@ -101,4 +108,46 @@ void UsdUndoUnloadPayloadCommand::undo()
     doCommand(&UsdUndoUnloadPayloadCommand::doLoad, true /* undo */);
 }
 
+USDUFE_VERIFY_CLASS_SETUP(Ufe::CompositeUndoableCommand, UsdUndoLoadUnloadPayloadsCommand);
+
+UsdUndoLoadUnloadPayloadsCommand::UsdUndoLoadUnloadPayloadsCommand(const CmdList& cmds)
+    : Parent(cmds)
+{
+    for (const auto& cmd : cmds) {
+        auto loadCmd = std::dynamic_pointer_cast<UsdUndoLoadUnloadBaseCommand>(cmd);
+        if (!loadCmd || !loadCmd->stage())
+            continue;
+        if (std::find(_stages.begin(), _stages.end(), loadCmd->stage()) == _stages.end())
+            _stages.push_back(loadCmd->stage());
+    }
+}
+
+void UsdUndoLoadUnloadPayloadsCommand::doCommands(const std::function<void()>& fn)
+{
+    {
+        std::vector<std::unique_ptr<LoadRulesTransaction>> transactions;
+        for (const auto& stage : _stages)
+            transactions.push_back(std::make_unique<LoadRulesTransaction>(stage));
+        fn();
+    }
+
+    for (const auto& stage : _stages)
+        UsdUfe::saveStageLoadRules(stage);
+}
+
+void UsdUndoLoadUnloadPayloadsCommand::execute()
+{
+    doCommands([this]() { Parent::execute(); });
+}
+
+void UsdUndoLoadUnloadPayloadsCommand::undo()
+{
+    doCommands([this]() { Parent::undo(); });
+}
+
+void UsdUndoLoadUnloadPayloadsCommand::redo()
+{
+    doCommands([this]() { Parent::redo(); });
+}
+
 } // namespace USDUFE_NS_DEF
@@ -26,11 +26,18 @@
 
 #include <ufe/undoableCommand.h>
 
+#include <functional>
+#include <vector>
+
 namespace USDUFE_NS_DEF {
 
 //! \brief Undoable command for loading a USD prim.
 class USDUFE_PUBLIC UsdUndoLoadUnloadBaseCommand : public Ufe::UndoableCommand
 {
+public:
+    //! \brief The stage of the loaded or unloaded prim.
+    const PXR_NS::UsdStageWeakPtr& stage() const { return _stage; }
+
 protected:
     UsdUndoLoadUnloadBaseCommand(const PXR_NS::UsdPrim& prim, PXR_NS::UsdLoadPolicy policy);
     UsdUndoLoadUnloadBaseCommand(const PXR_NS::UsdPrim& prim);
@@ -73,6 +80,30 @@ public:
     UFE_V4(std::string commandString() const override { return "UnloadPayload"; })
 };
 
+//! \brief Undoable command for loading and unloading the payloads of many USD prims.
+//
+// The load and unload commands are executed, undone and redone in a load rules transaction
+// on each of their stages, so that each stage is updated and its load rules saved only once.
+class USDUFE_PUBLIC UsdUndoLoadUnloadPayloadsCommand : public Ufe::CompositeUndoableCommand
+{
+public:
+    typedef Ufe::CompositeUndoableCommand Parent;
+
+    UsdUndoLoadUnloadPayloadsCommand(const CmdList& cmds);
+
+    USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UsdUndoLoadUnloadPayloadsCommand);
+
+    void execute() override;
+    void undo() override;
+    void redo() override;
+    UFE_V4(std::string commandString() const override { return "LoadUnloadPayloads"; })
+
+private:
+    void doCommands(const std::function<void()>& fn);
+
+    std::vector<PXR_NS::UsdStageWeakPtr> _stages;
+};
+
 } // namespace USDUFE_NS_DEF
 
 #endif
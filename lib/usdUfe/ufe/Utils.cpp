@@ -16,6 +16,7 @@
 #include "Utils.h"
 
 #include <usdUfe/base/tokens.h>
+#include <usdUfe/ufe/ChildNameIndex.h>
 #include <usdUfe/ufe/Global.h>
 #include <usdUfe/ufe/UsdAttribute.h>
 #include <usdUfe/ufe/UsdAttributes.h>
@@ -27,7 +28,9 @@
 #include <usdUfe/utils/loadRules.h>
 #include <usdUfe/utils/usdUtils.h>
 
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/pcp/layerStack.h>
 #include <pxr/usd/pcp/site.h>
 #include <pxr/usd/sdf/layer.h>
@@ -36,6 +39,7 @@
 #include <pxr/usd/sdr/registry.h>
 #include <pxr/usd/sdr/shaderProperty.h>
 #include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primCompositionQuery.h>
 #include <pxr/usd/usd/resolver.h>
@@ -46,8 +50,14 @@
 #include <ufe/pathString.h>
 #include <ufe/selection.h>
 
+#include <algorithm>
 #include <cctype>
-#include <regex>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
 
 #ifdef UFE_V4_FEATURES_AVAILABLE
 #include <ufe/attributeInfo.h>
@@ -111,6 +121,238 @@ uint32_t findLayerIndex(const UsdPrim& prim, const SdfLayerHandle& layer)
     return position;
 }
 
+// Same index as findLayerIndex(), in the layers returned by getExpandedPrimIndexLayers().
+uint32_t findLayerIndex(const SdfLayerHandleVector& layers, const SdfLayerHandle& layer)
+{
+    return static_cast<uint32_t>(
+        std::distance(layers.begin(), std::find(layers.begin(), layers.end(), layer)));
+}
+
+// The layers of the site's local LayerStacks, in the order used by findLayerIndex().
+SdfLayerHandleVector getExpandedPrimIndexLayers(const UsdPrim& prim)
+{
+    SdfLayerHandleVector layers;
+
+    const PcpPrimIndex& primIndex = prim.ComputeExpandedPrimIndex();
+    for (PcpNodeRef node : primIndex.GetNodeRange()) {
+
+        TF_AXIOM(node);
+
+        for (SdfLayerRefPtr const& l : node.GetSite().layerStack->GetLayers()) {
+            layers.push_back(l);
+        }
+    }
+
+    return layers;
+}
+
+struct PropertyEditability
+{
+    bool        allowed { true };
+    std::string errMsg;
+};
+
+// Verify that the property stack allows editing the property in the target layer.
+PropertyEditability computePropertyEditability(
+    const UsdProperty&          attr,
+    const SdfLayerHandle&       targetLayer,
+    const SdfLayerHandleVector& primLayers)
+{
+    PropertyEditability result;
+
+    // HS March 22th,2021
+    // TODO: "Value Clips" are UsdStage-level feature, unknown to Pcp.So if the attribute in
+    // question is affected by Value Clips, we would will likely get the wrong answer. See Spiff
+    // comment for more information :
+    // https://groups.google.com/g/usd-interest/c/xTxFYQA_bRs/m/lX_WqNLoBAAJ
+
+    // Read on Value Clips here:
+    // https://graphics.pixar.com/usd/docs/api/_usd__page__value_clips.html
+
+    // get the strength-ordered ( strong-to-weak order ) list of property specs that provide
+    // opinions for this property.
+    const auto propertyStack = attr.GetPropertyStack();
+
+    if (!propertyStack.empty()) {
+        // get the strongest layer that has the attr.
+        auto strongestLayer = propertyStack.front()->GetLayer();
+
+        // compare the calculated index between the "attr" and "edit target" layers.
+        if (findLayerIndex(primLayers, strongestLayer)
+            < findLayerIndex(primLayers, targetLayer)) {
+            result.allowed = false;
+            result.errMsg = TfStringPrintf(
+                "Cannot edit [%s] attribute because there is a stronger opinion in [%s].",
+                attr.GetBaseName().GetText(),
+                strongestLayer->GetDisplayName().c_str());
+            return result;
+        }
+    }
+
+    // Time samples in the edit target layer take precedence over any default value written there.
+    // The edit would have no visible effect at any frame. Opinions from stronger layers are already
+    // caught by the property stack check above, so we only inspect the edit target layer's own spec
+    // here.
+    for (const auto& spec : propertyStack) {
+        const auto& specLayer = spec->GetLayer();
+        if (specLayer == targetLayer) {
+            if (specLayer->GetNumTimeSamplesForPath(spec->GetPath()) > 0) {
+                result.allowed = false;
+                result.errMsg = TfStringPrintf(
+                    "Cannot edit [%s] attribute because it has time samples in [%s].",
+                    attr.GetBaseName().GetText(),
+                    specLayer->GetDisplayName().c_str());
+            }
+            break; // Avoid checking weaker layers since they won't have any effect.
+        }
+    }
+
+    return result;
+}
+
+// Cache of the composition queries made by isAttributeEditAllowed(): the layers of the
+// expanded prim index of the prims, and the editability of the properties per edit target
+// layer. The entries of a stage are invalidated by its ObjectsChanged, LayerMutingChanged and
+// StageEditTargetChanged notices, so that checking the same attributes again, for example on
+// every mouse event of a manipulator drag, doesn't repeat the composition queries.
+class EditabilityCache : public TfWeakBase
+{
+public:
+    PropertyEditability get(const UsdProperty& attr, const SdfLayerHandle& targetLayer)
+    {
+        const UsdPrim prim = attr.GetPrim();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        StageEntry& stageEntry = _getStageEntry(prim.GetStage());
+
+        auto& perLayer = stageEntry.properties[attr.GetPath()];
+        auto  found = perLayer.find(targetLayer);
+        if (found != perLayer.end())
+            return found->second;
+
+        auto primIt = stageEntry.primLayers.find(prim.GetPath());
+        if (primIt == stageEntry.primLayers.end()) {
+            primIt = stageEntry.primLayers
+                         .emplace(prim.GetPath(), getExpandedPrimIndexLayers(prim))
+                         .first;
+        }
+
+        return perLayer
+            .emplace(targetLayer, computePropertyEditability(attr, targetLayer, primIt->second))
+            .first->second;
+    }
+
+private:
+    struct StageEntry
+    {
+        using PerLayerEditability = std::map<SdfLayerHandle, PropertyEditability>;
+
+        UsdStageWeakPtr                         stage;
+        TfNotice::Keys                          keys;
+        std::map<SdfPath, SdfLayerHandleVector> primLayers;
+        std::map<SdfPath, PerLayerEditability>  properties;
+    };
+
+    template <typename MAP> static void _erasePrefixed(MAP& map, const SdfPath& path)
+    {
+        auto it = map.lower_bound(path);
+        while (it != map.end() && it->first.HasPrefix(path)) {
+            it = map.erase(it);
+        }
+    }
+
+    StageEntry& _getStageEntry(const UsdStagePtr& stage)
+    {
+        auto it = _stages.find(get_pointer(stage));
+        if (it != _stages.end() && it->second.stage)
+            return it->second;
+
+        // Forget the stages that were destroyed, one of them may have had the same address.
+        for (auto stageIt = _stages.begin(); stageIt != _stages.end();) {
+            if (!stageIt->second.stage) {
+                TfNotice::Revoke(&stageIt->second.keys);
+                stageIt = _stages.erase(stageIt);
+            } else {
+                ++stageIt;
+            }
+        }
+
+        StageEntry& entry = _stages[get_pointer(stage)];
+        entry.stage = stage;
+        auto me = TfCreateWeakPtr(this);
+        entry.keys.push_back(
+            TfNotice::Register(me, &EditabilityCache::_objectsChanged, entry.stage));
+        entry.keys.push_back(
+            TfNotice::Register(me, &EditabilityCache::_layerMutingChanged, entry.stage));
+        entry.keys.push_back(
+            TfNotice::Register(me, &EditabilityCache::_editTargetChanged, entry.stage));
+        return entry;
+    }
+
+    void _objectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _stages.find(get_pointer(sender));
+        if (it == _stages.end())
+            return;
+
+        StageEntry& entry = it->second;
+        for (const SdfPath& path : notice.GetResyncedPaths()) {
+            if (path.IsPropertyPath()) {
+                entry.properties.erase(path);
+            } else {
+                _erasePrefixed(entry.primLayers, path);
+                _erasePrefixed(entry.properties, path);
+            }
+        }
+
+        // Authoring an opinion or time samples on a property only changes its info.
+        for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+            if (path.IsPropertyPath()) {
+                entry.properties.erase(path);
+            }
+        }
+    }
+
+    void
+    _layerMutingChanged(const UsdNotice::LayerMutingChanged&, const UsdStageWeakPtr& sender)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _stages.find(get_pointer(sender));
+        if (it == _stages.end())
+            return;
+
+        it->second.primLayers.clear();
+        it->second.properties.clear();
+    }
+
+    // The editability is cached per edit target layer: forget the results for the previous
+    // target, so that switching between layers does not accumulate them.
+    void
+    _editTargetChanged(const UsdNotice::StageEditTargetChanged&, const UsdStageWeakPtr& sender)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _stages.find(get_pointer(sender));
+        if (it == _stages.end())
+            return;
+
+        it->second.properties.clear();
+    }
+
+    std::mutex                                      _mutex;
+    std::unordered_map<const UsdStage*, StageEntry> _stages;
+};
+
+EditabilityCache& getEditabilityCache()
+{
+    static EditabilityCache cache;
+    return cache;
+}
+
 int gWaitCursorCount = 0;
 
 UsdUfe::StageAccessorFn                 gStageAccessorFn = nullptr;
@@ -382,29 +624,48 @@ int ufePathToInstanceIndex(const Ufe::Path& path, UsdPrim* prim)
 
 bool splitNumericalSuffix(const std::string srcName, std::string& base, std::string& suffix)
 {
-    // Compiled regular expression to find a numerical suffix to a path component.
-    // It searches for any number of characters followed by a single non-numeric,
-    // then one or more digits at end of string.
-    std::regex re("(.*)([^0-9])([0-9]+)$");
+    // Find a numerical suffix to a path component: any number of characters followed
+    // by a single non-numeric, then one or more digits at end of string. This is called
+    // for every sibling when generating unique names, so avoid a regular expression.
     base = srcName;
-    std::smatch match;
-    if (std::regex_match(srcName, match, re)) {
-        base = match[1].str() + match[2].str();
-        suffix = match[3].str();
-        return true;
+    size_t digitsStart = srcName.length();
+    while (digitsStart > 0 && std::isdigit(static_cast<unsigned char>(srcName[digitsStart - 1])))
+        --digitsStart;
+
+    if (digitsStart == 0 || digitsStart == srcName.length())
+        return false;
+
+    base = srcName.substr(0, digitsStart);
+    suffix = srcName.substr(digitsStart);
+    return true;
+}
+
+bool parseNumericalSuffix(const std::string& suffixStr, int& suffix)
+{
+    errno = 0;
+    char*           end = nullptr;
+    const long long value = std::strtoll(suffixStr.c_str(), &end, 10);
+    if (errno == ERANGE || end == suffixStr.c_str() || value < 0
+        || value >= std::numeric_limits<int>::max()) {
+        return false;
     }
-    return false;
+    suffix = static_cast<int>(value);
+    return true;
 }
 
 std::string uniqueName(const TfToken::HashSet& existingNames, std::string srcName)
 {
     std::string base, suffixStr;
-    int         suffix { 1 };
+    int         suffix { 0 };
     size_t      lenSuffix { 1 };
     if (splitNumericalSuffix(srcName, base, suffixStr)) {
-        lenSuffix = suffixStr.length();
-        suffix = std::stoi(suffixStr) + 1;
+        if (parseNumericalSuffix(suffixStr, suffix)) {
+            lenSuffix = suffixStr.length();
+        } else {
+            base = srcName;
+        }
     }
+    ++suffix;
 
     // Create a suffix string from the number keeping the same number of digits as
     // numerical suffix from input srcName (padding with 0's if needed).
@@ -424,8 +685,13 @@ std::string uniqueNameMaxSuffix(const TfToken::HashSet& existingNames, std::stri
 {
     std::string base, suffixStr;
     size_t      lenSuffix { 1 };
+    int         srcSuffix { 0 };
     if (splitNumericalSuffix(srcName, base, suffixStr)) {
-        lenSuffix = suffixStr.length();
+        if (parseNumericalSuffix(suffixStr, srcSuffix)) {
+            lenSuffix = suffixStr.length();
+        } else {
+            base = srcName;
+        }
     }
 
     int maxSuffix = 0;
@@ -437,12 +703,12 @@ std::string uniqueNameMaxSuffix(const TfToken::HashSet& existingNames, std::stri
         const std::string& existingName = token.GetString();
 
         std::string existingNameBase, existingNameSuffix;
+        int         value { 0 };
         if (!splitNumericalSuffix(existingName, existingNameBase, existingNameSuffix)
-            || existingNameBase != base) {
+            || existingNameBase != base || !parseNumericalSuffix(existingNameSuffix, value)) {
             continue;
         }
 
-        int value = std::stoi(existingNameSuffix);
         if (value > maxSuffix) {
             maxSuffix = value;
             lenSuffix = existingNameSuffix.length();
@@ -480,6 +746,13 @@ std::string uniqueChildNameDefault(
     if (!usdParent.IsValid())
         return std::string();
 
+    // During a batch, use the indexed children names rather than gathering them again.
+    if (excludeName == nullptr) {
+        if (ChildNameIndex::Names* names = ChildNameIndex::find(usdParent)) {
+            return names->contains(name) ? names->uniqueName(name) : name;
+        }
+    }
+
     TfToken::HashSet childrenNames;
 
     // The prim GetChildren method used the UsdPrimDefaultPredicate which includes
@@ -1274,65 +1547,25 @@ bool isAttributeEditAllowed(const PXR_NS::UsdProperty& attr, std::string* errMsg
     if (isAttributedLocked(attr, errMsg))
         return false;
 
-    // get the property spec in the edit target's layer
-    const auto& prim = attr.GetPrim();
-    const auto& stage = prim.GetStage();
-    const auto& editTarget = stage->GetEditTarget();
-
+    const auto& stage = attr.GetPrim().GetStage();
     if (!UsdUfe::isEditTargetLayerModifiable(stage, errMsg)) {
         return false;
     }
 
-    // get the index to edit target layer
-    const auto targetLayerIndex = findLayerIndex(prim, editTarget.GetLayer());
-
-    // HS March 22th,2021
-    // TODO: "Value Clips" are UsdStage-level feature, unknown to Pcp.So if the attribute in
-    // question is affected by Value Clips, we would will likely get the wrong answer. See Spiff
-    // comment for more information :
-    // https://groups.google.com/g/usd-interest/c/xTxFYQA_bRs/m/lX_WqNLoBAAJ
-
-    // Read on Value Clips here:
-    // https://graphics.pixar.com/usd/docs/api/_usd__page__value_clips.html
-
-    // get the strength-ordered ( strong-to-weak order ) list of property specs that provide
-    // opinions for this property.
-    const auto& propertyStack = attr.GetPropertyStack();
-
-    if (!propertyStack.empty()) {
-        // get the strongest layer that has the attr.
-        auto strongestLayer = attr.GetPropertyStack().front()->GetLayer();
-
-        // compare the calculated index between the "attr" and "edit target" layers.
-        if (findLayerIndex(prim, strongestLayer) < targetLayerIndex) {
-            if (errMsg) {
-                *errMsg = TfStringPrintf(
-                    "Cannot edit [%s] attribute because there is a stronger opinion in [%s].",
-                    attr.GetBaseName().GetText(),
-                    strongestLayer->GetDisplayName().c_str());
-            }
-
-            return false;
-        }
+    // The property stack checks are cached until the stage composition changes.
+    const PropertyEditability editability
+        = getEditabilityCache().get(attr, stage->GetEditTarget().GetLayer());
+    if (!editability.allowed && errMsg) {
+        *errMsg = editability.errMsg;
     }
+    return editability.allowed;
+}
 
-    // Time samples in the edit target layer take precedence over any default value written there.
-    // The edit would have no visible effect at any frame. Opinions from stronger layers are already
-    // caught by the property stack check above, so we only inspect the edit target layer's own spec
-    // here.
-    for (const auto& spec : propertyStack) {
-        const auto& specLayer = spec->GetLayer();
-        if (specLayer == editTarget.GetLayer()) {
-            if (specLayer->GetNumTimeSamplesForPath(spec->GetPath()) > 0) {
-                if (errMsg) {
-                    *errMsg = TfStringPrintf(
-                        "Cannot edit [%s] attribute because it has time samples in [%s].",
-                        attr.GetBaseName().GetText(),
-                        specLayer->GetDisplayName().c_str());
-                }
-                return false;
-            }
-            break; // Avoid checking weaker layers since they won't have any effect.
+bool areAttributeEditsAllowed(const std::vector<PXR_NS::UsdProperty>& attrs, std::string* errMsg)
+{
+    for (const auto& attr : attrs) {
+        if (!isAttributeEditAllowed(attr, errMsg)) {
+            return false;
         }
     }
 
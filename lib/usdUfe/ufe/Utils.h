@@ -42,6 +42,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 UFE_NS_DEF
 {
@@ -238,6 +239,12 @@ bool isRootChildDefault(const Ufe::Path& path);
 USDUFE_PUBLIC
 bool splitNumericalSuffix(const std::string srcName, std::string& base, std::string& suffix);
 
+//! Parse the numerical suffix <p suffixStr> found by splitNumericalSuffix() into <p suffix>.
+//! Returns false when it does not fit in an int (e.g. a timestamp), in which case the name
+//! is handled as if it had no numerical suffix.
+USDUFE_PUBLIC
+bool parseNumericalSuffix(const std::string& suffixStr, int& suffix);
+
 //! Split the source name into a base name and a numerical suffix (set to
 //! 1 if absent). Increment the numerical suffix until name is unique.
 USDUFE_PUBLIC
@@ -414,6 +421,15 @@ bool isAttributeEditAllowed(
 USDUFE_PUBLIC
 bool isAttributeEditAllowed(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrName);
 
+//! Check if all the properties values are allowed to be changed, for example the attributes of
+//! a whole selection before a manipulation. Properties of the same prim share the composition
+//! queries. Stops at the first property that is not allowed to be edited.
+//! \return True, if all the property values are allowed to be edited.
+USDUFE_PUBLIC
+bool areAttributeEditsAllowed(
+    const std::vector<PXR_NS::UsdProperty>& attrs,
+    std::string*                            errMsg = nullptr);
+
 //! Enforce if an property (attribute or relationship) value is allowed to be changed. Throw an
 //! exception if not allowed.
 USDUFE_PUBLIC
@@ -130,24 +130,27 @@ bool UsdTransform3dBase::isAttributeEditAllowed(const TfToken* attrNames, int co
     OperationEditRouterContext editContext(EditRoutingTokens->RouteTransform, prim());
     std::string                errMsg;
 
+    std::vector<PXR_NS::UsdProperty> attrs;
+    attrs.reserve(count);
     for (int i = 0; i < count; ++i) {
         const TfToken&       attrName = attrNames[i];
         PXR_NS::UsdAttribute attr;
         if (!attrName.IsEmpty())
             attr = prim().GetAttribute(attrName);
-        if (attr && !UsdUfe::isAttributeEditAllowed(attr, &errMsg)) {
-            displayMessage(MessageType::kError, errMsg.c_str());
-            return false;
-        } else if (!attr) {
+        if (attr) {
+            attrs.push_back(attr);
+        } else {
             // If the attribute does not exist, we will need to edit the xformOpOrder
             // so check if we would be allowed to do that.
             UsdGeomXformable xformable(prim());
-            if (!UsdUfe::isAttributeEditAllowed(xformable.GetXformOpOrderAttr(), &errMsg)) {
-                displayMessage(MessageType::kError, errMsg.c_str());
-                return false;
-            }
+            attrs.push_back(xformable.GetXformOpOrderAttr());
         }
     }
+
+    if (!UsdUfe::areAttributeEditsAllowed(attrs, &errMsg)) {
+        displayMessage(MessageType::kError, errMsg.c_str());
+        return false;
+    }
     return true;
 }
 
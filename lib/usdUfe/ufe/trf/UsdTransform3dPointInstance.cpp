@@ -16,6 +16,7 @@
 #include "UsdTransform3dPointInstance.h"
 
 #include <usdUfe/base/tokens.h>
+#include <usdUfe/ufe/StagesSubject.h>
 #include <usdUfe/ufe/UsdSceneItem.h>
 #include <usdUfe/ufe/Utils.h>
 #include <usdUfe/ufe/trf/UsdPointInstanceUndoableCommands.h>
@@ -50,6 +51,10 @@ UsdTransform3dPointInstance::UsdTransform3dPointInstance(const UsdSceneItem::Ptr
         _positionModifier.setSceneItem(item);
         _orientationModifier.setSceneItem(item);
         _scaleModifier.setSceneItem(item);
+
+        // Once a point instance is looked at, the next change of the instancer made outside of
+        // UFE commands only notifies the instances it affected.
+        StagesSubject::trackPointInstancer(item->prim(), getTime(item->path()));
     }
 }
 
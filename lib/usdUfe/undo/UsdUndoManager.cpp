@@ -16,6 +16,7 @@
 
 #include "UsdUndoManager.h"
 
+#include <usdUfe/base/debugCodes.h>
 #include <usdUfe/undo/UsdUndoBlock.h>
 #include <usdUfe/undo/UsdUndoStateDelegate.h>
 
@@ -43,7 +44,7 @@ void UsdUndoManager::trackLayerStates(const SdfLayerHandle& layer)
     }
 }
 
-void UsdUndoManager::addInverse(UsdUndoableItem::InvertFunc func)
+void UsdUndoManager::addInverse(UsdUndoableItem::InvertFunc func, std::size_t byteSize)
 {
     if (UsdUndoBlock::depth() == 0) {
         TF_CODING_ERROR("Collecting invert functions outside of undoblock is not allowed!");
@@ -51,6 +52,17 @@ void UsdUndoManager::addInverse(UsdUndoableItem::InvertFunc func)
     }
 
     _invertFuncs.emplace_back(func);
+
+    _byteSize += byteSize;
+    if (_memoryLimit != 0 && _byteSize > _memoryLimit && !_memoryLimitReported) {
+        TF_WARN(
+            "Undo block holds %zu bytes in %zu edits, exceeding the undo memory limit of %zu "
+            "bytes.",
+            _byteSize,
+            _invertFuncs.size(),
+            _memoryLimit);
+        _memoryLimitReported = true;
+    }
 }
 
 void UsdUndoManager::transferEdits(UsdUndoableItem& undoableItem, bool extraEdits)
@@ -59,10 +71,22 @@ void UsdUndoManager::transferEdits(UsdUndoableItem& undoableItem, bool extraEdit
     if (extraEdits) {
         undoableItem._invertFuncs.insert(
             undoableItem._invertFuncs.begin(), _invertFuncs.begin(), _invertFuncs.end());
-        _invertFuncs.clear();
     } else {
         undoableItem._invertFuncs = std::move(_invertFuncs);
+        undoableItem._byteSize = 0;
     }
+    undoableItem._byteSize += _byteSize;
+
+    TF_DEBUG_MSG(
+        USDUFE_UNDOSTACK,
+        "Transferred edits holding %zu bytes to the undoable item.\n",
+        _byteSize);
+
+    // The next undo block starts with a fresh set of coalesced edits.
+    _invertFuncs.clear();
+    _byteSize = 0;
+    _memoryLimitReported = false;
+    UsdUndoStateDelegate::notifyTransfer();
 }
 
 } // namespace USDUFE_NS_DEF
@@ -35,6 +35,10 @@ namespace USDUFE_NS_DEF {
     1- tracking layer state changes from UsdUndoStateDelegate
     2- collecting InvertFunc() in every state change
     3- transferring collected edits into an UsdUndoableItem
+
+    The manager also accounts for the approximate number of bytes held by the
+    collected inverse values. An optional memory limit can be set, in which case
+    an undo block exceeding it is reported with a warning.
 */
 class USDUFE_PUBLIC UsdUndoManager
 {
@@ -47,17 +51,25 @@ public:
     // tracks layer states by spawning a new UsdUndoStateDelegate
     void trackLayerStates(const SdfLayerHandle& layer);
 
+    // sets the number of bytes a single undo block may hold before being reported.
+    // Zero, the default, means no limit.
+    void        setMemoryLimit(std::size_t byteSize) { _memoryLimit = byteSize; }
+    std::size_t getMemoryLimit() const { return _memoryLimit; }
+
 private:
     friend class UsdUndoManagerAccessor;
 
     UsdUndoManager() = default;
     ~UsdUndoManager() = default;
 
-    void addInverse(UsdUndoableItem::InvertFunc func);
+    void addInverse(UsdUndoableItem::InvertFunc func, std::size_t byteSize);
     void transferEdits(UsdUndoableItem& undoableItem, bool extraEdits);
 
 private:
     UsdUndoableItem::InvertFuncs _invertFuncs;
+    std::size_t                  _byteSize { 0 };
+    std::size_t                  _memoryLimit { 0 };
+    bool                         _memoryLimitReported { false };
 };
 
 //! \brief Helper struct which exists only to provide controlled,
@@ -71,10 +83,10 @@ public:
     ~UsdUndoManagerAccessor() = delete;
     USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(UsdUndoManagerAccessor);
 
-    static void addInverse(UsdUndoableItem::InvertFunc func)
+    static void addInverse(UsdUndoableItem::InvertFunc func, std::size_t byteSize = 0)
     {
         auto& undoManager = UsdUfe::UsdUndoManager::instance();
-        undoManager.addInverse(func);
+        undoManager.addInverse(func, byteSize);
     }
     static void transferEdits(UsdUndoableItem& undoableItem, bool extraEdits = false)
     {
@@ -19,11 +19,37 @@
 #include <usdUfe/undo/UsdUndoBlock.h>
 #include <usdUfe/undo/UsdUndoManager.h>
 
+#include <pxr/usd/sdf/schema.h>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace {
 
-void copySpecAtPath(const SdfAbstractData& src, SdfAbstractData* dst, const SdfPath& path)
+// Returns the approximate number of bytes held by the given value. Only the payload of arrays
+// and strings is accounted for, which is where the bulk of the undo memory goes.
+std::size_t estimateByteSize(const VtValue& value)
+{
+    std::size_t byteSize = sizeof(VtValue);
+    if (value.IsArrayValued()) {
+        const SdfValueTypeName typeName = SdfSchema::GetInstance().FindType(value);
+        if (typeName) {
+            byteSize += value.GetArraySize() * typeName.GetScalarType().GetType().GetSizeof();
+        }
+    } else if (value.IsHolding<std::string>()) {
+        byteSize += value.UncheckedGet<std::string>().size();
+    }
+    return byteSize;
+}
+
+// Children list fields are not coalesced, since their inverse is filtered against the specs
+// deleted during the undo. See UsdUndoStateDelegate::invertSetField().
+bool isChildrenField(const TfToken& fieldName)
+{
+    return fieldName == SdfChildrenKeys->PrimChildren
+        || fieldName == SdfChildrenKeys->PropertyChildren;
+}
+
+std::size_t copySpecAtPath(const SdfAbstractData& src, SdfAbstractData* dst, const SdfPath& path)
 {
     // create a new spec at a path with the given specType
     dst->CreateSpec(path, src.GetSpecType(path));
@@ -32,9 +58,13 @@ void copySpecAtPath(const SdfAbstractData& src, SdfAbstractData* dst, const SdfP
     const std::vector<TfToken>& tokens = src.List(path);
 
     // set the value of dst at the given path and a fieldName
+    std::size_t byteSize = 0;
     for (const auto& token : tokens) {
-        dst->Set(path, token, src.Get(path, token));
+        const VtValue value = src.Get(path, token);
+        byteSize += estimateByteSize(value);
+        dst->Set(path, token, value);
     }
+    return byteSize;
 }
 
 // This class is used to copy specs from source SdfAbstractData container
@@ -69,6 +99,10 @@ uint32_t UsdUndoStateDelegate::_invertCount { 0 };
 
 void UsdUndoStateDelegate::notifyInvert() { ++_invertCount; }
 
+uint32_t UsdUndoStateDelegate::_transferCount { 0 };
+
+void UsdUndoStateDelegate::notifyTransfer() { ++_transferCount; }
+
 UsdUndoStateDelegate::UsdUndoStateDelegate()
     : _dirty(false)
     , _setMessageAlreadyShowed(false)
@@ -326,26 +360,7 @@ void UsdUndoStateDelegate::_OnSetField(
     const TfToken& fieldName,
     const VtValue& value)
 {
-    _MarkCurrentStateAsDirty();
-
-    // early return if we are not inside an UsdUndoBlock
-    if (UsdUndoBlock::depth() == 0) {
-        return;
-    }
-
-    if (!_setMessageAlreadyShowed) {
-        TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
-            .Msg("Setting Field '%s' for Spec '%s'\n", fieldName.GetText(), path.GetText());
-    }
-
-    if (!_layer) {
-        return;
-    }
-
-    const VtValue inverseValue = _layer->GetField(path, fieldName);
-
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    _OnSetFieldImpl(path, fieldName);
 }
 
 void UsdUndoStateDelegate::_OnSetField(
@@ -353,27 +368,7 @@ void UsdUndoStateDelegate::_OnSetField(
     const TfToken&                   fieldName,
     const SdfAbstractDataConstValue& value)
 {
-    _MarkCurrentStateAsDirty();
-
-    // early return if we are not inside an UsdUndoBlock
-    if (UsdUndoBlock::depth() == 0) {
-        return;
-    }
-
-    if (!_setMessageAlreadyShowed) {
-        TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
-            .Msg("Setting Field '%s' for Spec '%s'\n", fieldName.GetText(), path.GetText());
-    }
-
-    if (!_layer) {
-        return;
-    }
-
-    const VtValue inverseValue = _layer->GetField(path, fieldName);
-
-    // add invert
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    _OnSetFieldImpl(path, fieldName);
 }
 
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKey(
@@ -447,19 +442,30 @@ void UsdUndoStateDelegate::_OnDeleteSpec(const SdfPath& path, bool inert)
         return;
     }
 
+    _ClearRecordedEdits();
+
     SdfDataRefPtr deletedData = TfCreateRefPtr(new SdfData());
 
     // traverse the hierarchy and call copySpecAtPath on each spec
-    auto layerDataPtr = std::cref(*get_pointer(_GetLayerData()));
-    auto deleteDataPtr = get_pointer(deletedData);
+    auto        layerDataPtr = std::cref(*get_pointer(_GetLayerData()));
+    auto        deleteDataPtr = get_pointer(deletedData);
+    std::size_t byteSize = 0;
 
-    _GetLayer()->Traverse(
-        path, [&](const SdfPath& path) { copySpecAtPath(layerDataPtr, deleteDataPtr, path); });
+    _GetLayer()->Traverse(path, [&](const SdfPath& path) {
+        byteSize += copySpecAtPath(layerDataPtr, deleteDataPtr, path);
+    });
 
     const SdfSpecType deletedSpecType = _GetLayer()->GetSpecType(path);
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-        &UsdUndoStateDelegate::invertDeleteSpec, this, path, inert, deletedSpecType, deletedData));
+    UsdUfe::UsdUndoManagerAccessor::addInverse(
+        std::bind(
+            &UsdUndoStateDelegate::invertDeleteSpec,
+            this,
+            path,
+            inert,
+            deletedSpecType,
+            deletedData),
+        byteSize);
 }
 
 void UsdUndoStateDelegate::_OnMoveSpec(const SdfPath& oldPath, const SdfPath& newPath)
@@ -480,6 +486,8 @@ void UsdUndoStateDelegate::_OnMoveSpec(const SdfPath& oldPath, const SdfPath& ne
         return;
     }
 
+    _ClearRecordedEdits();
+
     UsdUfe::UsdUndoManagerAccessor::addInverse(
         std::bind(&UsdUndoStateDelegate::invertMoveSpec, this, oldPath, newPath));
 }
@@ -584,6 +592,38 @@ void UsdUndoStateDelegate::_OnPopChild(
         &UsdUndoStateDelegate::invertPopPathChild, this, parentPath, fieldName, oldValue));
 }
 
+void UsdUndoStateDelegate::_OnSetFieldImpl(const SdfPath& path, const TfToken& fieldName)
+{
+    _MarkCurrentStateAsDirty();
+
+    // early return if we are not inside an UsdUndoBlock
+    if (UsdUndoBlock::depth() == 0) {
+        return;
+    }
+
+    if (!_setMessageAlreadyShowed) {
+        TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
+            .Msg("Setting Field '%s' for Spec '%s'\n", fieldName.GetText(), path.GetText());
+    }
+
+    if (!_layer) {
+        return;
+    }
+
+    // The field is already restored by the inverse of an earlier edit of the same field.
+    _SyncRecordedEdits();
+    if (!isChildrenField(fieldName) && !_recordedFields.emplace(path, fieldName).second) {
+        return;
+    }
+
+    const VtValue inverseValue = _layer->GetField(path, fieldName);
+
+    // add invert
+    UsdUfe::UsdUndoManagerAccessor::addInverse(
+        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue),
+        estimateByteSize(inverseValue));
+}
+
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKeyImpl(
     const SdfPath& path,
     const TfToken& fieldName,
@@ -609,15 +649,26 @@ void UsdUndoStateDelegate::_OnSetFieldDictValueByKeyImpl(
         return;
     }
 
+    // The key is already restored by the inverse of an earlier edit of the same key or of the
+    // whole dictionary.
+    _SyncRecordedEdits();
+    _FieldKey fieldKey(path, fieldName);
+    if (_recordedFields.count(fieldKey) != 0
+        || !_recordedDictKeys.emplace(std::move(fieldKey), keyPath).second) {
+        return;
+    }
+
     const VtValue inverseValue = _layer->GetFieldDictValueByKey(path, fieldName, keyPath);
 
-    UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-        &UsdUndoStateDelegate::invertSetFieldDictValueByKey,
-        this,
-        path,
-        fieldName,
-        keyPath,
-        inverseValue));
+    UsdUfe::UsdUndoManagerAccessor::addInverse(
+        std::bind(
+            &UsdUndoStateDelegate::invertSetFieldDictValueByKey,
+            this,
+            path,
+            fieldName,
+            keyPath,
+            inverseValue),
+        estimateByteSize(inverseValue));
 }
 
 void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time)
@@ -632,7 +683,17 @@ void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time
     TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
         .Msg("Setting time sample '%f' for spec '%s'\n", time, path.GetText());
 
+    // The sample is already restored by the inverse of an earlier edit of the same sample or of
+    // the whole time samples field.
+    _SyncRecordedEdits();
+    _FieldKey fieldKey(path, SdfFieldKeys->TimeSamples);
+    if (_recordedFields.count(fieldKey) != 0) {
+        return;
+    }
+
     if (!_GetLayer()->HasField(path, SdfFieldKeys->TimeSamples)) {
+        _recordedFields.insert(std::move(fieldKey));
+
         UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
             &UsdUndoStateDelegate::invertSetField,
             this,
@@ -641,15 +702,36 @@ void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time
             VtValue()));
 
     } else {
+        if (!_recordedTimeSamples.emplace(path, time).second) {
+            return;
+        }
+
         VtValue oldValue;
 
         _GetLayer()->QueryTimeSample(path, time, &oldValue);
 
         UsdUfe::UsdUndoManagerAccessor::addInverse(
-            std::bind(&UsdUndoStateDelegate::invertSetTimeSample, this, path, time, oldValue));
+            std::bind(&UsdUndoStateDelegate::invertSetTimeSample, this, path, time, oldValue),
+            estimateByteSize(oldValue));
+    }
+}
+
+void UsdUndoStateDelegate::_SyncRecordedEdits()
+{
+    // New undo block — forget the edits recorded by the previous one.
+    if (_transferCount != _lastTransferCount) {
+        _ClearRecordedEdits();
+        _lastTransferCount = _transferCount;
     }
 }
 
+void UsdUndoStateDelegate::_ClearRecordedEdits()
+{
+    _recordedFields.clear();
+    _recordedDictKeys.clear();
+    _recordedTimeSamples.clear();
+}
+
 // We hit a wall when running testGroupCmd with the new Undo/Redo service.
 // Grouping involves two command operation (AddPrim, Parent) and during the parent::undo(), the
 // parented token (newGroup1) wasn't properly removed which caused the test to fail.
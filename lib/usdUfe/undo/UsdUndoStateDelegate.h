@@ -19,6 +19,7 @@
 
 #include <usdUfe/base/api.h>
 
+#include <pxr/base/tf/hash.h>
 #include <pxr/usd/sdf/data.h>
 #include <pxr/usd/sdf/layerStateDelegate.h>
 
@@ -26,6 +27,7 @@
 #include <pxr/usd/usd/prim.h>
 
 #include <unordered_set>
+#include <utility>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -40,6 +42,10 @@ TF_DECLARE_WEAK_AND_REF_PTRS(UsdUndoStateDelegate);
     There exist exactly one invert function for every authoring operation. These invert functions
    are collected by UsdUndoManager::addInverse() call which then will be transfered to an
    UsdUndoableItem object when UsdUndoBlock expires.
+
+    Within an undo block, repeated edits of the same field, dictionary key or time sample are
+   coalesced: only the value prior to the first edit is kept, since it is the one restored once
+   the whole block is undone. Moving or deleting specs ends the coalescing run.
 */
 class USDUFE_PUBLIC UsdUndoStateDelegate : public SdfLayerStateDelegateBase
 {
@@ -53,6 +59,10 @@ public:
     /// to manage any per-undo/redo state.
     static void notifyInvert();
 
+    /// Called when the collected edits are transferred to an undoable item. Increments
+    /// _transferCount, so that every delegate starts a new coalescing run.
+    static void notifyTransfer();
+
 private:
     void invertSetField(const SdfPath& path, const TfToken& fieldName, const VtValue& inverse);
     void invertCreateSpec(const SdfPath& path, bool inert);
@@ -120,6 +130,7 @@ protected:
         override;
 
 private:
+    void _OnSetFieldImpl(const SdfPath& path, const TfToken& fieldName);
     void _OnSetFieldDictValueByKeyImpl(
         const SdfPath& path,
         const TfToken& fieldName,
@@ -129,6 +140,9 @@ private:
     template <class T>
     void _PopChild(const SdfPath& parentPath, const TfToken& fieldName, const T& oldValue);
 
+    void _SyncRecordedEdits();
+    void _ClearRecordedEdits();
+
 private:
     SdfLayerHandle _layer;
     bool           _dirty;
@@ -140,6 +154,15 @@ private:
 
     uint32_t        _lastInvertCount { 0 };
     static uint32_t _invertCount;
+
+    // Edits already recorded in the current undo block, used to coalesce repeated edits.
+    using _FieldKey = std::pair<SdfPath, TfToken>;
+    std::unordered_set<_FieldKey, TfHash>                     _recordedFields;
+    std::unordered_set<std::pair<_FieldKey, TfToken>, TfHash> _recordedDictKeys;
+    std::unordered_set<std::pair<SdfPath, double>, TfHash>    _recordedTimeSamples;
+
+    uint32_t        _lastTransferCount { 0 };
+    static uint32_t _transferCount;
 };
 
 } // namespace USDUFE_NS_DEF
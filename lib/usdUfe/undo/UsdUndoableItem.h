@@ -52,12 +52,16 @@ public:
 
     std::size_t getEditCount() const { return _invertFuncs.size(); }
 
+    // approximate number of bytes held by the values captured by the edits.
+    std::size_t getByteSize() const { return _byteSize; }
+
 private:
     friend class UsdUndoManager;
 
     void doInvert();
 
     InvertFuncs _invertFuncs;
+    std::size_t _byteSize { 0 };
 };
 
 } // namespace USDUFE_NS_DEF
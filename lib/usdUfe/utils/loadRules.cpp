@@ -16,8 +16,152 @@
 
 #include "loadRules.h"
 
+#include <algorithm>
+#include <unordered_map>
+
+namespace {
+
+// The load rules edited in the open transactions of a stage.
+struct PendingLoadRules
+{
+    int                       depth { 0 };
+    PXR_NS::UsdStageLoadRules rules;
+
+    // The payloads loaded and unloaded in the transaction, applied with a single call to
+    // UsdStage::LoadAndUnload when no other edit was made to the load rules.
+    PXR_NS::SdfPathSet    loadSet;
+    PXR_NS::SdfPathSet    unloadSet;
+    PXR_NS::UsdLoadPolicy policy { PXR_NS::UsdLoadWithDescendants };
+    bool                  onlyPayloads { true };
+};
+
+std::unordered_map<const PXR_NS::UsdStage*, PendingLoadRules>& getPendingLoadRules()
+{
+    static std::unordered_map<const PXR_NS::UsdStage*, PendingLoadRules> pendingLoadRules;
+    return pendingLoadRules;
+}
+
+PendingLoadRules* findPendingLoadRules(const PXR_NS::UsdStage& stage)
+{
+    auto& pendingLoadRules = getPendingLoadRules();
+    auto  it = pendingLoadRules.find(&stage);
+    return it != pendingLoadRules.end() ? &it->second : nullptr;
+}
+
+// Set the load rules on the stage, or on the pending load rules of an open transaction.
+void applyLoadRules(PXR_NS::UsdStage& stage, const PXR_NS::UsdStageLoadRules& loadRules)
+{
+    if (PendingLoadRules* pending = findPendingLoadRules(stage)) {
+        pending->rules = loadRules;
+        pending->onlyPayloads = false;
+        return;
+    }
+    stage.SetLoadRules(loadRules);
+}
+
+void commitLoadRules(PXR_NS::UsdStage& stage, const PendingLoadRules& pending)
+{
+    const PXR_NS::UsdStageLoadRules& stageRules = stage.GetLoadRules();
+    if (stageRules == pending.rules)
+        return;
+
+    // UsdStage::LoadAndUnload only recomposes the prims with modified payloads, while
+    // SetLoadRules recomposes the whole stage, so use it when it gives the same load rules.
+    // They may differ when nested paths were loaded and unloaded, as LoadAndUnload
+    // processes the unloads before the loads.
+    if (pending.onlyPayloads) {
+        PXR_NS::UsdStageLoadRules loadRules = stageRules;
+        loadRules.LoadAndUnload(pending.loadSet, pending.unloadSet, pending.policy);
+        if (loadRules == pending.rules) {
+            stage.LoadAndUnload(pending.loadSet, pending.unloadSet, pending.policy);
+            return;
+        }
+    }
+    stage.SetLoadRules(pending.rules);
+}
+
+} // namespace
+
 namespace USDUFE_NS_DEF {
 
+LoadRulesTransaction::LoadRulesTransaction(const PXR_NS::UsdStagePtr& stage)
+    : _stage(stage)
+    , _key(get_pointer(stage))
+{
+    if (!_stage)
+        return;
+
+    PendingLoadRules& pending = getPendingLoadRules()[_key];
+    if (pending.depth++ == 0)
+        pending.rules = _stage->GetLoadRules();
+}
+
+LoadRulesTransaction::~LoadRulesTransaction()
+{
+    auto& pendingLoadRules = getPendingLoadRules();
+    auto  it = pendingLoadRules.find(_key);
+    if (it == pendingLoadRules.end() || --it->second.depth > 0)
+        return;
+
+    // Remove the pending rules first, so that the stage is updated by the commit.
+    const PendingLoadRules pending = std::move(it->second);
+    pendingLoadRules.erase(it);
+
+    // The stage may have been released during the transaction.
+    if (_stage)
+        commitLoadRules(*_stage, pending);
+}
+
+bool LoadRulesTransaction::isActive(const PXR_NS::UsdStage& stage)
+{
+    return findPendingLoadRules(stage) != nullptr;
+}
+
+const PXR_NS::UsdStageLoadRules& getLoadRules(const PXR_NS::UsdStage& stage)
+{
+    if (const PendingLoadRules* pending = findPendingLoadRules(stage))
+        return pending->rules;
+    return stage.GetLoadRules();
+}
+
+void loadPayload(
+    PXR_NS::UsdStage&      stage,
+    const PXR_NS::SdfPath& path,
+    PXR_NS::UsdLoadPolicy  policy)
+{
+    PendingLoadRules* pending = findPendingLoadRules(stage);
+    if (!pending) {
+        stage.Load(path, policy);
+        return;
+    }
+
+    // A single LoadAndUnload call can only apply one policy.
+    if (!pending->loadSet.empty() && pending->policy != policy)
+        pending->onlyPayloads = false;
+
+    pending->rules.LoadAndUnload({ path }, {}, policy);
+    pending->loadSet.insert(path);
+    pending->policy = policy;
+}
+
+void unloadPayload(PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path)
+{
+    PendingLoadRules* pending = findPendingLoadRules(stage);
+    if (!pending) {
+        stage.Unload(path);
+        return;
+    }
+
+    pending->rules.Unload(path);
+    pending->unloadSet.insert(path);
+}
+
+void setLoadRules(PXR_NS::UsdStage& stage, const PXR_NS::UsdStageLoadRules& newLoadRules)
+{
+    if (getLoadRules(stage) != newLoadRules)
+        applyLoadRules(stage, newLoadRules);
+}
+
 void duplicateLoadRules(
     PXR_NS::UsdStage&      stage,
     const PXR_NS::SdfPath& fromPath,
@@ -26,7 +170,7 @@ void duplicateLoadRules(
     // Use const references for the fast-path check to avoid copies.
     // SetLoadRules triggers a full stage recomposition, so we want to
     // avoid calling it when nothing needs to change.
-    const auto& originalRules = stage.GetLoadRules();
+    const auto& originalRules = getLoadRules(stage);
     const auto& existingRules = originalRules.GetRules();
 
     const bool hasSourceRules
@@ -95,14 +239,14 @@ void duplicateLoadRules(
     }
 
     // Update the rules in the stage since we were operating on a copy.
-    stage.SetLoadRules(loadRules);
+    applyLoadRules(stage, loadRules);
 }
 
 void removeRulesForPath(PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path)
 {
     // SetLoadRules triggers a full stage recomposition, so check
     // if any rules actually reference this path before doing work.
-    const auto& originalRules = stage.GetLoadRules();
+    const auto& originalRules = getLoadRules(stage);
     const auto& existingRules = originalRules.GetRules();
 
     const bool hasRules
@@ -128,7 +272,7 @@ void removeRulesForPath(PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path)
     // Update the rules in the load rules object and then in the stage
     // since we were operating on a copy.
     loadRules.SetRules(rules);
-    stage.SetLoadRules(loadRules);
+    applyLoadRules(stage, loadRules);
 }
 
 void moveLoadRules(
@@ -139,7 +283,7 @@ void moveLoadRules(
     // Use const references for the fast-path check to avoid copies.
     // SetLoadRules triggers a full stage recomposition, so we want to
     // avoid calling it when nothing needs to change.
-    const auto& originalRules = stage.GetLoadRules();
+    const auto& originalRules = getLoadRules(stage);
     const auto& existingRules = originalRules.GetRules();
 
     const bool hasSourceRules
@@ -185,7 +329,7 @@ void moveLoadRules(
     rules.erase(newEnd, rules.end());
     loadRules.SetRules(rules);
 
-    stage.SetLoadRules(loadRules);
+    applyLoadRules(stage, loadRules);
 }
 
 } // namespace USDUFE_NS_DEF
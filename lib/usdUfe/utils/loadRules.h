@@ -26,6 +26,50 @@
 
 namespace USDUFE_NS_DEF {
 
+/*! \brief scope a batch of load rules edits on a stage.
+ *
+ *  While a transaction is open on a stage, the functions of this file that modify the stage
+ *  load rules, as well as loadPayload() and unloadPayload(), edit pending load rules instead
+ *  of the stage, since each stage update triggers a recomposition. The pending load rules are
+ *  applied to the stage in a single update when the outermost transaction of the stage ends.
+ *
+ *  Transactions on the same stage can be nested. They must be used from the main thread.
+ */
+class USDUFE_PUBLIC LoadRulesTransaction
+{
+public:
+    explicit LoadRulesTransaction(const PXR_NS::UsdStagePtr& stage);
+    ~LoadRulesTransaction();
+
+    USDUFE_DISALLOW_COPY_MOVE_AND_ASSIGNMENT(LoadRulesTransaction);
+
+    /*! \brief returns true if a transaction is open on the stage.
+     */
+    static bool isActive(const PXR_NS::UsdStage& stage);
+
+private:
+    PXR_NS::UsdStagePtr     _stage;
+    const PXR_NS::UsdStage* _key;
+};
+
+/*! \brief get the stage load rules, including the edits pending in an open transaction.
+ */
+USDUFE_PUBLIC
+const PXR_NS::UsdStageLoadRules& getLoadRules(const PXR_NS::UsdStage& stage);
+
+/*! \brief load the payload of the prim at the path, like UsdStage::Load.
+ */
+USDUFE_PUBLIC
+void loadPayload(
+    PXR_NS::UsdStage&      stage,
+    const PXR_NS::SdfPath& path,
+    PXR_NS::UsdLoadPolicy  policy = PXR_NS::UsdLoadWithDescendants);
+
+/*! \brief unload the payload of the prim at the path, like UsdStage::Unload.
+ */
+USDUFE_PUBLIC
+void unloadPayload(PXR_NS::UsdStage& stage, const PXR_NS::SdfPath& path);
+
 /*! \brief modify the stage load rules so that the rules governing fromPath are replicated for
  * destPath.
  */
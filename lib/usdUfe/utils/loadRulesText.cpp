@@ -30,12 +30,6 @@ void setLoadRulesFromText(PXR_NS::UsdStage& stage, const std::string& text)
     setLoadRules(stage, createLoadRulesFromText(text));
 }
 
-void setLoadRules(PXR_NS::UsdStage& stage, const PXR_NS::UsdStageLoadRules& newLoadRules)
-{
-    if (stage.GetLoadRules() != newLoadRules)
-        stage.SetLoadRules(newLoadRules);
-}
-
 static std::string convertRuleToText(const PXR_NS::UsdStageLoadRules::Rule rule)
 {
     // Note: using namespace required for the TF_WARN macro.
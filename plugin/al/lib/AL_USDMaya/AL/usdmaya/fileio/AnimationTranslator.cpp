@@ -22,15 +22,72 @@
 
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnMatrixData.h>
+#include <maya/MFnMesh.h>
+#include <maya/MGlobal.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
+#include <maya/MTime.h>
+
+#include <memory>
 
 namespace AL {
 namespace usdmaya {
 namespace fileio {
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  copies the points of the mesh, pulled through its outMesh plug so that they are
+///         evaluated in the current DG context.
+void copyMeshPointsInContext(const MDagPath& path, UsdGeomMesh& mesh, UsdTimeCode timeCode)
+{
+    UsdAttribute pointsAttr = mesh.GetPointsAttr();
+    if (!pointsAttr) {
+        return;
+    }
+
+    MStatus      status;
+    MFnDagNode   fnDag(path, &status);
+    MPlug        outMeshPlug = fnDag.findPlug("outMesh", true, &status);
+    MObject      meshData = status ? outMeshPlug.asMObject(&status) : MObject();
+    MFnMesh      fnMesh(meshData, &status);
+    const float* pointsData = status ? fnMesh.getRawPoints(&status) : nullptr;
+    if (!pointsData) {
+        MGlobal::displayError(
+            MString("Unable to access mesh vertices on mesh: ") + path.fullPathName());
+        return;
+    }
+
+    const GfVec3f*   vecData = reinterpret_cast<const GfVec3f*>(pointsData);
+    VtArray<GfVec3f> points(vecData, vecData + fnMesh.numVertices());
+    pointsAttr.Set(points, timeCode);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns the world matrix of the dag path, pulled through its worldMatrix plug so that it
+///         is evaluated in the current DG context.
+MMatrix worldMatrixInContext(const MDagPath& path)
+{
+    MStatus    status;
+    MFnDagNode fnDag(path, &status);
+    MPlug      worldMatrixPlug = fnDag.findPlug("worldMatrix", true, &status);
+    if (status) {
+        MObject matrixData
+            = worldMatrixPlug.elementByLogicalIndex(path.instanceNumber()).asMObject(&status);
+        MFnMatrixData fnMatrixData(matrixData, &status);
+        if (status) {
+            return fnMatrixData.matrix();
+        }
+    }
+    return path.inclusiveMatrix();
+}
+
+} // namespace
 
 //----------------------------------------------------------------------------------------------------------------------
 void AnimationTranslator::exportAnimation(const ExporterParams& params)
@@ -51,9 +108,19 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
     if ((startAttrib != endAttrib) || (startAttribScaled != endAttribScaled)
         || (startTransformAttrib != endTransformAttrib) || (startMultiAttrib != endMultiAttrib)
         || (startMesh != endMesh) || (startWSM != endWSM) || (!m_animatedNodes.empty())) {
-        double increment = 1.0 / std::max(1U, params.m_subSamples);
+        // Custom translators may read their data outside of the DG, in which case they need the
+        // current time to be set.
+        const bool contextEvaluation = params.m_contextEvaluation && m_animatedNodes.empty();
+        double     increment = 1.0 / std::max(1U, params.m_subSamples);
         for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
-            MAnimControl::setCurrentTime(t);
+            const MTime                      sampleTime(t);
+            const MDGContext                 sampleContext(sampleTime);
+            std::unique_ptr<MDGContextGuard> contextGuard;
+            if (contextEvaluation) {
+                contextGuard.reset(new MDGContextGuard(sampleContext));
+            } else {
+                MAnimControl::setCurrentTime(sampleTime);
+            }
             UsdTimeCode timeCode(t);
             for (auto it = startAttrib; it != endAttrib; ++it) {
                 /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
@@ -98,7 +165,11 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
                 }
             }
             for (auto it = startMesh; it != endMesh; ++it) {
-                UsdGeomMesh                           mesh(it->second.GetPrim());
+                UsdGeomMesh mesh(it->second.GetPrim());
+                if (contextEvaluation) {
+                    copyMeshPointsInContext(it->first, mesh, timeCode);
+                    continue;
+                }
                 AL::usdmaya::utils::MeshExportContext context(it->first, mesh, timeCode);
                 context.copyVertexData(timeCode);
             }
@@ -106,7 +177,8 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
                 nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
             }
             for (auto it = startWSM; it != endWSM; ++it) {
-                MMatrix mat = it->first.inclusiveMatrix();
+                MMatrix mat = contextEvaluation ? worldMatrixInContext(it->first)
+                                                : it->first.inclusiveMatrix();
 #ifdef __GNUC__
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstrict-aliasing"
@@ -1123,6 +1123,11 @@ MStatus ExportCommand::doIt(const MArgList& args)
             argData.getFlagArgument("eac", 0, m_params.m_extensiveAnimationCheck),
             "ALUSDExport: Unable to fetch \"extensive animation check\" argument");
     }
+    if (argData.isFlagSet("cev", &status)) {
+        AL_MAYA_CHECK_ERROR(
+            argData.getFlagArgument("cev", 0, m_params.m_contextEvaluation),
+            "ALUSDExport: Unable to fetch \"context evaluation\" argument");
+    }
     if (argData.isFlagSet("ws", &status)) {
         AL_MAYA_CHECK_ERROR(
             argData.getFlagArgument("ws", 0, m_params.m_exportInWorldSpace),
@@ -1257,6 +1262,8 @@ MSyntax ExportCommand::createSyntax()
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-ss", "-subSamples", MSyntax::kUnsigned);
     AL_MAYA_CHECK_ERROR2(status, errorString);
+    status = syntax.addFlag("-cev", "-contextEvaluation", MSyntax::kBoolean);
+    AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-ws", "-worldSpace", MSyntax::kBoolean);
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-opt", "-options", MSyntax::kString);
@@ -1298,6 +1305,10 @@ ExportCommand Overview:
 
   The exporter can remove samples that contain the same data for adjacent samples
     1. AL_usdmaya_ExportCommand -f "<path/to/out/file.usd>" -fs
+
+  Animation samples can be evaluated in a DG context instead of changing the current time, so that
+  only the exported plugs are evaluated:
+    1. AL_usdmaya_ExportCommand -f "<path/to/out/file.usd>" -frameRange 0 24 -cev true
 )";
 
 //----------------------------------------------------------------------------------------------------------------------
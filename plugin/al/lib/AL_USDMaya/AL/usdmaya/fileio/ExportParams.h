@@ -66,6 +66,9 @@ struct ExporterParams
         = 0; ///< the animation translator to help exporting the animation data
     bool m_extensiveAnimationCheck
         = true; ///< if true, extensive animation check will be performed on transform nodes.
+    bool m_contextEvaluation
+        = false; ///< if true, the animation samples are evaluated in a DG context rather than by
+                 ///< changing the current time, so only the exported plugs are evaluated.
     int m_exportAtWhichTime = 0; ///< controls where the data will be written to: 0 = default time,
                                  ///< 1 = earliest time, 2 = current time
     UsdTimeCode m_timeCode = UsdTimeCode::Default();
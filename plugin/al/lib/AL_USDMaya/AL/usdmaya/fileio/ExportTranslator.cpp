@@ -60,6 +60,7 @@ MStatus ExportTranslator::writer(
     params.m_animation = options.getBool(kAnimation);
     params.m_exportAtWhichTime = options.getBool(kExportAtWhichTime);
     params.m_exportInWorldSpace = options.getBool(kExportInWorldSpace);
+    params.m_contextEvaluation = options.getBool(kContextEvaluation);
     params.m_subSamples = options.getInt(kSubSamples);
     params.m_parser = (maya::utils::OptionsParser*)&options;
     params.m_activateAllTranslators = options.getBool(kActivateAllTranslators);
@@ -75,6 +75,8 @@ static constexpr const char* const kExportAtWhichTime
     = "Export At Which Time"; ///< which time code should be used for default values?
 static constexpr const char* const kExportInWorldSpace
     = "Export In World Space"; ///< should selected transforms be output in world space?
+static constexpr const char* const kContextEvaluation
+    = "Context Evaluation"; ///< evaluate the animation samples without changing the current time
 static constexpr const char* const kActivateAllTranslators
     = "Activate all Plugin Translators"; ///< if true, all translator plugins will be enabled by
                                          ///< default
@@ -123,6 +125,8 @@ static MStatus specifyOptions(AL::maya::utils::FileTranslatorOptions& options)
         return MS::kFailure;
     if (!options.addBool(kExportInWorldSpace, defaultValues.m_exportInWorldSpace))
         return MS::kFailure;
+    if (!options.addBool(kContextEvaluation, defaultValues.m_contextEvaluation))
+        return MS::kFailure;
     if (!options.addBool(kActivateAllTranslators, true))
         return MS::kFailure;
     if (!options.addString(kActiveTranslatorList, ""))
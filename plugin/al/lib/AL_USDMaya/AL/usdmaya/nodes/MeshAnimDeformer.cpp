@@ -25,13 +25,175 @@
 
 #include <pxr/usd/usdGeom/mesh.h>
 
+#include <maya/MAnimControl.h>
+#include <maya/MConditionMessage.h>
 #include <maya/MFnMesh.h>
 #include <maya/MTime.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace AL {
 namespace usdmaya {
 namespace nodes {
 
+//----------------------------------------------------------------------------------------------------------------------
+MeshAnimPrefetcher::~MeshAnimPrefetcher()
+{
+    m_dispatcher.Wait();
+    TfNotice::Revoke(m_objectsChanged);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimPrefetcher::setPrim(
+    const UsdStageRefPtr& stage,
+    const SdfPath&        path,
+    uint32_t              windowSize)
+{
+    const bool stageChanged = get_pointer(stage) != get_pointer(m_stage);
+    if (!m_dirty && !stageChanged && path == m_path && windowSize == m_windowSize) {
+        return;
+    }
+
+    clear();
+
+    if (stageChanged) {
+        TfNotice::Revoke(m_objectsChanged);
+        if (stage) {
+            m_objectsChanged = TfNotice::Register(
+                TfCreateWeakPtr(this),
+                &MeshAnimPrefetcher::onObjectsChanged,
+                UsdStageWeakPtr(stage));
+        }
+    }
+
+    m_stage = stage;
+    m_path = path;
+    m_windowSize = windowSize;
+    m_frames.reset(windowSize ? new Frame[windowSize] : nullptr);
+
+    // Only the animated attributes are read, the others are left as they are in the input mesh.
+    UsdGeomMesh  mesh(stage ? stage->GetPrimAtPath(path) : UsdPrim());
+    UsdAttribute points = mesh ? mesh.GetPointsAttr() : UsdAttribute();
+    UsdAttribute normals = mesh ? mesh.GetNormalsAttr() : UsdAttribute();
+    m_points = points ? UsdAttributeQuery(points) : UsdAttributeQuery();
+    m_normals = normals ? UsdAttributeQuery(normals) : UsdAttributeQuery();
+    m_animatedPoints = m_points.IsValid() && m_points.GetNumTimeSamples() > 1;
+    m_animatedNormals = m_normals.IsValid() && m_normals.GetNumTimeSamples() > 1;
+    m_dirty = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimPrefetcher::wait() { m_dispatcher.Wait(); }
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimPrefetcher::clear()
+{
+    // The frames are all discarded, so the reads that did not start yet are not needed.
+    m_dispatcher.Cancel();
+    m_dispatcher.Wait();
+    for (uint32_t i = 0; i < m_windowSize; ++i) {
+        m_frames[i].state = kEmpty;
+        m_frames[i].points = VtArray<GfVec3f>();
+        m_frames[i].normals = VtArray<GfVec3f>();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MeshAnimPrefetcher::Frame& MeshAnimPrefetcher::frameAt(double time, double step)
+{
+    // Consecutive frames map to consecutive slots of the ring buffer.
+    const int64_t frameIndex = std::llround(time / std::abs(step));
+    const int64_t size = m_windowSize;
+    return m_frames[((frameIndex % size) + size) % size];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimPrefetcher::readFrame(
+    double            time,
+    VtArray<GfVec3f>& points,
+    VtArray<GfVec3f>& normals) const
+{
+    if (m_animatedPoints) {
+        m_points.Get(&points, time);
+    }
+    if (m_animatedNormals) {
+        m_normals.Get(&normals, time);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool MeshAnimPrefetcher::read(
+    UsdTimeCode       time,
+    VtArray<GfVec3f>& points,
+    VtArray<GfVec3f>& normals)
+{
+    if (m_windowSize) {
+        Frame& frame = frameAt(time.GetValue(), m_step);
+        if (frame.state.load(std::memory_order_acquire) == kReady
+            && frame.time == time.GetValue()) {
+            points = frame.points;
+            normals = frame.normals;
+            ++m_hits;
+            return true;
+        }
+    }
+
+    readFrame(time.GetValue(), points, normals);
+    ++m_misses;
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimPrefetcher::prefetch(double time, double step)
+{
+    if (!m_windowSize || (!m_animatedPoints && !m_animatedNormals) || step == 0) {
+        return;
+    }
+    m_step = step;
+
+    // The slot of the current frame is kept, the others receive the frames that follow it.
+    // Frames still being read are left alone, their slot will be reused on a later call.
+    for (uint32_t i = 1; i < m_windowSize; ++i) {
+        const double frameTime = time + i * step;
+        Frame&       frame = frameAt(frameTime, step);
+        const int    state = frame.state.load(std::memory_order_acquire);
+        if (state == kLoading || (state == kReady && frame.time == frameTime)) {
+            continue;
+        }
+
+        frame.time = frameTime;
+        frame.state.store(kLoading, std::memory_order_relaxed);
+        m_dispatcher.Run([this, &frame, frameTime]() {
+            readFrame(frameTime, frame.points, frame.normals);
+            frame.state.store(kReady, std::memory_order_release);
+        });
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimPrefetcher::onObjectsChanged(
+    const UsdNotice::ObjectsChanged& notice,
+    const UsdStageWeakPtr&)
+{
+    // Changes to the mesh prim, to its ancestors or to its properties may affect the attributes
+    // to read or their resolved values.
+    auto affectsMesh = [this](const UsdNotice::ObjectsChanged::PathRange& paths) {
+        for (const SdfPath& path : paths) {
+            const SdfPath primPath = path.GetPrimPath();
+            if (m_path.HasPrefix(primPath) || primPath.HasPrefix(m_path)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (affectsMesh(notice.GetResyncedPaths()) || affectsMesh(notice.GetChangedInfoOnlyPaths())) {
+        clear();
+        m_dirty = true;
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 AL_MAYA_DEFINE_NODE(MeshAnimDeformer, MTypeId(0x6969), AL_usdmaya);
 
@@ -41,6 +203,7 @@ MObject MeshAnimDeformer::m_inTime = MObject::kNullObj;
 MObject MeshAnimDeformer::m_inStageData = MObject::kNullObj;
 MObject MeshAnimDeformer::m_outMesh = MObject::kNullObj;
 MObject MeshAnimDeformer::m_inMesh = MObject::kNullObj;
+MObject MeshAnimDeformer::m_prefetchFrames = MObject::kNullObj;
 
 //----------------------------------------------------------------------------------------------------------------------
 MStatus MeshAnimDeformer::initialise()
@@ -61,6 +224,8 @@ MStatus MeshAnimDeformer::initialise()
             kWritable | kStorable | kConnectable);
         m_outMesh = addMeshAttr("outMesh", "out", kReadable | kStorable | kConnectable);
         m_inMesh = addMeshAttr("inMesh", "in", kWritable | kStorable | kConnectable);
+        m_prefetchFrames
+            = addInt32Attr("prefetchFrames", "pff", 0, kReadable | kWritable | kStorable);
         attributeAffects(m_primPath, m_outMesh);
         attributeAffects(m_inTime, m_outMesh);
         attributeAffects(m_inStageData, m_outMesh);
@@ -93,30 +258,40 @@ MStatus MeshAnimDeformer::compute(const MPlug& plug, MDataBlock& data)
 
     UsdStageRefPtr stage = getStage();
     if (stage) {
-        UsdPrim     prim = stage->GetPrimAtPath(m_cachePath);
-        UsdGeomMesh mesh(prim);
+        const int32_t prefetchFrames = inputInt32Value(data, m_prefetchFrames);
+        m_prefetcher.setPrim(stage, m_cachePath, std::max(prefetchFrames, 0));
+
+        VtArray<GfVec3f> pointData;
+        VtArray<GfVec3f> normalData;
+        const bool       hit = m_prefetcher.read(usdTime, pointData, normalData);
+
+        // Keep reading ahead in the direction of the playback. The frames are only prefetched
+        // during playback, since the stage cannot be edited while it is being played.
+        if (MAnimControl::isPlaying()) {
+            const double step = inTimeVal.value() - m_lastTime;
+            m_prefetcher.prefetch(
+                inTimeVal.value(), (step != 0 && std::abs(step) < prefetchFrames) ? step : 1.0);
+        }
+        m_lastTime = inTimeVal.value();
+
+        TF_DEBUG(ALUSDMAYA_GEOMETRY_DEFORMER)
+            .Msg(
+                "MeshAnimDeformer::compute prefetch %s, %zu hits, %zu misses\n",
+                hit ? "hit" : "miss",
+                m_prefetcher.hits(),
+                m_prefetcher.misses());
 
         MFnMesh      fnMesh(obj);
         float* const ptr = (float*)fnMesh.getRawPoints(&status);
-        if (ptr) {
-            UsdAttribute points = mesh.GetPointsAttr();
-            if (points.GetNumTimeSamples() > 1) {
-                VtArray<GfVec3f> pointData;
-                points.Get(&pointData, usdTime);
-                const size_t numPoints = pointData.size();
-                std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * numPoints);
-            }
+        if (ptr && !pointData.empty()) {
+            const size_t numPoints = std::min<size_t>(pointData.size(), fnMesh.numVertices());
+            std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * numPoints);
         }
 
         float* const nptr = (float*)fnMesh.getRawNormals(&status);
-        if (nptr) {
-            UsdAttribute normals = mesh.GetNormalsAttr();
-            if (normals.GetNumTimeSamples() > 1) {
-                VtArray<GfVec3f> normalData;
-                normals.Get(&normalData, usdTime);
-                const size_t numNormals = normalData.size();
-                std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * numNormals);
-            }
+        if (nptr && !normalData.empty()) {
+            const size_t numNormals = std::min<size_t>(normalData.size(), fnMesh.numNormals());
+            std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * numNormals);
         }
         outputHandle.set(obj);
     }
@@ -169,6 +344,18 @@ void MeshAnimDeformer::postConstructor()
     auto obj = thisMObject();
     m_attributeChanged
         = MNodeMessage::addAttributeChangedCallback(obj, onAttributeChanged, (void*)this);
+    m_playingBackChanged
+        = MConditionMessage::addConditionCallback("playingBack", onPlayingBackChanged, this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimDeformer::onPlayingBackChanged(bool playingBack, void* clientData)
+{
+    // Stop reading the stage before the user gets a chance to edit it.
+    if (!playingBack) {
+        MeshAnimDeformer* deformer = (MeshAnimDeformer*)clientData;
+        deformer->m_prefetcher.clear();
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
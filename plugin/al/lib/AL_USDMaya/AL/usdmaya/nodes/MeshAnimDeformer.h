@@ -17,18 +17,114 @@
 #include "AL/maya/utils/MayaHelperMacros.h"
 #include "AL/maya/utils/NodeHelper.h"
 
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/stage.h>
 
+#include <maya/MMessage.h>
 #include <maya/MNodeMessage.h>
 #include <maya/MObjectHandle.h>
 #include <maya/MPxNode.h>
 
+#include <atomic>
+#include <memory>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
 namespace usdmaya {
 namespace nodes {
 
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief   Reads the animated points and normals of a mesh prim for the frames following the
+///          current one on worker threads, into a ring buffer of frames, so that playback only
+///          copies ready memory.
+/// \note    The values are read while the main thread carries on, so the stage must not be
+///          edited while frames are being prefetched. The deformer only prefetches frames during
+///          playback, and discards them when playback stops. The prefetched frames are also
+///          discarded whenever the stage changes.
+/// \ingroup nodes
+//----------------------------------------------------------------------------------------------------------------------
+class MeshAnimPrefetcher : public TfWeakBase
+{
+public:
+    /// \brief  dtor, waits for the frames being prefetched
+    ~MeshAnimPrefetcher();
+
+    /// \brief  sets the mesh prim to read, and the number of frames held in the ring buffer. A
+    ///         window size of zero disables the prefetching. Does nothing if neither changed
+    ///         since the previous call.
+    /// \param  stage the stage of the mesh prim
+    /// \param  path the path of the mesh prim
+    /// \param  windowSize the number of frames held in the ring buffer
+    void setPrim(const UsdStageRefPtr& stage, const SdfPath& path, uint32_t windowSize);
+
+    /// \brief  returns the points and normals of the mesh at the given time. Attributes that are
+    ///         not animated are returned empty.
+    /// \param  time the time to read
+    /// \param  points the returned points
+    /// \param  normals the returned normals
+    /// \return true if the frame had been prefetched
+    bool read(UsdTimeCode time, VtArray<GfVec3f>& points, VtArray<GfVec3f>& normals);
+
+    /// \brief  starts reading the frames that follow the given time on worker threads
+    /// \param  time the current time
+    /// \param  step the time between two frames, negative when playing backwards
+    void prefetch(double time, double step);
+
+    /// \brief  waits for the frames being prefetched
+    void wait();
+
+    /// \brief  cancels the frames not being read yet, waits for the others and discards all the
+    ///         prefetched frames
+    void clear();
+
+    /// \brief  the number of reads served from the prefetched frames
+    size_t hits() const { return m_hits; }
+
+    /// \brief  the number of reads that had to be done on the calling thread
+    size_t misses() const { return m_misses; }
+
+private:
+    enum FrameState
+    {
+        kEmpty,
+        kLoading,
+        kReady
+    };
+
+    struct Frame
+    {
+        std::atomic<int> state { kEmpty };
+        double           time = 0;
+        VtArray<GfVec3f> points;
+        VtArray<GfVec3f> normals;
+    };
+
+    Frame& frameAt(double time, double step);
+    void   readFrame(double time, VtArray<GfVec3f>& points, VtArray<GfVec3f>& normals) const;
+    void   onObjectsChanged(const UsdNotice::ObjectsChanged&, const UsdStageWeakPtr&);
+
+    UsdStageWeakPtr          m_stage;
+    SdfPath                  m_path;
+    UsdAttributeQuery        m_points;
+    UsdAttributeQuery        m_normals;
+    bool                     m_animatedPoints = false;
+    bool                     m_animatedNormals = false;
+    bool                     m_dirty = true;
+    std::unique_ptr<Frame[]> m_frames;
+    uint32_t                 m_windowSize = 0;
+    double                   m_step = 1.0;
+    TfNotice::Key            m_objectsChanged;
+    WorkDispatcher           m_dispatcher;
+    size_t                   m_hits = 0;
+    size_t                   m_misses = 0;
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 /// \brief   This node is a simple deformer that modifies
 /// \ingroup nodes
@@ -45,7 +141,11 @@ public:
     {
     }
 
-    inline ~MeshAnimDeformer() { MNodeMessage::removeCallback(m_attributeChanged); }
+    inline ~MeshAnimDeformer()
+    {
+        MNodeMessage::removeCallback(m_attributeChanged);
+        MMessage::removeCallback(m_playingBackChanged);
+    }
 
     //--------------------------------------------------------------------------------------------------------------------
     /// Type Info & Registration
@@ -61,19 +161,24 @@ public:
     AL_DECL_ATTRIBUTE(inStageData);
     AL_DECL_ATTRIBUTE(inMesh);
     AL_DECL_ATTRIBUTE(outMesh);
+    AL_DECL_ATTRIBUTE(prefetchFrames);
 
 private:
     void           postConstructor() override;
     MStatus        connectionMade(const MPlug& plug, const MPlug& otherPlug, bool asSrc) override;
     MStatus        connectionBroken(const MPlug& plug, const MPlug& otherPlug, bool asSrc) override;
     static void    onAttributeChanged(MNodeMessage::AttributeMessage, MPlug&, MPlug&, void*);
+    static void    onPlayingBackChanged(bool playingBack, void* clientData);
     MStatus        compute(const MPlug& plug, MDataBlock& data) override;
     UsdStageRefPtr getStage();
 
 private:
-    SdfPath       m_cachePath;
-    MObjectHandle proxyShapeHandle;
-    MCallbackId   m_attributeChanged = 0;
+    SdfPath            m_cachePath;
+    MObjectHandle      proxyShapeHandle;
+    MCallbackId        m_attributeChanged = 0;
+    MCallbackId        m_playingBackChanged = 0;
+    MeshAnimPrefetcher m_prefetcher;
+    double             m_lastTime = 0;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,95 @@
+#include "test_usdmaya.h"
+
+#include <pxr/usd/usdGeom/mesh.h>
+
+#include <maya/MAnimControl.h>
+#include <maya/MFileIO.h>
+#include <maya/MGlobal.h>
+
+using AL::maya::test::buildTempPath;
+
+static const char* const g_animated = R"(
+{
+polyCylinder -r 1 -h 4 -sx 20 -sy 20 -sz 1 -ax 0 1 0 -rcp 0 -cuv 3 -ch 1;
+$nl = `nonLinear -type bend  -lowBound -1 -highBound 1 -curvature 0`;
+currentTime 1;
+setKeyframe ($nl[0] + ".cur");
+setKeyframe -v 0 -at "translateX" "pCylinder1";
+currentTime 20;
+setAttr ($nl[0] + ".cur") 25;
+setKeyframe ($nl[0] + ".cur");
+setKeyframe -v 10 -at "translateX" "pCylinder1";
+currentTime 1;
+}
+)";
+
+static UsdStageRefPtr exportAnimation(const char* const fileName, bool contextEvaluation)
+{
+    const std::string temp_path = buildTempPath(fileName);
+
+    MString command = "select -r \"pCylinder1\";"
+                      "file -force -options "
+                      "\"Dynamic_Attributes=1;"
+                      "Meshes=1;"
+                      "Nurbs_Curves=1;"
+                      "Duplicate_Instances=1;"
+                      "Merge_Transforms=1;"
+                      "Animation=1;"
+                      "Use_Timeline_Range=0;"
+                      "Frame_Min=1;"
+                      "Frame_Max=20;"
+                      "Filter_Sample=0;"
+                      "Context_Evaluation=";
+    command += contextEvaluation ? "1" : "0";
+    command += ";\" -typ \"AL usdmaya export\" -pr -es \"";
+    command += temp_path.c_str();
+    command += "\";";
+
+    MGlobal::executeCommand(command);
+
+    return UsdStage::Open(temp_path);
+}
+
+TEST(export_context_evaluation, sameSamplesAsTimeChanges)
+{
+    MFileIO::newFile(true);
+    MGlobal::executeCommand(g_animated);
+
+    UsdStageRefPtr timeStage
+        = exportAnimation("AL_USDMayaTests_contextEvaluationOff.usda", false);
+    ASSERT_TRUE(timeStage);
+
+    MAnimControl::setCurrentTime(MTime(1.0));
+    UsdStageRefPtr contextStage
+        = exportAnimation("AL_USDMayaTests_contextEvaluationOn.usda", true);
+    ASSERT_TRUE(contextStage);
+
+    // The samples are evaluated without changing the current time.
+    EXPECT_EQ(MTime(1.0), MAnimControl::currentTime());
+
+    UsdPrim timePrim = timeStage->GetPrimAtPath(SdfPath("/pCylinder1"));
+    UsdPrim contextPrim = contextStage->GetPrimAtPath(SdfPath("/pCylinder1"));
+    ASSERT_TRUE(timePrim);
+    ASSERT_TRUE(contextPrim);
+
+    EXPECT_EQ(20u, UsdGeomMesh(timePrim).GetPointsAttr().GetNumTimeSamples());
+
+    for (const UsdAttribute& timeAttr : timePrim.GetAttributes()) {
+        UsdAttribute contextAttr = contextPrim.GetAttribute(timeAttr.GetName());
+        ASSERT_TRUE(contextAttr) << timeAttr.GetName().GetString();
+
+        std::vector<double> times;
+        std::vector<double> contextTimes;
+        timeAttr.GetTimeSamples(&times);
+        contextAttr.GetTimeSamples(&contextTimes);
+        EXPECT_EQ(times, contextTimes) << timeAttr.GetName().GetString();
+
+        for (double time : times) {
+            VtValue value;
+            VtValue contextValue;
+            timeAttr.Get(&value, time);
+            contextAttr.Get(&contextValue, time);
+            EXPECT_EQ(value, contextValue) << timeAttr.GetName().GetString() << " at " << time;
+        }
+    }
+}
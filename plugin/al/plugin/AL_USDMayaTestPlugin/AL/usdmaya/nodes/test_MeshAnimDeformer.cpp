@@ -0,0 +1,108 @@
+//
+// Copyright 2026 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AL/usdmaya/nodes/MeshAnimDeformer.h"
+#include "test_usdmaya.h"
+
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+using AL::usdmaya::nodes::MeshAnimPrefetcher;
+
+namespace {
+// Creates a mesh whose single point is at (t, 0, 0) at each frame t in [1, 10].
+UsdStageRefPtr createAnimatedMesh(const SdfPath& path)
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdGeomMesh    mesh = UsdGeomMesh::Define(stage, path);
+    UsdAttribute   points = mesh.GetPointsAttr();
+    for (int t = 1; t <= 10; ++t) {
+        points.Set(VtArray<GfVec3f>(1, GfVec3f(t, 0, 0)), UsdTimeCode(t));
+    }
+    return stage;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+// Check that the prefetched frames are served from the ring buffer, and that the other frames
+// are read on the calling thread.
+TEST(MeshAnimPrefetcher, hitsAndMisses)
+{
+    const SdfPath  path("/mesh");
+    UsdStageRefPtr stage = createAnimatedMesh(path);
+
+    MeshAnimPrefetcher prefetcher;
+    prefetcher.setPrim(stage, path, 4);
+
+    VtArray<GfVec3f> points, normals;
+    EXPECT_FALSE(prefetcher.read(UsdTimeCode(1), points, normals));
+    ASSERT_EQ(1u, points.size());
+    EXPECT_EQ(GfVec3f(1, 0, 0), points[0]);
+    EXPECT_TRUE(normals.empty());
+
+    // The three frames that follow are prefetched.
+    prefetcher.prefetch(1, 1);
+    prefetcher.wait();
+    for (int t = 2; t <= 4; ++t) {
+        EXPECT_TRUE(prefetcher.read(UsdTimeCode(t), points, normals));
+        ASSERT_EQ(1u, points.size());
+        EXPECT_EQ(GfVec3f(t, 0, 0), points[0]);
+    }
+
+    // Beyond the window.
+    EXPECT_FALSE(prefetcher.read(UsdTimeCode(5), points, normals));
+    ASSERT_EQ(1u, points.size());
+    EXPECT_EQ(GfVec3f(5, 0, 0), points[0]);
+
+    EXPECT_EQ(3u, prefetcher.hits());
+    EXPECT_EQ(2u, prefetcher.misses());
+
+    // Playing backwards.
+    prefetcher.prefetch(8, -1);
+    prefetcher.wait();
+    EXPECT_TRUE(prefetcher.read(UsdTimeCode(6), points, normals));
+    ASSERT_EQ(1u, points.size());
+    EXPECT_EQ(GfVec3f(6, 0, 0), points[0]);
+    EXPECT_EQ(4u, prefetcher.hits());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Check that the prefetched frames are discarded when they are cleared or the mesh is edited.
+TEST(MeshAnimPrefetcher, discardedFrames)
+{
+    const SdfPath  path("/mesh");
+    UsdStageRefPtr stage = createAnimatedMesh(path);
+
+    MeshAnimPrefetcher prefetcher;
+    prefetcher.setPrim(stage, path, 4);
+
+    VtArray<GfVec3f> points, normals;
+    prefetcher.prefetch(1, 1);
+    prefetcher.clear();
+    EXPECT_FALSE(prefetcher.read(UsdTimeCode(2), points, normals));
+
+    prefetcher.prefetch(1, 1);
+    prefetcher.wait();
+    UsdGeomMesh(stage->GetPrimAtPath(path))
+        .GetPointsAttr()
+        .Set(VtArray<GfVec3f>(1, GfVec3f(0, 3, 0)), UsdTimeCode(3));
+    prefetcher.setPrim(stage, path, 4);
+    EXPECT_FALSE(prefetcher.read(UsdTimeCode(3), points, normals));
+    ASSERT_EQ(1u, points.size());
+    EXPECT_EQ(GfVec3f(0, 3, 0), points[0]);
+
+    EXPECT_EQ(0u, prefetcher.hits());
+    EXPECT_EQ(2u, prefetcher.misses());
+}
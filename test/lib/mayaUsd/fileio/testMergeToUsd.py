@@ -769,6 +769,62 @@ class MergeToUsdTestCase(unittest.TestCase):
             mergeAndVerify(editedAsMaya, mergeOnly=["some_missing_node"])
 
 
+    def testMergeOnlyEditedNodes(self):
+        '''Merge back to USD only the nodes edited since they were edited as Maya.'''
+
+        # Create a stage with a root xform edited as maya, with two child xforms.
+        def createEditedAsMayaScene():
+            psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+            stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+            stage.DefinePrim("/A", "Xform")
+            for name in ["B", "C"]:
+                xform = UsdGeom.Xform.Define(stage, "/A/" + name)
+                UsdGeom.XformCommonAPI(xform).SetTranslate((1, 2, 3))
+
+            cmds.mayaUsdEditAsMaya(psPathStr + ",/A")
+            editedMayaItem = ufe.GlobalSelection.get().front()
+            editedMayaPath = ufe.PathString.string(editedMayaItem.path())
+            children = cmds.listRelatives(editedMayaPath, children=True, fullPath=True)
+            childB = [child for child in children if child.endswith("|B")][0]
+
+            return stage, editedMayaPath, childB
+
+        def getTranslate(stage, primPath):
+            xformCommon = UsdGeom.XformCommonAPI(stage.GetPrimAtPath(primPath))
+            return xformCommon.GetXformVectors(Usd.TimeCode.Default())[0]
+
+        # Edit only B in Maya. Only B is exported, and C keeps its USD data,
+        # which is what exporting C again would author.
+        stage, editedAsMaya, childB = createEditedAsMayaScene()
+        cmds.setAttr(childB + ".translate", 4, 5, 6, type="double3")
+
+        cmds.mayaUsdMergeToUsd(editedAsMaya)
+        assertVectorAlmostEqual(self, getTranslate(stage, "/A/B"), [4, 5, 6])
+        assertVectorAlmostEqual(self, getTranslate(stage, "/A/C"), [1, 2, 3])
+
+        # Edit B in Maya and C directly in USD. Skipping C would keep its USD
+        # edit, so the whole hierarchy is exported and the Maya data of C
+        # replaces the USD edit, as when merging without edit tracking.
+        stage, editedAsMaya, childB = createEditedAsMayaScene()
+        cmds.setAttr(childB + ".translate", 4, 5, 6, type="double3")
+        UsdGeom.XformCommonAPI(stage.GetPrimAtPath("/A/C")).SetTranslate((7, 8, 9))
+
+        cmds.mayaUsdMergeToUsd(editedAsMaya)
+        assertVectorAlmostEqual(self, getTranslate(stage, "/A/B"), [4, 5, 6])
+        assertVectorAlmostEqual(self, getTranslate(stage, "/A/C"), [1, 2, 3])
+
+        # Adding a node changes the edited hierarchy topology, so the whole
+        # hierarchy is exported again, and the same applies to C.
+        stage, editedAsMaya, childB = createEditedAsMayaScene()
+        cmds.setAttr(childB + ".translate", 4, 5, 6, type="double3")
+        cmds.group(empty=True, parent=editedAsMaya, name="D")
+        UsdGeom.XformCommonAPI(stage.GetPrimAtPath("/A/C")).SetTranslate((7, 8, 9))
+
+        cmds.mayaUsdMergeToUsd(editedAsMaya)
+        assertVectorAlmostEqual(self, getTranslate(stage, "/A/B"), [4, 5, 6])
+        assertVectorAlmostEqual(self, getTranslate(stage, "/A/C"), [1, 2, 3])
+        self.assertTrue(stage.GetPrimAtPath("/A/D"))
+
     def testMergeInSubVariant(self):
         '''Merge edits on data that is inside a variant of a parent prim and contains variants.'''
 
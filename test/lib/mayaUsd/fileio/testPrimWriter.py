@@ -90,14 +90,17 @@ def getJobArgsProperties():
         "rootPrimType",
         "upAxis",
         "unit",
+        "parallelFrameExport",
         "pythonPerFrameCallback",
         "pythonPostCallback",
         "renderLayerMode",
         "rootKind",
         "disableModelKindProcessor",
+        "contextEvaluation",
         "rootMapFunction",
         "shadingMode",
         "staticSingleSample",
+        "streamingFrameWindow",
         "stripNamespaces",
         "worldspace",
         "timeSamples",
@@ -331,6 +331,51 @@ class testLayerManagerSerialization(unittest.TestCase):
 
         shutil.rmtree(self._currentTestDir)
 
+    def testAnonymousRootToMayaAsBinary(self):
+        '''Verify that USD edits saved to Maya as usdc, compressed or not, are restored.'''
+        for serializedFormat in [2, 3]:
+            self.setupEmptyScene()
+
+            import mayaUsd_createStageWithNewLayer
+            proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+            proxyShapePath = ufe.PathString.path(proxyShape)
+
+            stage = mayaUsd.ufe.getStage(ufe.PathString.string(proxyShapePath))
+
+            newPrimPath = "/ChangeInRoot"
+            stage.DefinePrim(newPrimPath, "xform")
+
+            stage.SetEditTarget(stage.GetSessionLayer())
+            newSessionsPrimPath = "/ChangeInSession"
+            prim = stage.DefinePrim(newSessionsPrimPath, "xform")
+            attr = prim.CreateAttribute("samples", Sdf.ValueTypeNames.Float)
+            for time in range(10):
+                attr.Set(float(time) * 0.5, time)
+
+            cmds.optionVar(intValue=(mayaUsdLib.OptionVarTokens.SerializedUsdEditsLocation, 2))
+            cmds.optionVar(intValue=(mayaUsdLib.OptionVarTokens.SerializedUsdEditsFormat, serializedFormat))
+
+            cmds.file(save=True, force=True, type='mayaAscii')
+            cmds.file(new=True, force=True)
+
+            # The layers are not saved as usda text.
+            with open(self._tempMayaFile) as mayaFile:
+                self.assertFalse('#usda' in mayaFile.read())
+
+            cmds.file(self._tempMayaFile, open=True)
+
+            stage = mayaUsd.ufe.getStage('|stage1|stageShape1')
+            self.assertTrue(stage.GetPrimAtPath(newPrimPath).IsValid())
+            prim = stage.GetPrimAtPath(newSessionsPrimPath)
+            self.assertTrue(prim.IsValid())
+            attr = prim.GetAttribute("samples")
+            self.assertEqual(attr.GetTimeSamples(), [float(time) for time in range(10)])
+            self.assertEqual(attr.Get(4), 2.0)
+
+            cmds.optionVar(intValue=(mayaUsdLib.OptionVarTokens.SerializedUsdEditsFormat, 1))
+            cmds.file(new=True, force=True)
+            shutil.rmtree(self._currentTestDir)
+
     def testAnonymousRootToUsd(self):
         '''Test saving USD to separate files (the session layer is still in the Maya scene)'''
         self.setupEmptyScene()
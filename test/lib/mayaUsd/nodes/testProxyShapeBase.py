@@ -68,6 +68,65 @@ class testProxyShapeBase(unittest.TestCase):
         bboxSize = cmds.getAttr('Cube_usd.boundingBoxSize')[0]
         self.assertEqual(bboxSize, (1.0, 1.0, 1.0))
 
+    def testBoundingBoxUpdates(self):
+        '''
+        Verify that the cached bounds of the proxy shape follow the changes to the stage,
+        including animated prims.
+        '''
+        self.setupEmptyScene()
+
+        shapePath = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(shapePath).GetStage()
+
+        def defineCube(path, translate):
+            cube = UsdGeom.Cube.Define(stage, path)
+            cube.CreateExtentAttr([(-1, -1, -1), (1, 1, 1)])
+            cube.AddTranslateOp().Set(translate)
+            return cube
+
+        UsdGeom.Xform.Define(stage, '/Group')
+        defineCube('/Group/A', (0, 0, 0))
+        cubeB = defineCube('/Group/B', (4, 0, 0))
+
+        def getBoundingBox():
+            return (cmds.getAttr(shapePath + '.boundingBoxMin')[0],
+                    cmds.getAttr(shapePath + '.boundingBoxMax')[0])
+
+        self.assertEqual(getBoundingBox(), ((-1, -1, -1), (5, 1, 1)))
+
+        # Moving one cube only affects its own bounds, but must update the stage bounds.
+        translateOp = cubeB.GetOrderedXformOps()[0]
+        translateOp.Set((0, 6, 0))
+        self.assertEqual(getBoundingBox(), ((-1, -1, -1), (1, 7, 1)))
+
+        # Hiding a prim removes it from the bounds.
+        cubeB.MakeInvisible()
+        self.assertEqual(getBoundingBox(), ((-1, -1, -1), (1, 1, 1)))
+        cubeB.MakeVisible()
+
+        # Adding a prim to an existing group.
+        defineCube('/Group/C', (0, 0, -8))
+        self.assertEqual(getBoundingBox(), ((-1, -1, -9), (1, 7, 1)))
+
+        # Animated prims get their bounds evaluated at each frame.
+        stage.RemovePrim('/Group/C')
+        translateOp.GetAttr().Clear()
+        translateOp.Set((2, 0, 0), 1)
+        translateOp.Set((10, 0, 0), 2)
+
+        cmds.currentTime(1)
+        self.assertEqual(getBoundingBox(), ((-1, -1, -1), (3, 1, 1)))
+        cmds.currentTime(2)
+        self.assertEqual(getBoundingBox(), ((-1, -1, -1), (11, 1, 1)))
+        cmds.currentTime(1)
+        self.assertEqual(getBoundingBox(), ((-1, -1, -1), (3, 1, 1)))
+
+        # Like UsdGeomImageable.ComputeWorldBound, authored extents hints are not trusted.
+        groupPrim = stage.GetPrimAtPath('/Group')
+        Usd.ModelAPI(groupPrim).SetKind('component')
+        UsdGeom.ModelAPI(groupPrim).SetExtentsHint([(-100, -100, -100), (100, 100, 100)])
+        self.assertEqual(getBoundingBox(), ((-1, -1, -1), (3, 1, 1)))
+
     def testDuplicateProxyStageAnonymous(self):
         '''
         Verify stage with new anonymous layer is duplicated properly.
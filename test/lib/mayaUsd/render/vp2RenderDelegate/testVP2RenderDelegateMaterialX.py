@@ -26,7 +26,7 @@ from mayaUsd import ufe as mayaUsdUfe
 
 from maya import cmds
 
-from pxr import Usd
+from pxr import Gf, Sdf, Usd, UsdGeom, UsdShade
 
 import ufe
 
@@ -251,6 +251,64 @@ class testVP2RenderDelegateMaterialX(imageUtils.ImageDiffingTestCase):
         cmds.setAttr("hardwareRenderingGlobals.multiSampleEnable", True)
 
 
+    def _AddStandardSurfaceQuad(self, stage, index, inputs):
+        """Add a quad bound to a standard_surface material with the given float inputs."""
+        materialPath = '/Material%d' % index
+        material = UsdShade.Material.Define(stage, materialPath)
+        shader = UsdShade.Shader.Define(stage, materialPath + '/Surface')
+        shader.CreateIdAttr('ND_standard_surface_surfaceshader')
+        shader.CreateInput('base_color', Sdf.ValueTypeNames.Color3f).Set(Gf.Vec3f(0.8, 0.2, 0.1))
+        for name, value in inputs.items():
+            shader.CreateInput(name, Sdf.ValueTypeNames.Float).Set(value)
+        surfaceOutput = shader.CreateOutput('out', Sdf.ValueTypeNames.Token)
+        material.CreateSurfaceOutput('mtlx').ConnectToSource(surfaceOutput)
+
+        quad = UsdGeom.Mesh.Define(stage, '/Quad%d' % index)
+        x = (index - 1.5) * 2.5
+        quad.CreatePointsAttr([(x - 1, -1, 0), (x + 1, -1, 0), (x + 1, 1, 0), (x - 1, 1, 0)])
+        quad.CreateFaceVertexCountsAttr([4])
+        quad.CreateFaceVertexIndicesAttr([0, 1, 2, 3])
+        UsdShade.MaterialBindingAPI.Apply(quad.GetPrim()).Bind(material)
+
+    @unittest.skipIf(getMaterialXVersion() < [1, 38, 8], 'Lobe pruning requires MaterialX 1.38.8 or later.')
+    def testConcurrentLobePrunedMaterials(self):
+        """Materials whose standard_surface lobes are pruned differently, and that are synced in
+           the same frame, must render the same as when they are synced one at a time."""
+        lobeSets = [
+            {'coat': 1.0, 'transmission': 0.0},
+            {'coat': 0.0, 'metalness': 1.0},
+            {'specular': 0.0, 'sheen': 1.0},
+        ]
+
+        def renderQuads(oneAtATime):
+            cmds.file(force=True, new=True)
+            mayaUtils.loadPlugin("mayaUsdPlugin")
+            panel = mayaUtils.activeModelPanel()
+            cmds.modelEditor(panel, edit=True, displayTextures=True)
+            mayaUtils.setBasicCamera(10)
+
+            shapeNode, stage = mayaUtils.createProxyAndStage()
+
+            # A first material creates the MaterialX library used by the following ones.
+            self._AddStandardSurfaceQuad(stage, 0, {})
+            cmds.refresh(force=True)
+
+            if oneAtATime:
+                for i, inputs in enumerate(lobeSets):
+                    self._AddStandardSurfaceQuad(stage, i + 1, inputs)
+                    cmds.refresh(force=True)
+            else:
+                with Sdf.ChangeBlock():
+                    for i, inputs in enumerate(lobeSets):
+                        self._AddStandardSurfaceQuad(stage, i + 1, inputs)
+
+            imageName = 'lobePrunedMaterials_%s.png' % ('sync' if oneAtATime else 'concurrent')
+            imagePath = os.path.join(self._testDir, imageName)
+            imageUtils.snapshot(imagePath, width=960, height=540)
+            return imagePath
+
+        self.assertImagesClose(renderQuads(True), renderQuads(False))
+
     def testWithEnabledMaterialX(self):
         """Make sure the absence of MAYAUSD_VP2_USE_ONLY_PREVIEWSURFACE env var has an effect."""
         cmds.file(force=True, new=True)
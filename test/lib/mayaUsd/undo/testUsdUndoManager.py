@@ -148,6 +148,70 @@ class TestUsdUndoManager(unittest.TestCase):
         # check number of children under the root
         self.assertEqual(len(defaultPrim.GetChildren()), 1)
 
+    def testCoalescedEdits(self):
+        '''
+            Test that repeated edits within an undo block only keep the first prior value.
+        '''
+        # start with a new file
+        cmds.file(force=True, new=True)
+
+        prim = self.stage.DefinePrim('/World', 'Sphere')
+        radiusAttr = UsdGeom.Sphere(prim).GetRadiusAttr()
+        radiusAttr.Set(1.0)
+        extentAttr = UsdGeom.Sphere(prim).GetExtentAttr()
+
+        undoItem = mayaUsdLib.UsdUndoableItem()
+        with mayaUsdLib.UsdUndoBlock(undoItem):
+            for i in range(100):
+                radiusAttr.Set(2.0 + i)
+                radiusAttr.Set(float(i), Usd.TimeCode(i % 10))
+                extentAttr.Set([Gf.Vec3f(-i), Gf.Vec3f(i)])
+
+        # the value edits are coalesced, only the creation of the extent
+        # attribute adds a few more edits.
+        self.assertLessEqual(undoItem.getEditCount(), 10)
+        self.assertGreater(undoItem.getByteSize(), 0)
+
+        self.assertEqual(radiusAttr.Get(), 101.0)
+        self.assertEqual(radiusAttr.GetNumTimeSamples(), 10)
+
+        undoItem.undo()
+
+        self.assertEqual(radiusAttr.Get(), 1.0)
+        self.assertEqual(radiusAttr.GetNumTimeSamples(), 0)
+        self.assertFalse(extentAttr.HasAuthoredValue())
+
+        undoItem.redo()
+
+        self.assertEqual(radiusAttr.Get(), 101.0)
+        self.assertEqual(radiusAttr.Get(Usd.TimeCode(9)), 99.0)
+        self.assertEqual(list(extentAttr.Get()), [Gf.Vec3f(-99), Gf.Vec3f(99)])
+
+    def testMemoryLimit(self):
+        '''
+            Test that an undo block exceeding the memory limit is reported.
+        '''
+        # start with a new file
+        cmds.file(force=True, new=True)
+
+        prim = self.stage.DefinePrim('/World', 'Mesh')
+        pointsAttr = UsdGeom.Mesh(prim).GetPointsAttr()
+        pointsAttr.Set([Gf.Vec3f(i) for i in range(1000)])
+
+        previousLimit = mayaUsdLib.UsdUndoManager.getMemoryLimit()
+        mayaUsdLib.UsdUndoManager.setMemoryLimit(1024)
+        try:
+            undoItem = mayaUsdLib.UsdUndoableItem()
+            with mayaUsdLib.UsdUndoBlock(undoItem):
+                pointsAttr.Set([Gf.Vec3f(0)])
+        finally:
+            mayaUsdLib.UsdUndoManager.setMemoryLimit(previousLimit)
+
+        # the prior points are still recorded, so the edit can be undone.
+        self.assertGreaterEqual(undoItem.getByteSize(), 1000 * 12)
+        undoItem.undo()
+        self.assertEqual(len(pointsAttr.Get()), 1000)
+
     def testRemovePrims(self):
         '''
             Test delete prims
@@ -1,9 +1,63 @@
 #include <usdUfe/utils/loadRules.h>
 
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/payloads.h>
+#include <pxr/usd/usd/prim.h>
+
 #include <gtest/gtest.h>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
+namespace {
+
+// Creates a stage with the prims /a, /a/b and /c, each with a payload holding a child prim.
+UsdStageRefPtr createStageWithPayloads(SdfLayerRefPtr& payloadLayer)
+{
+    payloadLayer = SdfLayer::CreateAnonymous();
+    auto payloadStage = UsdStage::Open(payloadLayer);
+    payloadStage->DefinePrim(SdfPath("/Payload/Child"));
+
+    auto stage = UsdStage::CreateInMemory();
+    for (const char* path : { "/a", "/a/b", "/c" }) {
+        UsdPrim prim = stage->DefinePrim(SdfPath(path));
+        prim.GetPayloads().AddPayload(payloadLayer->GetIdentifier(), SdfPath("/Payload"));
+    }
+    return stage;
+}
+
+// Records the prims resynced by each ObjectsChanged notice of a stage.
+class ResyncRecorder : public TfWeakBase
+{
+public:
+    explicit ResyncRecorder(const UsdStageRefPtr& stage)
+    {
+        _key = TfNotice::Register(
+            TfCreateWeakPtr(this), &ResyncRecorder::_onObjectsChanged, UsdStageWeakPtr(stage));
+    }
+
+    ~ResyncRecorder() { TfNotice::Revoke(_key); }
+
+    // The resynced paths of each notice that resynced prims.
+    std::vector<SdfPathVector> resyncs;
+
+private:
+    void _onObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr&)
+    {
+        SdfPathVector paths;
+        for (const SdfPath& path : notice.GetResyncedPaths())
+            paths.push_back(path);
+        if (!paths.empty())
+            resyncs.push_back(paths);
+    }
+
+    TfNotice::Key _key;
+};
+
+} // namespace
+
 TEST(ConvertLoadRules, convertEmptyLoadRules)
 {
     UsdStageLoadRules originalLoadRules;
@@ -58,3 +112,120 @@ TEST(ConvertLoadRules, convertSimpleStageLoadRules)
 
     EXPECT_EQ(originalStage->GetLoadRules(), convertedStage->GetLoadRules());
 }
+
+TEST(LoadRulesTransaction, nestedTransactions)
+{
+    SdfLayerRefPtr payloadLayer;
+    auto           stage = createStageWithPayloads(payloadLayer);
+    ResyncRecorder recorder(stage);
+
+    EXPECT_FALSE(UsdUfe::LoadRulesTransaction::isActive(*stage));
+    {
+        UsdUfe::LoadRulesTransaction outer(stage);
+        EXPECT_TRUE(UsdUfe::LoadRulesTransaction::isActive(*stage));
+        {
+            UsdUfe::LoadRulesTransaction inner(stage);
+            UsdUfe::unloadPayload(*stage, SdfPath("/a"));
+        }
+
+        // The inner transaction does not update the stage.
+        EXPECT_TRUE(UsdUfe::LoadRulesTransaction::isActive(*stage));
+        EXPECT_TRUE(stage->GetPrimAtPath(SdfPath("/a")).IsLoaded());
+        EXPECT_FALSE(UsdUfe::getLoadRules(*stage).IsLoaded(SdfPath("/a")));
+
+        UsdUfe::unloadPayload(*stage, SdfPath("/c"));
+        EXPECT_TRUE(recorder.resyncs.empty());
+    }
+
+    EXPECT_FALSE(UsdUfe::LoadRulesTransaction::isActive(*stage));
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/a")).IsLoaded());
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/c")).IsLoaded());
+    EXPECT_EQ(1u, recorder.resyncs.size());
+}
+
+TEST(LoadRulesTransaction, editRulesInTransaction)
+{
+    SdfLayerRefPtr payloadLayer;
+    auto           stage = createStageWithPayloads(payloadLayer);
+    UsdUfe::unloadPayload(*stage, SdfPath("/a/b"));
+    stage->DefinePrim(SdfPath("/d"));
+    stage->DefinePrim(SdfPath("/e"));
+    ResyncRecorder recorder(stage);
+
+    {
+        UsdUfe::LoadRulesTransaction transaction(stage);
+
+        // Each edit sees the rules left by the previous ones.
+        UsdUfe::duplicateLoadRules(*stage, SdfPath("/a/b"), SdfPath("/d"));
+        EXPECT_FALSE(UsdUfe::getLoadRules(*stage).IsLoaded(SdfPath("/d")));
+
+        UsdUfe::moveLoadRules(*stage, SdfPath("/d"), SdfPath("/e"));
+        EXPECT_TRUE(UsdUfe::getLoadRules(*stage).IsLoaded(SdfPath("/d")));
+        EXPECT_FALSE(UsdUfe::getLoadRules(*stage).IsLoaded(SdfPath("/e")));
+
+        UsdUfe::removeRulesForPath(*stage, SdfPath("/a/b"));
+        EXPECT_TRUE(UsdUfe::getLoadRules(*stage).IsLoaded(SdfPath("/a/b")));
+
+        // The stage is not updated yet.
+        EXPECT_FALSE(stage->GetLoadRules().IsLoaded(SdfPath("/a/b")));
+        EXPECT_TRUE(stage->GetLoadRules().IsLoaded(SdfPath("/e")));
+        EXPECT_TRUE(recorder.resyncs.empty());
+    }
+
+    const UsdStageLoadRules& rules = stage->GetLoadRules();
+    EXPECT_TRUE(rules.IsLoaded(SdfPath("/a/b")));
+    EXPECT_TRUE(rules.IsLoaded(SdfPath("/d")));
+    EXPECT_FALSE(rules.IsLoaded(SdfPath("/e")));
+    EXPECT_TRUE(stage->GetPrimAtPath(SdfPath("/a/b")).IsLoaded());
+
+    // The rules are not only payload loads and unloads, so they are set on the stage.
+    ASSERT_EQ(1u, recorder.resyncs.size());
+    EXPECT_EQ(SdfPathVector { SdfPath::AbsoluteRootPath() }, recorder.resyncs[0]);
+}
+
+TEST(LoadRulesTransaction, loadAndUnloadFastPath)
+{
+    SdfLayerRefPtr payloadLayer;
+    auto           stage = createStageWithPayloads(payloadLayer);
+    ResyncRecorder recorder(stage);
+
+    // Unloading then loading the same path gives the same rules as LoadAndUnload, which
+    // processes the unloads first, so only the payload prims are recomposed.
+    {
+        UsdUfe::LoadRulesTransaction transaction(stage);
+        UsdUfe::unloadPayload(*stage, SdfPath("/a"));
+        UsdUfe::loadPayload(*stage, SdfPath("/a"));
+        UsdUfe::unloadPayload(*stage, SdfPath("/c"));
+    }
+
+    EXPECT_TRUE(stage->GetPrimAtPath(SdfPath("/a")).IsLoaded());
+    EXPECT_TRUE(stage->GetPrimAtPath(SdfPath("/a/b")).IsLoaded());
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/c")).IsLoaded());
+    ASSERT_EQ(1u, recorder.resyncs.size());
+    for (const SdfPath& path : recorder.resyncs[0])
+        EXPECT_NE(SdfPath::AbsoluteRootPath(), path);
+}
+
+TEST(LoadRulesTransaction, setLoadRulesFallback)
+{
+    SdfLayerRefPtr payloadLayer;
+    auto           stage = createStageWithPayloads(payloadLayer);
+    UsdUfe::unloadPayload(*stage, SdfPath("/a"));
+    ResyncRecorder recorder(stage);
+
+    // Loading then unloading the same path, or a nested path, does not give the same rules
+    // as LoadAndUnload, so the rules are set on the stage.
+    {
+        UsdUfe::LoadRulesTransaction transaction(stage);
+        UsdUfe::loadPayload(*stage, SdfPath("/a"));
+        UsdUfe::unloadPayload(*stage, SdfPath("/a/b"));
+        UsdUfe::loadPayload(*stage, SdfPath("/c"));
+        UsdUfe::unloadPayload(*stage, SdfPath("/c"));
+    }
+
+    EXPECT_TRUE(stage->GetPrimAtPath(SdfPath("/a")).IsLoaded());
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/a/b")).IsLoaded());
+    EXPECT_FALSE(stage->GetPrimAtPath(SdfPath("/c")).IsLoaded());
+    ASSERT_EQ(1u, recorder.resyncs.size());
+    EXPECT_EQ(SdfPathVector { SdfPath::AbsoluteRootPath() }, recorder.resyncs[0]);
+}
@@ -1947,6 +1947,17 @@ class AttributeTestCase(unittest.TestCase):
         # check the "transform op order" stack.
         self.assertEqual(sphereXformable.GetXformOpOrderAttr().Get(), Vt.TokenArray(('xformOp:translate','xformOp:rotateXYZ', 'xformOp:scale')))
 
+        # set the edit target back to LayerB. The "transform op order" was allowed
+        # there before, but now has a stronger opinion in LayerA.
+        cmds.mayaUsdEditTarget(proxyShapePath, edit=True, editTarget=subLayerB)
+        xformOpOrderAttr = sphereXformable.GetXformOpOrderAttr()
+        self.assertTrue(mayaUsdUfe.isAttributeEditAllowed(translateAttr))
+        self.assertFalse(mayaUsdUfe.isAttributeEditAllowed(xformOpOrderAttr))
+
+        # validate the attributes together.
+        self.assertTrue(mayaUsdUfe.areAttributeEditsAllowed([translateAttr]))
+        self.assertFalse(mayaUsdUfe.areAttributeEditsAllowed([translateAttr, xformOpOrderAttr]))
+
     @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 3, 'testMetadata is only available in UFE v3 or greater.')
     def testMetadata(self):
         '''Test attribute metadata.'''
@@ -24,7 +24,10 @@ from maya import cmds
 from maya import standalone
 from maya.internal.ufeSupport import ufeCmdWrapper as ufeCmd
 
+import mayaUsd.lib
 import mayaUsd.ufe
+import mayaUsd_createStageWithNewLayer
+import usdUfe
 
 import ufe
 
@@ -235,5 +238,70 @@ class ChildFilterTestCase(unittest.TestCase):
         ball1Children = propsHier.children()
         self.assertEqual(len(ball1Children), 35)
 
+    def testChildrenPage(self):
+        mayaUtils.openGroupBallsScene()
+        cmds.select(clear=True)
+
+        propsPathStr = '|transform1|proxyShape1,/Ball_set/Props'
+        propsItem = ufe.Hierarchy.createItem(ufe.PathString.path(propsPathStr))
+        propsHier = ufe.Hierarchy.hierarchy(propsItem)
+
+        def pathStrings(items):
+            return [ufe.PathString.string(item.path()) for item in items]
+
+        # Pages are slices of the children, clamped to the number of children.
+        children = pathStrings(propsHier.children())
+        self.assertEqual(6, len(children))
+        for first, count in [(0, 2), (2, 2), (4, 10), (5, 1), (6, 1), (10, 3), (0, 0)]:
+            self.assertEqual(children[first:first + count],
+                             usdUfe.childrenPage(propsPathStr, first, count))
+
+        # Inactive children are not counted in the pages, unless the filter shows them.
+        ball1PathStr = propsPathStr + '/Ball_1'
+        mayaUsd.ufe.ufePathToPrim(ball1PathStr).SetActive(False)
+        children = pathStrings(propsHier.children())
+        self.assertEqual(5, len(children))
+        self.assertEqual(children[0:2], usdUfe.childrenPage(propsPathStr, 0, 2))
+
+        filtered = usdUfe.filteredChildrenPage(propsPathStr, {'InactivePrims': True}, 0, 2)
+        self.assertEqual(2, len(filtered))
+        self.assertEqual(ball1PathStr, filtered[0])
+        self.assertEqual(children[0], filtered[1])
+        self.assertEqual(children[0:2],
+            usdUfe.filteredChildrenPage(propsPathStr, {'InactivePrims': False}, 0, 2))
+
+        # The proxy shape hierarchy pages the children of the root prim.
+        psPathStr = '|transform1|proxyShape1'
+        self.assertEqual([psPathStr + ',/Ball_set'], usdUfe.childrenPage(psPathStr, 0, 5))
+        self.assertEqual([], usdUfe.childrenPage(psPathStr, 1, 5))
+
+    def testHasChildrenFilteredLeadingChildren(self):
+        cmds.file(new=True, force=True)
+        psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+        stage.DefinePrim('/Parent', 'Xform')
+        for i in range(3):
+            stage.DefinePrim('/Parent/Inactive%d' % i, 'Xform').SetActive(False)
+        stage.CreateClassPrim('/Parent/Class')
+        stage.DefinePrim('/Parent/Active', 'Xform')
+
+        parentPathStr = psPathStr + ',/Parent'
+        parentItem = ufe.Hierarchy.createItem(ufe.PathString.path(parentPathStr))
+        parentHier = ufe.Hierarchy.hierarchy(parentItem)
+        cf = ufe.RunTimeMgr.instance().hierarchyHandler(parentItem.runTimeId()).childFilter()
+
+        # The leading inactive and class children are skipped, the last one is found.
+        self.assertTrue(parentHier.hasChildren())
+        self.assertEqual([parentPathStr + '/Active'], usdUfe.childrenPage(parentPathStr, 0, 5))
+        cf[0].value = False
+        self.assertTrue(parentHier.hasFilteredChildren(cf))
+
+        # Without the active child, only the inactive prims filter shows children.
+        stage.GetPrimAtPath('/Parent/Active').SetActive(False)
+        self.assertFalse(parentHier.hasChildren())
+        self.assertFalse(parentHier.hasFilteredChildren(cf))
+        cf[0].value = True
+        self.assertTrue(parentHier.hasFilteredChildren(cf))
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -27,6 +27,7 @@ import mayaUsd_createStageWithNewLayer
 from pxr import UsdGeom
 from pxr import UsdShade
 from pxr import Sdf
+from pxr import Tf
 from pxr import Usd
 from pxr import Vt
 
@@ -526,27 +527,60 @@ class ContextOpsTestCase(unittest.TestCase):
 
         addPayLoads(payloadFile, ballPrims)
 
+        # The bulk load and unload commands batch the load rules edits of the stage, so
+        # each execute, undo and redo resyncs the stage once.
+        resyncNotices = []
+        def onObjectsChanged(notice, sender):
+            if notice.GetResyncedPaths():
+                resyncNotices.append(notice)
+        stage = self.ball35Prim.GetStage()
+        listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged, onObjectsChanged, stage)
+
+        def verifySingleResync():
+            self.assertEqual(len(resyncNotices), 1)
+            del resyncNotices[:]
+
         # Unload
+        # The bulk load and unload commands are undone and redone as a single entry.
         cmd = self.contextOps.doOpCmd(['Unload'])
         self.assertIsNotNone(cmd)
-        self.assertIsInstance(cmd, ufe.CompositeUndoableCommand)
+        self.assertIsInstance(cmd, ufe.UndoableCommand)
 
         ufeCmd.execute(cmd)
         verifyBulkPrimPayload(ballPrims, False)
+        verifySingleResync()
+        cmds.undo()
+        verifyBulkPrimPayload(ballPrims, True)
+        verifySingleResync()
+        cmds.redo()
+        verifyBulkPrimPayload(ballPrims, False)
+        verifySingleResync()
         cmds.undo()
         verifyBulkPrimPayload(ballPrims, True)
+        verifySingleResync()
 
         # Load with Descendants
         # Unload the payloads first, using the unload command
         ufeCmd.execute(cmd)
         cmd = self.contextOps.doOpCmd(['Load with Descendants'])
         self.assertIsNotNone(cmd)
-        self.assertIsInstance(cmd, ufe.CompositeUndoableCommand)
+        self.assertIsInstance(cmd, ufe.UndoableCommand)
 
+        del resyncNotices[:]
         ufeCmd.execute(cmd)
         verifyBulkPrimPayload(ballPrims, True)
+        verifySingleResync()
         cmds.undo()
         verifyBulkPrimPayload(ballPrims, False)
+        verifySingleResync()
+        cmds.redo()
+        verifyBulkPrimPayload(ballPrims, True)
+        verifySingleResync()
+        cmds.undo()
+        verifyBulkPrimPayload(ballPrims, False)
+        verifySingleResync()
+
+        listener.Revoke()
 
 
         # Change visility, undo/redo.
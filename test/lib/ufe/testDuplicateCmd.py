@@ -726,6 +726,79 @@ class DuplicateCmdTestCase(unittest.TestCase):
         newObjItem = ufe.Hierarchy.createItem(ufe.PathString.path(newObj[0]))
         self.assertEqual(newObjItem.nodeName(), 'Cone3')
 
+    def testDuplicateSelectionUniqueNames(self):
+        '''Test that duplicating many siblings at once gives each duplicate its own
+        unique name, following the Maya unique new name standard.'''
+
+        cmds.file(new=True, force=True)
+        import mayaUsd_createStageWithNewLayer
+
+        psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+        stage.DefinePrim('/Xform1', 'Xform')
+        stage.DefinePrim('/Xform1/Cone1', 'Cone')
+        stage.DefinePrim('/Xform1/Cone3', 'Cone')
+        stage.DefinePrim('/Xform1/Cone006', 'Cone')
+        stage.DefinePrim('/Xform1/Sphere', 'Sphere')
+
+        sel = ufe.Selection()
+        for name in ['Cone1', 'Cone3', 'Cone006', 'Sphere']:
+            sel.append(ufeUtils.createUfeSceneItem(psPathStr, '/Xform1/' + name))
+
+        batchOpsHandler = ufe.RunTimeMgr.instance().batchOpsHandler(sel.front().runTimeId())
+        self.assertIsNotNone(batchOpsHandler)
+
+        def duplicateNames():
+            names = [child.GetName() for child in stage.GetPrimAtPath('/Xform1').GetChildren()]
+            return sorted(name for name in names
+                          if name not in ['Cone1', 'Cone3', 'Cone006', 'Sphere'])
+
+        # The new names account for the duplicates created earlier in the same command.
+        cmd = batchOpsHandler.duplicateSelectionCmd(sel, {"inputConnections": False})
+        cmd.execute()
+        expectedNames = ['Cone007', 'Cone008', 'Cone009', 'Sphere1']
+        self.assertEqual(duplicateNames(), expectedNames)
+
+        cmd.undo()
+        self.assertEqual(duplicateNames(), [])
+
+        cmd.redo()
+        self.assertEqual(duplicateNames(), expectedNames)
+
+        # A second duplicate sees the names created by the first one.
+        cmd = batchOpsHandler.duplicateSelectionCmd(sel, {"inputConnections": False})
+        cmd.execute()
+        expectedNames = sorted(expectedNames + ['Cone010', 'Cone011', 'Cone012', 'Sphere2'])
+        self.assertEqual(duplicateNames(), expectedNames)
+
+    def testDuplicateSelectionLargeSuffix(self):
+        '''Test that a sibling whose numerical suffix does not fit in an int, such as a
+        timestamp, does not prevent duplicating.'''
+
+        cmds.file(new=True, force=True)
+        import mayaUsd_createStageWithNewLayer
+
+        psPathStr = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(psPathStr).GetStage()
+        stage.DefinePrim('/Xform1', 'Xform')
+        stage.DefinePrim('/Xform1/Cone1', 'Cone')
+        stage.DefinePrim('/Xform1/Asset_20240101123456', 'Xform')
+
+        sel = ufe.Selection()
+        for name in ['Cone1', 'Asset_20240101123456']:
+            sel.append(ufeUtils.createUfeSceneItem(psPathStr, '/Xform1/' + name))
+
+        batchOpsHandler = ufe.RunTimeMgr.instance().batchOpsHandler(sel.front().runTimeId())
+        cmd = batchOpsHandler.duplicateSelectionCmd(sel, {"inputConnections": False})
+        cmd.execute()
+
+        names = [child.GetName() for child in stage.GetPrimAtPath('/Xform1').GetChildren()]
+        self.assertEqual(len(names), 4)
+        self.assertIn('Cone2', names)
+        newAssetNames = [name for name in names
+                         if name.startswith('Asset_') and name != 'Asset_20240101123456']
+        self.assertEqual(len(newAssetNames), 1)
+
     def testConnectionWithChangingOrderOfTen(self):
         '''
         Test duplicating a prim that has mateiral connections
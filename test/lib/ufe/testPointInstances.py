@@ -32,6 +32,23 @@ import ufe
 import unittest
 
 
+class Transform3dObserver(ufe.Observer):
+    def __init__(self):
+        super(Transform3dObserver, self).__init__()
+        self._notifications = 0
+
+    def __call__(self, notification):
+        if isinstance(notification, ufe.Transform3dChanged):
+            self._notifications += 1
+
+    @property
+    def notifications(self):
+        return self._notifications
+
+    def reset(self):
+        self._notifications = 0
+
+
 class PointInstancesTestCase(unittest.TestCase):
     '''
     Tests that the UFE path and scene item interfaces work as expected when
@@ -356,5 +373,81 @@ class PointInstancesTestCase(unittest.TestCase):
             Gf.IsClose(scale, Gf.Vec3f(1.0, 1.0, 1.0), self.EPSILON))
 
 
+    def _observeInstances(self, instanceIndices):
+        observers = {}
+        for instanceIndex in instanceIndices:
+            ufePath = ufe.Path([
+                mayaUtils.createUfePathSegment('|UsdProxy|UsdProxyShape'),
+                usdUtils.createUfePathSegment(
+                    '/PointInstancerGrid/PointInstancer/%d' % instanceIndex)])
+            ufeItem = ufe.Hierarchy.createItem(ufePath)
+            observers[instanceIndex] = Transform3dObserver()
+            ufe.Transform3d.addObserver(ufeItem, observers[instanceIndex])
+        return observers
+
+    def _getPositionsAttr(self):
+        prim = mayaUsdUfe.ufePathToPrim(
+            '|UsdProxy|UsdProxyShape,/PointInstancerGrid/PointInstancer')
+        return UsdGeom.PointInstancer(prim).GetPositionsAttr()
+
+    def testPointInstanceTransform3dNotifications(self):
+        '''
+        Tests that editing the positions of a PointInstancer only notifies the
+        point instances of the blocks of instances whose positions changed.
+        '''
+        # Instances are diffed by blocks of 1024, so use a grid large enough to
+        # hold instances in different blocks.
+        mayaUtils.openPointInstancesGrid7kScene()
+        observers = self._observeInstances([3, 2000])
+        positionsAttr = self._getPositionsAttr()
+
+        # Nothing is known about the positions before the first edit, so every
+        # instance is notified.
+        positions = positionsAttr.Get()
+        positions[2000] = Gf.Vec3f(1.0, 2.0, 3.0)
+        positionsAttr.Set(positions)
+        self.assertEqual(observers[3].notifications, 1)
+        self.assertEqual(observers[2000].notifications, 1)
+
+        # Later edits only notify the instances of the blocks that changed.
+        observers[3].reset()
+        observers[2000].reset()
+        positions = positionsAttr.Get()
+        positions[2000] = Gf.Vec3f(4.0, 5.0, 6.0)
+        positionsAttr.Set(positions)
+        self.assertEqual(observers[3].notifications, 0)
+        self.assertEqual(observers[2000].notifications, 1)
+
+        # Changing the number of instances notifies all of them again.
+        observers[2000].reset()
+        positions = positionsAttr.Get()
+        positionsAttr.Set(list(positions) + [Gf.Vec3f(0.0, 0.0, 0.0)])
+        self.assertEqual(observers[3].notifications, 1)
+        self.assertEqual(observers[2000].notifications, 1)
+
+    def testPointInstanceFirstEditNotifications(self):
+        '''
+        Tests that once the transform of a point instance has been looked at,
+        even the first edit of the PointInstancer does not notify every
+        instance.
+        '''
+        mayaUtils.openPointInstancesGrid7kScene()
+        observers = self._observeInstances([3, 2000])
+        positionsAttr = self._getPositionsAttr()
+
+        # Getting the Transform3d of an instance records the current values of
+        # the PointInstancer.
+        ufeItem = ufe.Hierarchy.createItem(ufe.Path([
+            mayaUtils.createUfePathSegment('|UsdProxy|UsdProxyShape'),
+            usdUtils.createUfePathSegment('/PointInstancerGrid/PointInstancer/2000')]))
+        self.assertIsNotNone(ufe.Transform3d.transform3d(ufeItem))
+
+        positions = positionsAttr.Get()
+        positions[2000] = Gf.Vec3f(1.0, 2.0, 3.0)
+        positionsAttr.Set(positions)
+        self.assertEqual(observers[3].notifications, 0)
+        self.assertEqual(observers[2000].notifications, 1)
+
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
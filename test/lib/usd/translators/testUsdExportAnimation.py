@@ -64,6 +64,183 @@ class testUsdExportAnimation(unittest.TestCase):
             num_samples = attr.GetNumTimeSamples()
             self.assertEqual(num_samples, int(not state))
 
+    def testExportParallelFrameExport(self):
+        """Test that staging the animated meshes on worker threads writes the
+           same data as the serial export."""
+        cmds.file(new=True, force=True)
+        cmds.polyCube(name="StaticCube")
+        _, cubeHistory = cmds.polyCube(name="AnimCube")
+        cmds.setKeyframe(cubeHistory, v=1.0, at='width', time=1)
+        cmds.setKeyframe(cubeHistory, v=3.0, at='width', time=5)
+        _, planeHistory = cmds.polyPlane(name="AnimPlane")
+        cmds.setKeyframe(planeHistory, v=2, at='subdivisionsWidth', time=1)
+        cmds.setKeyframe(planeHistory, v=6, at='subdivisionsWidth', time=5)
+
+        stages = []
+        for state in (False, True):
+            path = os.path.join(
+                self.temp_dir, "parallelFrameExport{}.usda".format("On" if state else "Off"))
+            cmds.mayaUSDExport(
+                f=path, frameRange=(1, 5), defaultMeshScheme="none", parallelFrameExport=state)
+            stages.append(Usd.Stage.Open(path))
+
+        serialStage, parallelStage = stages
+        attrNames = ("points", "extent", "faceVertexCounts", "faceVertexIndices", "normals")
+        for primPath in ("/StaticCube", "/AnimCube", "/AnimPlane"):
+            serialPrim = serialStage.GetPrimAtPath(primPath)
+            parallelPrim = parallelStage.GetPrimAtPath(primPath)
+            for attrName in attrNames:
+                serialAttr = serialPrim.GetAttribute(attrName)
+                parallelAttr = parallelPrim.GetAttribute(attrName)
+                self.assertEqual(
+                    serialAttr.GetTimeSamples(), parallelAttr.GetTimeSamples())
+                for time in [Usd.TimeCode.Default()] + serialAttr.GetTimeSamples():
+                    self.assertEqual(serialAttr.Get(time), parallelAttr.Get(time))
+
+    def _assertSameSamples(self, expectedStage, stage):
+        for expectedPrim in expectedStage.Traverse():
+            prim = stage.GetPrimAtPath(expectedPrim.GetPath())
+            self.assertTrue(prim, expectedPrim.GetPath())
+            for expectedAttr in expectedPrim.GetAttributes():
+                attr = prim.GetAttribute(expectedAttr.GetName())
+                self.assertTrue(attr, expectedAttr.GetPath())
+                self.assertEqual(
+                    expectedAttr.GetTimeSamples(), attr.GetTimeSamples(), expectedAttr.GetPath())
+                for sample in expectedAttr.GetTimeSamples():
+                    self.assertEqual(expectedAttr.Get(sample), attr.Get(sample),
+                                     "{} at {}".format(expectedAttr.GetPath(), sample))
+
+    def testExportContextEvaluation(self):
+        """Test that evaluating the samples in a DG context writes the same
+           samples as changing the current time, when exporting a subset of
+           a scene that also holds an unrelated rig."""
+        cmds.file(new=True, force=True)
+
+        # The exported subset: an animated transform and a deforming mesh.
+        cube, cubeHistory = cmds.polyCube(name="AnimCube")
+        cmds.setKeyframe(cube, v=0.0, at='translateX', time=1)
+        cmds.setKeyframe(cube, v=10.0, at='translateX', time=10)
+        cmds.setKeyframe(cubeHistory, v=1.0, at='height', time=1)
+        cmds.setKeyframe(cubeHistory, v=4.0, at='height', time=10)
+
+        # The unrelated rig, only evaluated when the current time changes.
+        rig = cmds.group(empty=True, name="Rig")
+        for i in range(10):
+            sphere, _ = cmds.polySphere(name="RigSphere{}".format(i))
+            cmds.parent(sphere, rig)
+            cmds.expression(s="{}.translateY = sin(time * {})".format(sphere, i + 1))
+
+        cmds.currentTime(1)
+        stages = {}
+        for state in (False, True):
+            path = os.path.join(
+                self.temp_dir, "contextEvaluation{}.usda".format("On" if state else "Off"))
+            cmds.select(cube, replace=True)
+            cmds.mayaUSDExport(
+                f=path, selection=True, frameRange=(1, 10), contextEvaluation=state)
+            stages[state] = Usd.Stage.Open(path)
+
+        self.assertEqual(
+            len(stages[False].GetAttributeAtPath("/AnimCube.points").GetTimeSamples()), 10)
+        self._assertSameSamples(stages[False], stages[True])
+
+        # The current time is left untouched by the DG context evaluation.
+        self.assertEqual(cmds.currentTime(query=True), 1)
+
+    def testExportContextEvaluationSkinnedMesh(self):
+        """Test that the extents of a skinned mesh, which is not staged, are
+           the same with and without the contextEvaluation flag."""
+        cmds.file(new=True, force=True)
+        root = cmds.group(empty=True, name="root")
+        cube, _ = cmds.polyCube(name="Cube")
+        cmds.select(clear=True)
+        joint = cmds.joint()
+        cmds.parent(cube, joint, root)
+        cmds.skinCluster(joint, cube)
+        cmds.setKeyframe(joint, v=0.0, at='translateY', time=1)
+        cmds.setKeyframe(joint, v=5.0, at='translateY', time=10)
+
+        cmds.currentTime(1)
+        stages = {}
+        for state in (False, True):
+            path = os.path.join(
+                self.temp_dir, "contextEvaluationSkin{}.usda".format("On" if state else "Off"))
+            cmds.mayaUSDExport(f=path, exportSkels="auto", exportSkin="auto",
+                               frameRange=(1, 10), contextEvaluation=state)
+            stages[state] = Usd.Stage.Open(path)
+
+        # The skinned mesh moves with the joint, so its extents vary.
+        extentAttr = stages[False].GetAttributeAtPath("/root.extent")
+        self.assertEqual(len(extentAttr.GetTimeSamples()), 10)
+        self.assertNotEqual(extentAttr.Get(1), extentAttr.Get(10))
+        self._assertSameSamples(stages[False], stages[True])
+
+        self.assertEqual(cmds.currentTime(query=True), 1)
+
+    def testExportContextEvaluationFallback(self):
+        """Test that the export changes the current time when a prim writer
+           does not support the DG context evaluation."""
+        cmds.file(new=True, force=True)
+        cube, _ = cmds.polyCube(name="AnimCube")
+        cmds.setKeyframe(cube, v=0.0, at='translateX', time=1)
+        cmds.setKeyframe(cube, v=10.0, at='translateX', time=10)
+        camera = cmds.rename(cmds.camera()[0], "AnimCamera")
+        cameraShape = cmds.listRelatives(camera, shapes=True)[0]
+        cmds.setKeyframe(cameraShape, v=35.0, at='focalLength', time=1)
+        cmds.setKeyframe(cameraShape, v=70.0, at='focalLength', time=10)
+
+        stages = {}
+        for state in (False, True):
+            path = os.path.join(
+                self.temp_dir, "contextEvaluationFallback{}.usda".format("On" if state else "Off"))
+            cmds.mayaUSDExport(f=path, frameRange=(1, 10), contextEvaluation=state)
+            stages[state] = Usd.Stage.Open(path)
+
+        for attrPath in ("/AnimCube.xformOp:translate", "/AnimCamera.focalLength"):
+            timeAttr = stages[False].GetAttributeAtPath(attrPath)
+            contextAttr = stages[True].GetAttributeAtPath(attrPath)
+            self.assertEqual(len(timeAttr.GetTimeSamples()), 10)
+            self.assertEqual(timeAttr.GetTimeSamples(), contextAttr.GetTimeSamples())
+            for sample in timeAttr.GetTimeSamples():
+                self.assertEqual(timeAttr.Get(sample), contextAttr.Get(sample))
+
+    def testExportStreamingFrameWindow(self):
+        """Test that flushing the time samples to value clips during the
+           export writes the same data as keeping them in memory."""
+        cmds.file(new=True, force=True)
+        cube, cubeHistory = cmds.polyCube(name="AnimCube")
+        cmds.setKeyframe(cube, v=0.0, at='translateX', time=1)
+        cmds.setKeyframe(cube, v=10.0, at='translateX', time=20)
+        cmds.setKeyframe(cubeHistory, v=1.0, at='depth', time=1)
+        cmds.setKeyframe(cubeHistory, v=5.0, at='depth', time=20)
+
+        stages = []
+        for window in (0, 3):
+            path = os.path.join(self.temp_dir, "streamingFrameWindow{}.usdc".format(window))
+            cmds.mayaUSDExport(f=path, frameRange=(1, 20), streamingFrameWindow=window)
+            stages.append(Usd.Stage.Open(path))
+
+        for attrPath in ("/AnimCube.xformOp:translate", "/AnimCube.points", "/AnimCube.extent"):
+            memoryAttr = stages[0].GetAttributeAtPath(attrPath)
+            streamedAttr = stages[1].GetAttributeAtPath(attrPath)
+            self.assertEqual(len(memoryAttr.GetTimeSamples()), 20)
+            self.assertEqual(memoryAttr.GetTimeSamples(), streamedAttr.GetTimeSamples())
+            for sample in memoryAttr.GetTimeSamples():
+                self.assertEqual(memoryAttr.Get(sample), streamedAttr.Get(sample))
+
+            # The output layer no longer holds the samples, each window of 3 frames has its own
+            # value clip.
+            rootLayer = stages[1].GetRootLayer()
+            self.assertEqual(rootLayer.ListTimeSamplesForPath(attrPath), [])
+
+        clipsAPI = Usd.ClipsAPI(stages[1].GetPrimAtPath("/AnimCube"))
+        clipPaths = clipsAPI.GetClipAssetPaths()
+        self.assertEqual(len(clipPaths), 7)
+        for clipPath in clipPaths:
+            self.assertTrue(os.path.exists(os.path.join(self.temp_dir, clipPath.path)))
+        self.assertTrue(os.path.exists(
+            os.path.join(self.temp_dir, clipsAPI.GetClipManifestAssetPath().path)))
+
     def testExportAnimatedCompundValue(self):
         """MayaUSD Issue #1712: Test that animated custom compound attributes
            on a mesh are exported."""
@@ -21,7 +21,7 @@ import unittest
 from maya import cmds
 from maya import standalone
 
-from pxr import Usd, UsdGeom, Vt
+from pxr import Usd, UsdGeom, UsdShade, Vt
 
 import fixturesUtils
 
@@ -31,10 +31,9 @@ class testUsdExportGeomSubset(unittest.TestCase):
     def setUpClass(cls):
         inputPath = fixturesUtils.setUpClass(__file__)
 
-        filePath = os.path.join(inputPath,
-                                "UsdExportGeomSubsetTest",
-                                "UsdExportGeomSubsetTest.ma")
-        cmds.file(filePath, force=True, open=True)
+        cls.filePath = os.path.join(inputPath,
+                                    "UsdExportGeomSubsetTest",
+                                    "UsdExportGeomSubsetTest.ma")
 
     @classmethod
     def tearDownClass(cls):
@@ -45,6 +44,8 @@ class testUsdExportGeomSubset(unittest.TestCase):
         The test scene has multiple face set connections to materials. Make sure
         the export code has merged the indices correctly.
         """
+        cmds.file(self.filePath, force=True, open=True)
+
         usdFile = os.path.abspath('UsdExportGeomSubset.usda')
         cmds.usdExport(mergeTransformAndShape=True, file=usdFile,
                        shadingMode='useRegistry')
@@ -64,6 +65,69 @@ class testUsdExportGeomSubset(unittest.TestCase):
             self.assertEqual(subset.GetElementTypeAttr().Get(), UsdGeom.Tokens.face)
             self.assertEqual(subset.GetIndicesAttr().Get(), Vt.IntArray(indices))
 
+    def testExportManyShadingEngines(self):
+        """
+        Shapes share several shading engines, each assigned to some of their
+        faces. Make sure each shape gets one subset per shading engine, with
+        the faces of that shading engine, bound to its material, and that a
+        shape assigned as a whole is bound directly.
+        """
+        cmds.file(new=True, force=True)
+
+        numShadingEngines = 3
+        shadingEngines = []
+        for i in range(numShadingEngines):
+            shader = cmds.shadingNode("lambert", asShader=True, name="manySE%d" % i)
+            shadingEngine = cmds.sets(renderable=True, noSurfaceShader=True,
+                                      empty=True, name="manySE%dSG" % i)
+            cmds.connectAttr(shader + ".outColor", shadingEngine + ".surfaceShader")
+            shadingEngines.append(shadingEngine)
+
+        # Assign the faces of each plane to the shading engines in turn,
+        # starting from a different shading engine for each plane.
+        numFaces = 16
+        expected = {}
+        for planeIndex, plane in enumerate(["planeA", "planeB"]):
+            cmds.polyPlane(name=plane, subdivisionsX=4, subdivisionsY=4)
+            for face in range(numFaces):
+                seIndex = (face + planeIndex) % numShadingEngines
+                cmds.sets("%s.f[%d]" % (plane, face), e=True,
+                          forceElement=shadingEngines[seIndex])
+                expected.setdefault(
+                    "/%s/%s" % (plane, shadingEngines[seIndex]), []).append(face)
+
+        cmds.polyPlane(name="planeC")
+        cmds.sets("planeC", e=True, forceElement=shadingEngines[1])
+
+        usdFile = os.path.abspath('UsdExportGeomSubsetManyShadingEngines.usda')
+        cmds.usdExport(mergeTransformAndShape=True, file=usdFile,
+                       shadingMode='useRegistry', convertMaterialsTo=['UsdPreviewSurface'])
+
+        stage = Usd.Stage.Open(usdFile)
+
+        materialPaths = {}
+        for subset_path, indices in expected.items():
+            subsetPrim = stage.GetPrimAtPath(subset_path)
+            subset = UsdGeom.Subset(subsetPrim)
+            self.assertTrue(subset, subset_path)
+            self.assertEqual(subset.GetElementTypeAttr().Get(), UsdGeom.Tokens.face)
+            self.assertEqual(subset.GetIndicesAttr().Get(), Vt.IntArray(indices))
+
+            # Both planes bind the subsets of a shading engine to the same material.
+            materialPath = UsdShade.MaterialBindingAPI(
+                subsetPrim).GetDirectBinding().GetMaterialPath()
+            self.assertTrue(stage.GetPrimAtPath(materialPath), subset_path)
+            shadingEngine = subsetPrim.GetName()
+            self.assertEqual(materialPaths.setdefault(shadingEngine, materialPath), materialPath)
+
+        self.assertEqual(len(set(materialPaths.values())), numShadingEngines)
+
+        planeC = stage.GetPrimAtPath("/planeC")
+        self.assertEqual(UsdShade.MaterialBindingAPI(planeC).GetMaterialBindSubsets(), [])
+        self.assertEqual(
+            UsdShade.MaterialBindingAPI(planeC).GetDirectBinding().GetMaterialPath(),
+            materialPaths[shadingEngines[1]])
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -14,13 +14,14 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 #
-import unittest, os
-from pxr import Gf, Usd, UsdSkel
+import unittest, os, tempfile
+from pxr import Gf, Usd, UsdGeom, UsdSkel, Vt
 
 from maya import cmds
 from maya import standalone
 
 import maya.api.OpenMaya as OM
+import maya.api.OpenMayaAnim as OMA
 
 import fixturesUtils
 
@@ -321,6 +322,210 @@ class testUsdImportSkeleton(unittest.TestCase):
         blendshapes = cmds.ls(typ="blendShape")
         self.assertFalse(blendshapes, "Single sample wasn't treated as a static item")
 
+    def test_SkelImportSparseWeights(self):
+        """
+        Tests that the skinCluster weights imported from the sparse joint influences
+        match, bit for bit, the dense per-joint weights computed from the influences.
+        """
+        cmds.file(new=True, force=True)
+
+        # A grid mesh with three influences per point, bound to a chain of four joints.
+        stage = Usd.Stage.CreateInMemory()
+        UsdSkel.Root.Define(stage, "/Root")
+
+        jointNames = ["A", "A/B", "A/B/C", "A/B/C/D"]
+        numJoints = len(jointNames)
+        skel = UsdSkel.Skeleton.Define(stage, "/Root/Skeleton")
+        skel.CreateJointsAttr(jointNames)
+        skel.CreateBindTransformsAttr(Vt.Matrix4dArray([Gf.Matrix4d(1)] * numJoints))
+        skel.CreateRestTransformsAttr(Vt.Matrix4dArray([Gf.Matrix4d(1)] * numJoints))
+
+        gridSize = 5
+        numPoints = gridSize * gridSize
+        mesh = UsdGeom.Mesh.Define(stage, "/Root/Mesh")
+        mesh.CreatePointsAttr(
+            [Gf.Vec3f(x, y, 0) for y in range(gridSize) for x in range(gridSize)])
+        faceIndices = []
+        for y in range(gridSize - 1):
+            for x in range(gridSize - 1):
+                pt = y * gridSize + x
+                faceIndices.extend([pt, pt + 1, pt + gridSize + 1, pt + gridSize])
+        mesh.CreateFaceVertexCountsAttr([4] * (len(faceIndices) // 4))
+        mesh.CreateFaceVertexIndicesAttr(faceIndices)
+
+        numInfluences = 3
+        indices = []
+        weights = []
+        for pt in range(numPoints):
+            if pt % 5 == 0:
+                # Multiple influences referencing the same joint.
+                indices.extend([2, 2, 0])
+                weights.extend([0.25, 0.5, 0.25])
+            elif pt % 5 == 1:
+                # Unused influences, padded with joint 0 and weight 0.
+                indices.extend([3, 0, 0])
+                weights.extend([1.0, 0.0, 0.0])
+            else:
+                indices.extend([pt % 4, (pt + 1) % 4, (pt + 2) % 4])
+                weights.extend([0.1 + pt / 100.0, 0.3, 0.6 - pt / 100.0])
+
+        binding = UsdSkel.BindingAPI.Apply(mesh.GetPrim())
+        binding.CreateJointIndicesPrimvar(False, numInfluences).Set(indices)
+        binding.CreateJointWeightsPrimvar(False, numInfluences).Set(weights)
+        binding.CreateGeomBindTransformAttr(Gf.Matrix4d(1))
+        binding.CreateSkeletonRel().SetTargets([skel.GetPath()])
+
+        with tempfile.NamedTemporaryFile(suffix=".usda", delete=False) as f:
+            path = f.name
+        try:
+            stage.GetRootLayer().Export(path)
+            cmds.usdImport(file=path, primPath="/Root",
+                           shadingMode=[["none", "default"], ])
+        finally:
+            os.remove(path)
+
+        # Dense weights, summing the weights of the influences of a point
+        # referencing the same joint, in double precision.
+        usdWeights = binding.GetJointWeightsPrimvar().Get()
+        expectedWeights = [0.0] * (numPoints * numJoints)
+        for i, jointIndex in enumerate(binding.GetJointIndicesPrimvar().Get()):
+            expectedWeights[(i // numInfluences) * numJoints + jointIndex] += usdWeights[i]
+
+        selectionList = OM.MSelectionList()
+        selectionList.add("skinCluster_Mesh")
+        selectionList.add("MeshShape")
+        skinClusterFn = OMA.MFnSkinCluster(selectionList.getDependNode(0))
+
+        components = OM.MFnSingleIndexedComponent()
+        componentsObj = components.create(OM.MFn.kMeshVertComponent)
+        components.setCompleteData(numPoints)
+
+        mayaWeights, numMayaInfluences = skinClusterFn.getWeights(
+            selectionList.getDagPath(1), componentsObj)
+        self.assertEqual(numMayaInfluences, numJoints)
+        self.assertEqual(list(mayaWeights), expectedWeights)
+
+    def _CreateManyAnimSamplesStage(self, numTimes):
+        """
+        Creates a stage with a Skeleton whose joints are animated with
+        numTimes time samples.
+        """
+        stage = Usd.Stage.CreateInMemory()
+        stage.SetStartTimeCode(1)
+        stage.SetEndTimeCode(numTimes)
+        root = UsdSkel.Root.Define(stage, "/Root")
+
+        jointNames = ["A", "A/B", "A/B/C", "A/B/C/D", "A/E"]
+        numJoints = len(jointNames)
+        restXforms = [Gf.Matrix4d(1).SetTranslate(Gf.Vec3d(0, 1, 0))] * numJoints
+        skel = UsdSkel.Skeleton.Define(stage, "/Root/Skeleton")
+        skel.CreateJointsAttr(jointNames)
+        skel.CreateBindTransformsAttr(Vt.Matrix4dArray(restXforms))
+        skel.CreateRestTransformsAttr(Vt.Matrix4dArray(restXforms))
+
+        anim = UsdSkel.Animation.Define(stage, "/Root/Skeleton/Anim")
+        anim.CreateJointsAttr(jointNames)
+        translationsAttr = anim.CreateTranslationsAttr()
+        rotationsAttr = anim.CreateRotationsAttr()
+        scalesAttr = anim.CreateScalesAttr()
+        for t in range(1, numTimes + 1):
+            translationsAttr.Set(
+                [Gf.Vec3f(j, 1 + 0.01 * t, 0.1 * j * t) for j in range(numJoints)], t)
+            rotationsAttr.Set(
+                [Gf.Quatf(Gf.Rotation(Gf.Vec3d(1, j, 1).GetNormalized(),
+                                      (3.0 * t + 10 * j) % 360).GetQuat())
+                 for j in range(numJoints)], t)
+            scalesAttr.Set(
+                [Gf.Vec3h(1 + 0.001 * t, 1, 1 + 0.01 * j) for j in range(numJoints)], t)
+        UsdSkel.BindingAPI.Apply(skel.GetPrim()).CreateAnimationSourceRel().SetTargets(
+            [anim.GetPath()])
+
+        return stage, root, skel
+
+    def _ImportStage(self, stage, **kwargs):
+        with tempfile.NamedTemporaryFile(suffix=".usda", delete=False) as f:
+            path = f.name
+        try:
+            stage.GetRootLayer().Export(path)
+            cmds.usdImport(file=path, readAnimData=True, primPath="/Root",
+                           shadingMode=[["none", "default"], ], **kwargs)
+        finally:
+            os.remove(path)
+
+    def test_SkelImportManyAnimSamples(self):
+        """
+        Tests that the animation curves of the joints of a Skeleton animated
+        with many time samples have a key at each time sample, matching the
+        joint transforms computed by UsdSkel.
+        """
+        cmds.file(new=True, force=True)
+
+        numTimes = 200
+        stage, root, skel = self._CreateManyAnimSamplesStage(numTimes)
+        self._ImportStage(stage)
+
+        skelCache = UsdSkel.Cache()
+        skelCache.Populate(root, Usd.PrimDefaultPredicate)
+        skelQuery = skelCache.GetSkelQuery(skel)
+        self.assertTrue(skelQuery)
+
+        timeSamples = skelQuery.GetAnimQuery().GetJointTransformTimeSamples()
+        self.assertEqual(len(timeSamples), numTimes)
+
+        joints = [_GetDepNode(name.split("/")[-1]) for name in skelQuery.GetJointOrder()]
+        for joint in joints:
+            for attr in ("translate", "rotate", "scale"):
+                for axis in "XYZ":
+                    keyTimes = cmds.keyframe(
+                        "%s.%s%s" % (joint.name(), attr, axis), query=True, timeChange=True)
+                    self.assertEqual(keyTimes, list(timeSamples))
+
+        self._ValidateJointTransforms(skelQuery, joints)
+
+    def test_SkelImportManyAnimSamplesEulerFilter(self):
+        """
+        Tests that the Euler filtered animation curves of a joint match the
+        ones of the joint representing the Skeleton, which is imported on
+        its own, when both have the same animation.
+        """
+        cmds.file(new=True, force=True)
+
+        numTimes = 200
+        stage, root, skel = self._CreateManyAnimSamplesStage(numTimes)
+
+        # Animate the Skeleton prim like its first joint.
+        skelCache = UsdSkel.Cache()
+        skelCache.Populate(root, Usd.PrimDefaultPredicate)
+        skelQuery = skelCache.GetSkelQuery(skel)
+        self.assertTrue(skelQuery)
+        self.assertEqual(skelQuery.GetJointOrder()[0], "A")
+
+        transformOp = UsdGeom.Xformable(skel.GetPrim()).AddTransformOp()
+        for t in range(1, numTimes + 1):
+            transformOp.Set(skelQuery.ComputeJointLocalTransforms(t)[0], t)
+
+        self._ImportStage(stage, applyEulerFilter=True)
+
+        skelJoint = _GetDepNode("Skeleton").name()
+        joint = _GetDepNode("A").name()
+        for attr in ("translate", "rotate", "scale"):
+            for axis in "XYZ":
+                skelPlug = "%s.%s%s" % (skelJoint, attr, axis)
+                plug = "%s.%s%s" % (joint, attr, axis)
+                self.assertEqual(
+                    cmds.keyframe(plug, query=True, timeChange=True),
+                    cmds.keyframe(skelPlug, query=True, timeChange=True))
+
+                values = cmds.keyframe(plug, query=True, valueChange=True)
+                self.assertEqual(len(values), numTimes)
+                self.assertTrue(_ArraysAreClose(
+                    values, cmds.keyframe(skelPlug, query=True, valueChange=True)))
+
+                # The filtered rotations do not flip between consecutive keys.
+                if attr == "rotate":
+                    for prev, current in zip(values, values[1:]):
+                        self.assertLess(abs(current - prev), 180)
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)